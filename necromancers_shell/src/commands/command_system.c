@@ -3,17 +3,23 @@
 #include "../terminal/ui_feedback.h"
 #include "../utils/logger.h"
 #include "../core/state_manager.h"
+#include "../core/memory.h"
 #include <stdlib.h>
 
+/* Initial size of the per-command scratch arena */
+#define COMMAND_SCRATCH_SIZE 16384
+
 /* Global command system state */
 static struct {
     bool initialized;
     CommandRegistry* registry;
     InputHandler* input_handler;
+    Arena* scratch;           /* Tokens, parsed command and result strings */
 } g_command_system = {
     .initialized = false,
     .registry = NULL,
-    .input_handler = NULL
+    .input_handler = NULL,
+    .scratch = NULL
 };
 
 /* Global registry reference for commands that need it */
@@ -65,6 +71,20 @@ bool command_system_init(void) {
         return false;
     }
 
+    /* Create per-command scratch arena */
+    g_command_system.scratch = arena_create(COMMAND_SCRATCH_SIZE);
+    if (!g_command_system.scratch) {
+        LOG_ERROR("Failed to create command scratch arena");
+        input_handler_destroy(g_command_system.input_handler);
+        g_command_system.input_handler = NULL;
+        command_registry_destroy(g_command_system.registry);
+        g_command_registry = NULL;
+        ui_feedback_shutdown();
+        return false;
+    }
+    input_handler_set_scratch_arena(g_command_system.input_handler,
+                                    g_command_system.scratch);
+
     g_command_system.initialized = true;
     LOG_INFO("Command system initialized successfully");
 
@@ -76,6 +96,11 @@ void command_system_shutdown(void) {
 
     LOG_INFO("Shutting down command system");
 
+    /* Release scratch arena (invalidates the last CommandResult) */
+    command_result_set_arena(NULL);
+    arena_destroy(g_command_system.scratch);
+    g_command_system.scratch = NULL;
+
     /* Destroy input handler (saves history) */
     input_handler_destroy(g_command_system.input_handler);
     g_command_system.input_handler = NULL;
@@ -96,13 +121,27 @@ bool command_system_is_initialized(void) {
     return g_command_system.initialized;
 }
 
+/*
+ * Reclaim the previous command's scratch allocations and route this
+ * command's tokens, parse tree and result strings into the arena. The
+ * returned CommandResult stays valid until the next command starts.
+ */
+static void begin_command_scratch(void) {
+    arena_reset(g_command_system.scratch);
+    command_result_set_arena(g_command_system.scratch);
+}
+
 CommandResult command_system_process_input(const char* prompt) {
     if (!g_command_system.initialized) {
         return command_result_error(EXEC_ERROR_INTERNAL,
                                    "Command system not initialized");
     }
 
-    return input_handler_read_and_execute(g_command_system.input_handler, prompt);
+    begin_command_scratch();
+    CommandResult result = input_handler_read_and_execute(g_command_system.input_handler, prompt);
+    command_result_set_arena(NULL);
+
+    return result;
 }
 
 CommandResult command_system_execute(const char* input) {
@@ -111,7 +150,11 @@ CommandResult command_system_execute(const char* input) {
                                    "Command system not initialized");
     }
 
-    return input_handler_execute(g_command_system.input_handler, input);
+    begin_command_scratch();
+    CommandResult result = input_handler_execute(g_command_system.input_handler, input);
+    command_result_set_arena(NULL);
+
+    return result;
 }
 
 CommandRegistry* command_system_get_registry(void) {
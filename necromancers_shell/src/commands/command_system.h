@@ -14,6 +14,10 @@
  * Provides high-level interface to the entire command system.
  * Manages global registry, history, and input handling.
  *
+ * Each command's tokens, parsed form and CommandResult strings come from a
+ * scratch arena that is reset when the next command starts, so results
+ * returned here are only valid until the next process_input/execute call.
+ *
  * Usage:
  *   command_system_init();
  *   while (running) {
@@ -56,6 +60,7 @@ CommandResult command_system_process_input(const char* prompt);
 
 /**
  * Execute command string directly
+ * Resets the scratch arena (invalidating the previous result) first.
  *
  * @param input Command string
  * @return CommandResult from execution
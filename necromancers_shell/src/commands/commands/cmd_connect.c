@@ -11,10 +11,10 @@
 #include "../../game/game_globals.h"
 #include "../../game/world/territory.h"
 #include "../../game/world/location.h"
+#include "../../utils/rng.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 
 CommandResult cmd_connect(ParsedCommand* cmd) {
     if (!g_game_state || !g_game_state->territory) {
@@ -87,8 +87,7 @@ CommandResult cmd_connect(ParsedCommand* cmd) {
     }
 
     /* Advance time (1-3 hours based on random) */
-    srand((unsigned int)time(NULL));
-    uint32_t travel_time = 1 + (rand() % 3); /* 1-3 hours */
+    uint32_t travel_time = 1 + rng_range(rng_stream(RNG_STREAM_WORLD), 3); /* 1-3 hours */
     game_state_advance_time(g_game_state, travel_time);
 
     /* Build output string */
@@ -9,6 +9,7 @@
 #include "../../game/combat/combat.h"
 #include "../../game/combat/combatant.h"
 #include "../../game/combat/damage.h"
+#include "../../utils/rng.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -91,8 +92,8 @@ CommandResult cmd_flee(ParsedCommand* cmd) {
     int flee_percent = (int)(flee_chance * 100.0f);
 
     /* Roll for success */
-    float roll = (float)rand() / (float)RAND_MAX;
-    bool success = (roll < flee_chance);
+    Rng* rng = rng_stream(RNG_STREAM_COMBAT);
+    bool success = rng_double(rng) < flee_chance;
 
     char msg[2048];  /* Increased buffer for multiple attack messages */
     size_t offset = 0;
@@ -149,7 +150,7 @@ CommandResult cmd_flee(ParsedCommand* cmd) {
             }
 
             /* Pick random target */
-            Combatant* target = living_allies[rand() % living_count];
+            Combatant* target = living_allies[rng_range(rng, living_count)];
 
             /* Attack */
             AttackResult result = damage_calculate_attack(enemy, target, DAMAGE_TYPE_PHYSICAL);
@@ -10,6 +10,7 @@
 #include "../../game/game_state.h"
 #include "../../game/game_globals.h"
 #include "../../game/souls/soul_manager.h"
+#include "../../game/souls/soul_harvest.h"
 #include "../../game/world/location.h"
 #include "../../game/resources/resources.h"
 #include "../../game/resources/corruption.h"
@@ -18,48 +19,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
-#include <time.h>
 
-/**
- * Determine soul type based on location type and randomness
- */
-static SoulType determine_soul_type_from_location(LocationType loc_type) {
-    int rand_val = rand() % 100;
-
-    switch (loc_type) {
-        case LOCATION_TYPE_GRAVEYARD:
-            /* Mostly common, some innocent */
-            if (rand_val < 70) return SOUL_TYPE_COMMON;
-            else if (rand_val < 90) return SOUL_TYPE_INNOCENT;
-            else return SOUL_TYPE_ANCIENT;
-
-        case LOCATION_TYPE_BATTLEFIELD:
-            /* Mostly warriors, some corrupted */
-            if (rand_val < 60) return SOUL_TYPE_WARRIOR;
-            else if (rand_val < 85) return SOUL_TYPE_COMMON;
-            else return SOUL_TYPE_CORRUPTED;
-
-        case LOCATION_TYPE_VILLAGE:
-            /* Mostly innocent */
-            if (rand_val < 80) return SOUL_TYPE_INNOCENT;
-            else return SOUL_TYPE_COMMON;
-
-        case LOCATION_TYPE_CRYPT:
-            /* Ancient and mage souls */
-            if (rand_val < 40) return SOUL_TYPE_ANCIENT;
-            else if (rand_val < 70) return SOUL_TYPE_MAGE;
-            else return SOUL_TYPE_WARRIOR;
-
-        case LOCATION_TYPE_RITUAL_SITE:
-            /* Corrupted and mage souls */
-            if (rand_val < 50) return SOUL_TYPE_CORRUPTED;
-            else if (rand_val < 80) return SOUL_TYPE_MAGE;
-            else return SOUL_TYPE_ANCIENT;
-
-        default:
-            return SOUL_TYPE_COMMON;
-    }
-}
+/* Most corpses a single harvest command processes */
+#define MAX_HARVEST_COUNT 100
 
 CommandResult cmd_harvest(ParsedCommand* cmd) {
     if (!g_game_state) {
@@ -97,8 +59,8 @@ CommandResult cmd_harvest(ParsedCommand* cmd) {
                 return command_result_error(EXEC_ERROR_INVALID_COMMAND,
                                              "Count must be positive");
             }
-            if (count > 100) {
-                count = 100; /* Cap at 100 */
+            if (count > MAX_HARVEST_COUNT) {
+                count = MAX_HARVEST_COUNT;
             }
         }
     }
@@ -110,45 +72,41 @@ CommandResult cmd_harvest(ParsedCommand* cmd) {
         return command_result_error(EXEC_ERROR_COMMAND_FAILED, error_msg);
     }
 
-    /* Seed random number generator */
-    srand((unsigned int)time(NULL));
-
     /* Harvest corpses */
     uint32_t harvested = location_harvest_corpses(loc, (uint32_t)count);
 
-    /* Create souls and track statistics */
+    /* Roll every soul up front, then create and store them as one batch */
+    SoulType types[MAX_HARVEST_COUNT];
+    SoulQuality qualities[MAX_HARVEST_COUNT];
+    Soul* souls[MAX_HARVEST_COUNT];
+    size_t rolled = soul_harvest_roll(&g_game_state->harvest_table, loc->type,
+                                      loc->soul_quality_avg, rng_stream(RNG_STREAM_HARVEST),
+                                      harvested, types, qualities);
+
+    size_t added = 0;
+    if (rolled > 0 && soul_create_batch(types, qualities, rolled, souls)) {
+        for (size_t i = 0; i < rolled; i++) {
+            souls[i]->id = game_state_next_soul_id(g_game_state);
+        }
+        added = soul_manager_add_batch(g_game_state->souls, souls, rolled);
+        for (size_t i = added; i < rolled; i++) {
+            soul_destroy(souls[i]);
+        }
+    }
+
+    /* Track statistics */
     uint64_t total_energy = 0;
     uint32_t type_counts[SOUL_TYPE_COUNT] = {0};
     uint32_t corruption_gain = 0;
 
-    for (uint32_t i = 0; i < harvested; i++) {
-        /* Determine soul type based on location */
-        SoulType type = determine_soul_type_from_location(loc->type);
-
-        /* Quality varies around location average (±20) */
-        int quality_variance = (rand() % 41) - 20; /* -20 to +20 */
-        int quality = (int)loc->soul_quality_avg + quality_variance;
-        if (quality < 0) quality = 0;
-        if (quality > 100) quality = 100;
-
-        /* Create soul */
-        Soul* soul = soul_create(type, (uint8_t)quality);
-        if (!soul) {
-            continue; /* Skip on allocation failure */
-        }
-
-        soul->id = game_state_next_soul_id(g_game_state);
-        soul_manager_add(g_game_state->souls, soul);
-
+    for (size_t i = 0; i < added; i++) {
         /* Add energy to resources */
-        resources_add_soul_energy(&g_game_state->resources, soul->energy);
-        total_energy += soul->energy;
-
-        /* Track statistics */
-        type_counts[type]++;
+        resources_add_soul_energy(&g_game_state->resources, souls[i]->energy);
+        total_energy += souls[i]->energy;
+        type_counts[types[i]]++;
 
         /* Add corruption for harvesting innocent souls */
-        if (type == SOUL_TYPE_INNOCENT) {
+        if (types[i] == SOUL_TYPE_INNOCENT) {
             corruption_gain += 5;
         }
         /* Minor corruption for other souls */
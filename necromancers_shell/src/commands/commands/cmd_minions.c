@@ -15,6 +15,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/**
+ * Order minions by ID; removal swaps the last minion into the gap,
+ * so manager order alone would reshuffle the list
+ */
+static int compare_minion_ids(const void* a, const void* b) {
+    const Minion* left = *(const Minion* const*)a;
+    const Minion* right = *(const Minion* const*)b;
+    return (left->id > right->id) - (left->id < right->id);
+}
+
 CommandResult cmd_minions(ParsedCommand* cmd) {
     (void)cmd; /* Unused parameter */
 
@@ -25,10 +35,24 @@ CommandResult cmd_minions(ParsedCommand* cmd) {
 
     size_t count = minion_manager_count(g_game_state->minions);
 
+    Minion** sorted = NULL;
+    if (count > 0) {
+        sorted = malloc(count * sizeof(Minion*));
+        if (!sorted) {
+            return command_result_error(EXEC_ERROR_INTERNAL,
+                                         "Failed to allocate minion list");
+        }
+        for (size_t i = 0; i < count; i++) {
+            sorted[i] = minion_manager_get_at(g_game_state->minions, i);
+        }
+        qsort(sorted, count, sizeof(Minion*), compare_minion_ids);
+    }
+
     char* output = NULL;
     size_t output_size = 0;
     FILE* stream = open_memstream(&output, &output_size);
     if (!stream) {
+        free(sorted);
         return command_result_error(EXEC_ERROR_INTERNAL,
                                      "Failed to allocate output buffer");
     }
@@ -48,8 +72,7 @@ CommandResult cmd_minions(ParsedCommand* cmd) {
                 "------", "-------", "------");
 
         for (size_t i = 0; i < count; i++) {
-            Minion* minion = minion_manager_get_at(g_game_state->minions, i);
-            if (!minion) continue;
+            Minion* minion = sorted[i];
 
             char hp_str[16];
             snprintf(hp_str, sizeof(hp_str), "%u/%u",
@@ -86,6 +109,7 @@ CommandResult cmd_minions(ParsedCommand* cmd) {
     }
 
     fclose(stream);
+    free(sorted);
 
     CommandResult result = command_result_success(output);
     free(output);
@@ -60,12 +60,9 @@ CommandResult cmd_probe(ParsedCommand* cmd) {
         return command_result_error(EXEC_ERROR_COMMAND_FAILED, error_msg);
     }
 
-    /* Discover location if undiscovered */
-    bool newly_discovered = false;
-    if (!target->discovered) {
-        location_discover(target, g_game_state->resources.time_hours);
-        newly_discovered = true;
-    }
+    /* Discover location if undiscovered (through the manager so map views refresh) */
+    bool newly_discovered = territory_manager_discover_location(
+        g_game_state->territory, target->id, g_game_state->resources.time_hours);
 
     /* Build output string */
     char* output = NULL;
@@ -59,6 +59,16 @@ static bool parse_sort_criteria(const char* str, SoulSortCriteria* criteria) {
     return true;
 }
 
+/**
+ * Order souls by ID; removal swaps the last soul into the gap,
+ * so manager order alone would reshuffle the inventory
+ */
+static int compare_soul_ids(const void* a, const void* b) {
+    const Soul* left = *(const Soul* const*)a;
+    const Soul* right = *(const Soul* const*)b;
+    return (left->id > right->id) - (left->id < right->id);
+}
+
 CommandResult cmd_souls(ParsedCommand* cmd) {
     if (!g_game_state || !g_game_state->souls) {
         return command_result_error(EXEC_ERROR_INTERNAL,
@@ -144,6 +154,9 @@ CommandResult cmd_souls(ParsedCommand* cmd) {
     Soul** results = NULL;
     size_t count = 0;
     results = soul_manager_get_filtered(g_game_state->souls, &filter, &count);
+    if (!should_sort && results) {
+        qsort(results, count, sizeof(Soul*), compare_soul_ids);
+    }
 
     /* Build output string using dynamic buffer */
     char* output = NULL;
@@ -12,6 +12,7 @@
 #include "../../game/world/location.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <inttypes.h>
 #include <time.h>
 #include <sys/time.h>
 
@@ -130,8 +131,8 @@ CommandResult cmd_status(ParsedCommand* cmd) {
     fprintf(stream, "\n=== Soul Collection ===\n");
     if (g_game_state && g_game_state->souls) {
         size_t soul_count = soul_manager_count(g_game_state->souls);
-        uint32_t total_energy = soul_manager_total_energy(g_game_state->souls);
-        fprintf(stream, "Total Souls: %zu (energy: %u)\n", soul_count, total_energy);
+        uint64_t total_energy = soul_manager_total_energy(g_game_state->souls);
+        fprintf(stream, "Total Souls: %zu (energy: %" PRIu64 ")\n", soul_count, total_energy);
 
         /* Count by type */
         if (soul_count > 0 && verbose && g_game_state && g_game_state->souls) {
@@ -5,6 +5,23 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Scratch arena for result strings (owned by the command system) */
+static Arena* g_result_arena = NULL;
+
+/* Helper: copy result string into the scratch arena or heap */
+static char* result_strdup(const char* str) {
+    if (!str) return NULL;
+    return g_result_arena ? arena_strdup(g_result_arena, str) : strdup(str);
+}
+
+void command_result_set_arena(Arena* arena) {
+    g_result_arena = arena;
+}
+
+Arena* command_result_get_arena(void) {
+    return g_result_arena;
+}
+
 CommandResult execute_command(ParsedCommand* cmd) {
     if (!cmd || !cmd->info || !cmd->info->function) {
         return command_result_error(EXEC_ERROR_INVALID_COMMAND,
@@ -21,10 +38,11 @@ CommandResult command_result_success(const char* output) {
     CommandResult result;
     result.status = EXEC_SUCCESS;
     result.success = true;
-    result.output = output ? strdup(output) : NULL;
+    result.output = result_strdup(output);
     result.error_message = NULL;
     result.exit_code = 0;
     result.should_exit = false;
+    result.arena = g_result_arena;
 
     return result;
 }
@@ -34,9 +52,10 @@ CommandResult command_result_error(ExecutionStatus status, const char* error_mes
     result.status = status;
     result.success = false;
     result.output = NULL;
-    result.error_message = error_message ? strdup(error_message) : NULL;
+    result.error_message = result_strdup(error_message);
     result.exit_code = (int)status;
     result.should_exit = false;
+    result.arena = g_result_arena;
 
     return result;
 }
@@ -45,10 +64,11 @@ CommandResult command_result_exit(const char* output) {
     CommandResult result;
     result.status = EXEC_SUCCESS;
     result.success = true;
-    result.output = output ? strdup(output) : NULL;
+    result.output = result_strdup(output);
     result.error_message = NULL;
     result.exit_code = 0;
     result.should_exit = true;
+    result.arena = g_result_arena;
 
     return result;
 }
@@ -56,8 +76,10 @@ CommandResult command_result_exit(const char* output) {
 void command_result_destroy(CommandResult* result) {
     if (!result) return;
 
-    free(result->output);
-    free(result->error_message);
+    if (!result->arena) {
+        free(result->output);
+        free(result->error_message);
+    }
 
     result->output = NULL;
     result->error_message = NULL;
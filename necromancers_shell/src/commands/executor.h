@@ -20,6 +20,10 @@
  *       printf("%s\n", result.output);
  *   }
  *   command_result_destroy(&result);
+ *
+ * While a scratch arena is installed with command_result_set_arena(), the
+ * command_result_* constructors copy their strings into that arena instead
+ * of the heap; such results stay valid until the arena is reset.
  */
 
 /* Command execution result codes */
@@ -40,6 +44,7 @@ typedef struct CommandResult {
     char* error_message;      /* Error message (may be NULL) */
     int exit_code;            /* Exit code (0 = success) */
     bool should_exit;         /* Whether game should exit */
+    Arena* arena;             /* Arena owning the strings (NULL = heap) */
 } CommandResult;
 
 /**
@@ -77,11 +82,26 @@ CommandResult command_result_exit(const char* output);
 
 /**
  * Destroy command result (free allocated memory)
+ * Arena-backed results are only cleared; the arena reclaims the strings.
  *
  * @param result Result to destroy
  */
 void command_result_destroy(CommandResult* result);
 
+/**
+ * Install scratch arena for command result strings
+ *
+ * @param arena Arena to allocate from (NULL = heap)
+ */
+void command_result_set_arena(Arena* arena);
+
+/**
+ * Get currently installed scratch arena
+ *
+ * @return Arena or NULL if results are heap allocated
+ */
+Arena* command_result_get_arena(void);
+
 /**
  * Get human-readable status message
  *
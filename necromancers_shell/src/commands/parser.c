@@ -2,7 +2,6 @@
 #define _POSIX_C_SOURCE 200809L
 
 #include "parser.h"
-#include "../utils/hash_table.h"
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
@@ -49,19 +48,39 @@ static const FlagDefinition* find_flag_definition(const CommandInfo* info,
     return NULL;
 }
 
+/* Helper: allocate from arena, or heap when arena is NULL */
+static void* scratch_alloc(Arena* arena, size_t size) {
+    return arena ? arena_alloc(arena, size) : malloc(size);
+}
+
+/* Helper: duplicate string into arena, or heap when arena is NULL */
+static char* scratch_strdup(Arena* arena, const char* str) {
+    return arena ? arena_strdup(arena, str) : strdup(str);
+}
+
+/* Helper: release heap allocation (arena memory is reclaimed on reset) */
+static void scratch_free(Arena* arena, void* ptr) {
+    if (!arena) free(ptr);
+}
+
 ArgumentValue* argument_value_create(const char* str, ArgumentType type) {
+    return argument_value_create_arena(str, type, NULL);
+}
+
+ArgumentValue* argument_value_create_arena(const char* str, ArgumentType type,
+                                           Arena* arena) {
     if (!str) return NULL;
 
-    ArgumentValue* value = malloc(sizeof(ArgumentValue));
+    ArgumentValue* value = scratch_alloc(arena, sizeof(ArgumentValue));
     if (!value) return NULL;
 
     value->type = type;
 
     switch (type) {
         case ARG_TYPE_STRING:
-            value->value.str_value = strdup(str);
+            value->value.str_value = scratch_strdup(arena, str);
             if (!value->value.str_value) {
-                free(value);
+                scratch_free(arena, value);
                 return NULL;
             }
             break;
@@ -71,7 +90,7 @@ ArgumentValue* argument_value_create(const char* str, ArgumentType type) {
             errno = 0;
             long result = strtol(str, &endptr, 10);
             if (errno != 0 || *endptr != '\0' || endptr == str) {
-                free(value);
+                scratch_free(arena, value);
                 return NULL;
             }
             value->value.int_value = (int)result;
@@ -83,7 +102,7 @@ ArgumentValue* argument_value_create(const char* str, ArgumentType type) {
             errno = 0;
             float result = strtof(str, &endptr);
             if (errno != 0 || *endptr != '\0' || endptr == str) {
-                free(value);
+                scratch_free(arena, value);
                 return NULL;
             }
             value->value.float_value = result;
@@ -99,13 +118,13 @@ ArgumentValue* argument_value_create(const char* str, ArgumentType type) {
                       strcmp(str, "0") == 0) {
                 value->value.bool_value = false;
             } else {
-                free(value);
+                scratch_free(arena, value);
                 return NULL;
             }
             break;
 
         default:
-            free(value);
+            scratch_free(arena, value);
             return NULL;
     }
 
@@ -122,16 +141,40 @@ void argument_value_destroy(ArgumentValue* value) {
     free(value);
 }
 
-/* Callback for destroying ArgumentValue in hash table */
-static void destroy_argument_value_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    (void)userdata;
-    argument_value_destroy((ArgumentValue*)value);
+/* Helper: find parsed flag slot by name */
+static ParsedFlag* find_parsed_flag(const ParsedCommand* cmd, const char* name) {
+    for (size_t i = 0; i < cmd->flag_count; i++) {
+        const char* flag_name = cmd->flags[i].name;
+        if (flag_name == name || (flag_name && name && strcmp(flag_name, name) == 0)) {
+            return &cmd->flags[i];
+        }
+    }
+    return NULL;
+}
+
+/* Helper: store flag value, replacing an earlier occurrence of the same flag */
+static void set_parsed_flag(ParsedCommand* cmd, const char* name, ArgumentValue* value) {
+    ParsedFlag* flag = find_parsed_flag(cmd, name);
+    if (flag) {
+        if (!cmd->arena) argument_value_destroy(flag->value);
+        flag->value = value;
+        return;
+    }
+
+    cmd->flags[cmd->flag_count].name = name;
+    cmd->flags[cmd->flag_count].value = value;
+    cmd->flag_count++;
 }
 
 ParseResult parse_command(const Token* tokens, size_t token_count,
                          const CommandRegistry* registry,
                          ParsedCommand** output) {
+    return parse_command_arena(tokens, token_count, registry, NULL, output);
+}
+
+ParseResult parse_command_arena(const Token* tokens, size_t token_count,
+                               const CommandRegistry* registry, Arena* arena,
+                               ParsedCommand** output) {
     if (!tokens || token_count == 0 || !registry || !output) {
         return PARSE_ERROR_EMPTY_COMMAND;
     }
@@ -144,24 +187,35 @@ ParseResult parse_command(const Token* tokens, size_t token_count,
     }
 
     /* Allocate ParsedCommand */
-    ParsedCommand* cmd = malloc(sizeof(ParsedCommand));
+    ParsedCommand* cmd = scratch_alloc(arena, sizeof(ParsedCommand));
     if (!cmd) return PARSE_ERROR_MEMORY;
 
-    cmd->command_name = strdup(cmd_name);
+    cmd->arena = arena;
+    cmd->command_name = scratch_strdup(arena, cmd_name);
     cmd->info = info;
-    cmd->flags = hash_table_create(16);
+    cmd->flags = NULL;
+    cmd->flag_count = 0;
     cmd->args = NULL;
     cmd->arg_count = 0;
     cmd->raw_input = NULL;
 
-    if (!cmd->command_name || !cmd->flags) {
+    if (!cmd->command_name) {
         parsed_command_destroy(cmd);
         return PARSE_ERROR_MEMORY;
     }
 
+    /* Each defined flag is stored at most once */
+    if (info->flag_count > 0) {
+        cmd->flags = scratch_alloc(arena, info->flag_count * sizeof(ParsedFlag));
+        if (!cmd->flags) {
+            parsed_command_destroy(cmd);
+            return PARSE_ERROR_MEMORY;
+        }
+    }
+
     /* Allocate temporary args array (max size) */
     size_t args_capacity = token_count;
-    cmd->args = malloc(args_capacity * sizeof(char*));
+    cmd->args = scratch_alloc(arena, args_capacity * sizeof(char*));
     if (!cmd->args) {
         parsed_command_destroy(cmd);
         return PARSE_ERROR_MEMORY;
@@ -188,14 +242,14 @@ ParseResult parse_command(const Token* tokens, size_t token_count,
 
             /* Boolean flags don't require a value */
             if (flag_def->type == ARG_TYPE_BOOL) {
-                ArgumentValue* value = malloc(sizeof(ArgumentValue));
+                ArgumentValue* value = scratch_alloc(arena, sizeof(ArgumentValue));
                 if (!value) {
                     parsed_command_destroy(cmd);
                     return PARSE_ERROR_MEMORY;
                 }
                 value->type = ARG_TYPE_BOOL;
                 value->value.bool_value = true;
-                hash_table_put(cmd->flags, flag_def->name, value);
+                set_parsed_flag(cmd, flag_def->name, value);
                 continue;
             }
 
@@ -207,16 +261,16 @@ ParseResult parse_command(const Token* tokens, size_t token_count,
             }
 
             const char* flag_value = tokens[i].value;
-            ArgumentValue* value = argument_value_create(flag_value, flag_def->type);
+            ArgumentValue* value = argument_value_create_arena(flag_value, flag_def->type, arena);
             if (!value) {
                 parsed_command_destroy(cmd);
                 return PARSE_ERROR_INVALID_FLAG_VALUE;
             }
 
-            hash_table_put(cmd->flags, flag_def->name, value);
+            set_parsed_flag(cmd, flag_def->name, value);
         } else {
             /* Positional argument */
-            cmd->args[cmd->arg_count] = strdup(token);
+            cmd->args[cmd->arg_count] = scratch_strdup(arena, token);
             if (!cmd->args[cmd->arg_count]) {
                 parsed_command_destroy(cmd);
                 return PARSE_ERROR_MEMORY;
@@ -239,7 +293,7 @@ ParseResult parse_command(const Token* tokens, size_t token_count,
     /* Validate required flags */
     for (size_t i = 0; i < info->flag_count; i++) {
         if (info->flags[i].required) {
-            if (!hash_table_contains(cmd->flags, info->flags[i].name)) {
+            if (!find_parsed_flag(cmd, info->flags[i].name)) {
                 parsed_command_destroy(cmd);
                 return PARSE_ERROR_REQUIRED_FLAG_MISSING;
             }
@@ -253,6 +307,13 @@ ParseResult parse_command(const Token* tokens, size_t token_count,
 ParseResult parse_command_string(const char* input,
                                 const CommandRegistry* registry,
                                 ParsedCommand** output) {
+    return parse_command_string_arena(input, registry, NULL, output);
+}
+
+ParseResult parse_command_string_arena(const char* input,
+                                      const CommandRegistry* registry,
+                                      Arena* arena,
+                                      ParsedCommand** output) {
     if (!input || !registry || !output) {
         return PARSE_ERROR_EMPTY_COMMAND;
     }
@@ -260,38 +321,43 @@ ParseResult parse_command_string(const char* input,
     /* Tokenize input */
     Token* tokens = NULL;
     size_t token_count = 0;
-    TokenizeResult tok_result = tokenize(input, &tokens, &token_count);
+    TokenizeResult tok_result = tokenize_arena(input, arena, &tokens, &token_count);
 
     if (tok_result != TOKENIZE_SUCCESS) {
         return PARSE_ERROR_EMPTY_COMMAND;
     }
 
     if (token_count == 0) {
-        free_tokens(tokens, token_count);
+        if (!arena) free_tokens(tokens, token_count);
         return PARSE_ERROR_EMPTY_COMMAND;
     }
 
     /* Parse command */
-    ParseResult result = parse_command(tokens, token_count, registry, output);
+    ParseResult result = parse_command_arena(tokens, token_count, registry, arena, output);
 
     /* Store raw input if successful */
     if (result == PARSE_SUCCESS && *output) {
-        (*output)->raw_input = strdup(input);
+        (*output)->raw_input = scratch_strdup(arena, input);
     }
 
-    free_tokens(tokens, token_count);
+    if (!arena) free_tokens(tokens, token_count);
     return result;
 }
 
 void parsed_command_destroy(ParsedCommand* cmd) {
     if (!cmd) return;
 
+    /* Arena-backed commands are reclaimed by arena_reset() */
+    if (cmd->arena) return;
+
     free((void*)cmd->command_name);
     free(cmd->raw_input);
 
     if (cmd->flags) {
-        hash_table_foreach(cmd->flags, destroy_argument_value_callback, NULL);
-        hash_table_destroy(cmd->flags);
+        for (size_t i = 0; i < cmd->flag_count; i++) {
+            argument_value_destroy(cmd->flags[i].value);
+        }
+        free(cmd->flags);
     }
 
     if (cmd->args) {
@@ -307,12 +373,13 @@ void parsed_command_destroy(ParsedCommand* cmd) {
 const ArgumentValue* parsed_command_get_flag(const ParsedCommand* cmd,
                                              const char* flag_name) {
     if (!cmd || !flag_name) return NULL;
-    return (const ArgumentValue*)hash_table_get(cmd->flags, flag_name);
+    const ParsedFlag* flag = find_parsed_flag(cmd, flag_name);
+    return flag ? flag->value : NULL;
 }
 
 bool parsed_command_has_flag(const ParsedCommand* cmd, const char* flag_name) {
     if (!cmd || !flag_name) return false;
-    return hash_table_contains(cmd->flags, flag_name);
+    return find_parsed_flag(cmd, flag_name) != NULL;
 }
 
 const char* parsed_command_get_arg(const ParsedCommand* cmd, size_t index) {
@@ -23,11 +23,12 @@
  *       // Use command...
  *       parsed_command_destroy(cmd);
  *   }
+ *
+ * The *_arena variants allocate the command, its arguments and flag values
+ * from a scratch Arena. parsed_command_destroy() is then a no-op and the
+ * memory is reclaimed by arena_reset().
  */
 
-/* Forward declaration */
-typedef struct HashTable HashTable;
-
 /* Parsed argument value (variant type) */
 typedef struct {
     ArgumentType type;
@@ -39,14 +40,22 @@ typedef struct {
     } value;
 } ArgumentValue;
 
+/* Parsed flag (name points at the FlagDefinition's name) */
+typedef struct {
+    const char* name;
+    ArgumentValue* value;
+} ParsedFlag;
+
 /* Parsed command structure */
 typedef struct ParsedCommand {
     const char* command_name;    /* Command name */
     const CommandInfo* info;     /* Command info from registry */
-    HashTable* flags;            /* Flag name -> ArgumentValue* */
+    ParsedFlag* flags;           /* Flags present (at most info->flag_count) */
+    size_t flag_count;           /* Number of flags present */
     char** args;                 /* Positional arguments array */
     size_t arg_count;            /* Number of positional arguments */
     char* raw_input;             /* Original input string */
+    Arena* arena;                /* Owning scratch arena (NULL = heap) */
 } ParsedCommand;
 
 /* Parse result codes */
@@ -76,6 +85,20 @@ ParseResult parse_command(const Token* tokens, size_t token_count,
                          const CommandRegistry* registry,
                          ParsedCommand** output);
 
+/**
+ * Parse command from tokens into a scratch arena
+ *
+ * @param tokens Token array
+ * @param token_count Number of tokens
+ * @param registry Command registry
+ * @param arena Arena for all allocations (NULL = heap, same as parse_command)
+ * @param output Output parsed command
+ * @return ParseResult indicating success or error type
+ */
+ParseResult parse_command_arena(const Token* tokens, size_t token_count,
+                               const CommandRegistry* registry, Arena* arena,
+                               ParsedCommand** output);
+
 /**
  * Parse command from raw string (convenience function)
  *
@@ -88,8 +111,23 @@ ParseResult parse_command_string(const char* input,
                                 const CommandRegistry* registry,
                                 ParsedCommand** output);
 
+/**
+ * Tokenize and parse a raw string into a scratch arena
+ *
+ * @param input Input string
+ * @param registry Command registry
+ * @param arena Arena for all allocations (NULL = heap)
+ * @param output Output parsed command
+ * @return ParseResult indicating success or error type
+ */
+ParseResult parse_command_string_arena(const char* input,
+                                      const CommandRegistry* registry,
+                                      Arena* arena,
+                                      ParsedCommand** output);
+
 /**
  * Destroy parsed command
+ * No-op for commands parsed into an arena.
  *
  * @param cmd Parsed command to destroy
  */
@@ -140,6 +178,17 @@ const char* parse_error_string(ParseResult result);
  */
 ArgumentValue* argument_value_create(const char* str, ArgumentType type);
 
+/**
+ * Create ArgumentValue in a scratch arena
+ *
+ * @param str String to parse
+ * @param type Target type
+ * @param arena Arena to allocate from (NULL = heap)
+ * @return ArgumentValue pointer or NULL on error
+ */
+ArgumentValue* argument_value_create_arena(const char* str, ArgumentType type,
+                                           Arena* arena);
+
 /**
  * Destroy ArgumentValue
  *
@@ -1,6 +1,3 @@
-/* POSIX features (strdup) */
-#define _POSIX_C_SOURCE 200809L
-
 #include "tokenizer.h"
 #include <stdlib.h>
 #include <string.h>
@@ -16,62 +13,15 @@ typedef enum {
     STATE_ESCAPE_IN_DOUBLE_QUOTE
 } TokenizerState;
 
-/* Dynamic string builder for token construction */
+/* Token output state shared by heap and arena tokenization */
 typedef struct {
-    char* buffer;
-    size_t length;
-    size_t capacity;
-} StringBuilder;
-
-/* Initialize string builder */
-static StringBuilder* sb_create(void) {
-    StringBuilder* sb = malloc(sizeof(StringBuilder));
-    if (!sb) return NULL;
-
-    sb->capacity = 32;
-    sb->buffer = malloc(sb->capacity);
-    if (!sb->buffer) {
-        free(sb);
-        return NULL;
-    }
-
-    sb->buffer[0] = '\0';
-    sb->length = 0;
-    return sb;
-}
-
-/* Append character to string builder */
-static bool sb_append(StringBuilder* sb, char c) {
-    if (sb->length + 2 > sb->capacity) {
-        size_t new_capacity = sb->capacity * 2;
-        char* new_buffer = realloc(sb->buffer, new_capacity);
-        if (!new_buffer) return false;
-
-        sb->buffer = new_buffer;
-        sb->capacity = new_capacity;
-    }
-
-    sb->buffer[sb->length++] = c;
-    sb->buffer[sb->length] = '\0';
-    return true;
-}
-
-/* Free string builder (returns buffer ownership to caller) */
-/* Note: Currently unused but may be needed for future optimizations */
-__attribute__((unused))
-static char* sb_finalize(StringBuilder* sb) {
-    char* result = sb->buffer;
-    free(sb);
-    return result;
-}
-
-/* Destroy string builder and its buffer */
-static void sb_destroy(StringBuilder* sb) {
-    if (sb) {
-        free(sb->buffer);
-        free(sb);
-    }
-}
+    Arena* arena;      /* NULL = heap (tokens strdup'd individually) */
+    char* buffer;      /* Token characters, tokens written back to back */
+    size_t pos;        /* Next write position in buffer */
+    size_t start;      /* Start of the token being built */
+    Token* tokens;
+    size_t count;
+} TokenizerOutput;
 
 /* Process escape sequence and return the actual character */
 static char process_escape(char c) {
@@ -87,56 +37,90 @@ static char process_escape(char c) {
     }
 }
 
-/* Dynamic token array growth */
-static bool add_token(Token** tokens, size_t* count, size_t* capacity,
-                     const char* value, size_t length, bool is_quoted) {
-    if (*count >= *capacity) {
-        size_t new_capacity = (*capacity == 0) ? 4 : (*capacity * 2);
-        Token* new_tokens = realloc(*tokens, new_capacity * sizeof(Token));
-        if (!new_tokens) return false;
-
-        *tokens = new_tokens;
-        *capacity = new_capacity;
+/* Finish the token being built and append it to the token array */
+static bool emit_token(TokenizerOutput* out, bool is_quoted) {
+    size_t length = out->pos - out->start;
+    out->buffer[out->pos++] = '\0';
+
+    Token* token = &out->tokens[out->count];
+    if (out->arena) {
+        token->value = out->buffer + out->start;
+    } else {
+        token->value = malloc(length + 1);
+        if (!token->value) return false;
+        memcpy(token->value, out->buffer + out->start, length + 1);
+        /* Heap tokens reuse the build buffer */
+        out->pos = 0;
     }
 
-    Token* token = &(*tokens)[*count];
-    token->value = strdup(value);
-    if (!token->value) return false;
-
     token->length = length;
     token->is_quoted = is_quoted;
-    (*count)++;
+    out->count++;
+    out->start = out->pos;
 
     return true;
 }
 
+/* Release partially built output on error */
+static void discard_output(TokenizerOutput* out) {
+    if (out->arena) return;
+
+    free_tokens(out->tokens, out->count);
+    free(out->buffer);
+}
+
 TokenizeResult tokenize(const char* input, Token** tokens, size_t* count) {
+    return tokenize_arena(input, NULL, tokens, count);
+}
+
+TokenizeResult tokenize_arena(const char* input, Arena* arena,
+                              Token** tokens, size_t* count) {
     if (!input || !tokens || !count) {
         return TOKENIZE_ERROR_EMPTY_INPUT;
     }
 
     /* Skip leading whitespace to check for empty input */
     const char* p = input;
-    while (*p && isspace(*p)) p++;
+    while (*p && isspace((unsigned char)*p)) p++;
     if (*p == '\0') {
         *tokens = NULL;
         *count = 0;
         return TOKENIZE_SUCCESS;
     }
 
-    TokenizerState state = STATE_INITIAL;
-    StringBuilder* sb = sb_create();
-    if (!sb) return TOKENIZE_ERROR_MEMORY;
+    /*
+     * Every token consumes at least one input character plus a separator,
+     * so the token count and the token bytes (with terminators) are bounded
+     * by the input length. Size both once instead of growing per character.
+     */
+    size_t input_len = strlen(input);
+    size_t max_tokens = input_len / 2 + 2;
+    size_t buffer_size = input_len * 2 + 2;
+
+    TokenizerOutput out = { .arena = arena };
+    if (arena) {
+        out.tokens = arena_alloc(arena, max_tokens * sizeof(Token));
+        out.buffer = arena_alloc(arena, buffer_size);
+    } else {
+        out.tokens = malloc(max_tokens * sizeof(Token));
+        out.buffer = malloc(input_len + 1);
+    }
+    if (!out.tokens || !out.buffer) {
+        if (!arena) {
+            free(out.tokens);
+            free(out.buffer);
+        }
+        return TOKENIZE_ERROR_MEMORY;
+    }
 
-    *tokens = NULL;
-    *count = 0;
-    size_t capacity = 0;
+    TokenizerState state = STATE_INITIAL;
     bool is_quoted = false;
+    TokenizeResult result = TOKENIZE_SUCCESS;
 
     for (const char* c = input; *c != '\0'; c++) {
         switch (state) {
             case STATE_INITIAL:
-                if (isspace(*c)) {
+                if (isspace((unsigned char)*c)) {
                     /* Skip whitespace */
                     continue;
                 } else if (*c == '"') {
@@ -149,29 +133,18 @@ TokenizeResult tokenize(const char* input, Token** tokens, size_t* count) {
                     state = STATE_ESCAPE;
                     is_quoted = false;
                 } else {
-                    if (!sb_append(sb, *c)) {
-                        sb_destroy(sb);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
+                    out.buffer[out.pos++] = *c;
                     state = STATE_IN_TOKEN;
                     is_quoted = false;
                 }
                 break;
 
             case STATE_IN_TOKEN:
-                if (isspace(*c)) {
+                if (isspace((unsigned char)*c)) {
                     /* End of token */
-                    if (!add_token(tokens, count, &capacity,
-                                 sb->buffer, sb->length, is_quoted)) {
-                        sb_destroy(sb);
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
-                    sb_destroy(sb);
-                    sb = sb_create();
-                    if (!sb) {
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
+                    if (!emit_token(&out, is_quoted)) {
+                        result = TOKENIZE_ERROR_MEMORY;
+                        goto done;
                     }
                     state = STATE_INITIAL;
                 } else if (*c == '"') {
@@ -183,11 +156,7 @@ TokenizeResult tokenize(const char* input, Token** tokens, size_t* count) {
                 } else if (*c == '\\') {
                     state = STATE_ESCAPE;
                 } else {
-                    if (!sb_append(sb, *c)) {
-                        sb_destroy(sb);
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
+                    out.buffer[out.pos++] = *c;
                 }
                 break;
 
@@ -196,11 +165,7 @@ TokenizeResult tokenize(const char* input, Token** tokens, size_t* count) {
                     state = STATE_IN_TOKEN;
                 } else {
                     /* Single quotes: no escape processing */
-                    if (!sb_append(sb, *c)) {
-                        sb_destroy(sb);
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
+                    out.buffer[out.pos++] = *c;
                 }
                 break;
 
@@ -210,64 +175,55 @@ TokenizeResult tokenize(const char* input, Token** tokens, size_t* count) {
                 } else if (*c == '\\') {
                     state = STATE_ESCAPE_IN_DOUBLE_QUOTE;
                 } else {
-                    if (!sb_append(sb, *c)) {
-                        sb_destroy(sb);
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
+                    out.buffer[out.pos++] = *c;
                 }
                 break;
 
             case STATE_ESCAPE:
-                {
-                    char escaped = process_escape(*c);
-                    if (!sb_append(sb, escaped)) {
-                        sb_destroy(sb);
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
-                    state = STATE_IN_TOKEN;
-                }
+                out.buffer[out.pos++] = process_escape(*c);
+                state = STATE_IN_TOKEN;
                 break;
 
             case STATE_ESCAPE_IN_DOUBLE_QUOTE:
-                {
-                    char escaped = process_escape(*c);
-                    if (!sb_append(sb, escaped)) {
-                        sb_destroy(sb);
-                        free_tokens(*tokens, *count);
-                        return TOKENIZE_ERROR_MEMORY;
-                    }
-                    state = STATE_IN_DOUBLE_QUOTE;
-                }
+                out.buffer[out.pos++] = process_escape(*c);
+                state = STATE_IN_DOUBLE_QUOTE;
                 break;
         }
     }
 
     /* Handle final state */
     if (state == STATE_IN_SINGLE_QUOTE || state == STATE_IN_DOUBLE_QUOTE) {
-        sb_destroy(sb);
-        free_tokens(*tokens, *count);
-        return TOKENIZE_ERROR_UNCLOSED_QUOTE;
+        result = TOKENIZE_ERROR_UNCLOSED_QUOTE;
+        goto done;
     }
 
     if (state == STATE_ESCAPE || state == STATE_ESCAPE_IN_DOUBLE_QUOTE) {
-        sb_destroy(sb);
-        free_tokens(*tokens, *count);
-        return TOKENIZE_ERROR_INVALID_ESCAPE;
+        result = TOKENIZE_ERROR_INVALID_ESCAPE;
+        goto done;
     }
 
     /* Add final token if we have one */
-    if (sb->length > 0) {
-        if (!add_token(tokens, count, &capacity,
-                     sb->buffer, sb->length, is_quoted)) {
-            sb_destroy(sb);
-            free_tokens(*tokens, *count);
-            return TOKENIZE_ERROR_MEMORY;
+    if (out.pos > out.start) {
+        if (!emit_token(&out, is_quoted)) {
+            result = TOKENIZE_ERROR_MEMORY;
+            goto done;
         }
     }
 
-    sb_destroy(sb);
+done:
+    if (result != TOKENIZE_SUCCESS) {
+        discard_output(&out);
+        *tokens = NULL;
+        *count = 0;
+        return result;
+    }
+
+    if (!arena) {
+        free(out.buffer);
+    }
+
+    *tokens = out.tokens;
+    *count = out.count;
     return TOKENIZE_SUCCESS;
 }
 
@@ -1,6 +1,7 @@
 #ifndef TOKENIZER_H
 #define TOKENIZER_H
 
+#include "../core/memory.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -21,11 +22,15 @@
  *       // Use tokens...
  *       free_tokens(tokens, count);
  *   }
+ *
+ * tokenize_arena() does the same but places the token array and strings in
+ * a scratch Arena; those tokens are released by arena_reset(), not
+ * free_tokens().
  */
 
 /* Token structure - represents a single parsed token */
 typedef struct {
-    char* value;      /* Token string (dynamically allocated) */
+    char* value;      /* Token string (heap or arena allocated) */
     size_t length;    /* Length of token */
     bool is_quoted;   /* Whether token was quoted */
 } Token;
@@ -49,6 +54,18 @@ typedef enum {
  */
 TokenizeResult tokenize(const char* input, Token** tokens, size_t* count);
 
+/**
+ * Tokenize an input string into a scratch arena
+ *
+ * @param input Input string to tokenize
+ * @param arena Arena for tokens and strings (NULL = heap, same as tokenize)
+ * @param tokens Output array of tokens
+ * @param count Output number of tokens
+ * @return TokenizeResult indicating success or error type
+ */
+TokenizeResult tokenize_arena(const char* input, Arena* arena,
+                              Token** tokens, size_t* count);
+
 /**
  * Free tokens array
  *
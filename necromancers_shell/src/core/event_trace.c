@@ -0,0 +1,303 @@
+#include "core/event_trace.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_MAGIC "NSTRACE"
+#define TRACE_VERSION 1
+#define TRACE_DEFAULT_CAPACITY 65536
+#define TRACE_BUFFER_RECORDS 256
+
+_Static_assert(sizeof(EventTraceRecord) == 32, "trace records are 32 bytes on disk");
+
+/* File header, followed by capacity records */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity;
+    uint64_t recorded;            /* Records ever written; ring index is recorded % capacity */
+} TraceFileHeader;
+
+/* Recorder structure */
+struct EventTrace {
+    FILE* file;
+    uint64_t capacity;
+    uint64_t flushed;             /* Records on disk */
+    EventTraceRecord buffer[TRACE_BUFFER_RECORDS];
+    size_t buffered;
+};
+
+/* Helper: write the header with the current record count */
+static bool write_header(EventTrace* trace) {
+    TraceFileHeader header = {0};
+    memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header.version = TRACE_VERSION;
+    header.record_size = sizeof(EventTraceRecord);
+    header.capacity = trace->capacity;
+    header.recorded = trace->flushed;
+
+    return fseek(trace->file, 0, SEEK_SET) == 0 &&
+           fwrite(&header, sizeof(header), 1, trace->file) == 1;
+}
+
+EventTrace* event_trace_create(const char* path, size_t capacity) {
+    if (!path) return NULL;
+
+    EventTrace* trace = calloc(1, sizeof(EventTrace));
+    if (!trace) {
+        LOG_ERROR("Failed to allocate event trace");
+        return NULL;
+    }
+
+    trace->file = fopen(path, "wb");
+    if (!trace->file) {
+        LOG_ERROR("Failed to open event trace file: %s", path);
+        free(trace);
+        return NULL;
+    }
+
+    trace->capacity = capacity > 0 ? capacity : TRACE_DEFAULT_CAPACITY;
+    if (!write_header(trace)) {
+        LOG_ERROR("Failed to write event trace header: %s", path);
+        fclose(trace->file);
+        free(trace);
+        return NULL;
+    }
+
+    LOG_INFO("Recording events to %s (%llu records)", path,
+             (unsigned long long)trace->capacity);
+    return trace;
+}
+
+void event_trace_destroy(EventTrace* trace) {
+    if (!trace) return;
+
+    event_trace_flush(trace);
+    fclose(trace->file);
+    free(trace);
+}
+
+bool event_trace_flush(EventTrace* trace) {
+    if (!trace) return false;
+
+    /* Buffered records form at most two runs: up to the ring end, then from its start */
+    size_t written = 0;
+    while (written < trace->buffered) {
+        uint64_t index = trace->flushed % trace->capacity;
+        size_t run = trace->buffered - written;
+        if (run > trace->capacity - index) run = (size_t)(trace->capacity - index);
+
+        long offset = (long)(sizeof(TraceFileHeader) + index * sizeof(EventTraceRecord));
+        if (fseek(trace->file, offset, SEEK_SET) != 0 ||
+            fwrite(&trace->buffer[written], sizeof(EventTraceRecord), run, trace->file) != run) {
+            LOG_ERROR("Failed to write event trace");
+            trace->buffered = 0;
+            return false;
+        }
+
+        written += run;
+        trace->flushed += run;
+    }
+    trace->buffered = 0;
+
+    return write_header(trace) && fflush(trace->file) == 0;
+}
+
+void event_trace_record(EventTrace* trace, const EventTraceRecord* record) {
+    if (!trace || !record) return;
+
+    trace->buffer[trace->buffered++] = *record;
+    if (trace->buffered == TRACE_BUFFER_RECORDS) {
+        event_trace_flush(trace);
+    }
+}
+
+uint64_t event_trace_get_recorded(const EventTrace* trace) {
+    return trace ? trace->flushed + trace->buffered : 0;
+}
+
+/**
+ * Helper: stable sort by time
+ * A batch's records are written after its delivery with the batch's start
+ * time, so events published from its callbacks come first in the file
+ * but later in time. Runs of ordered records are merged bottom-up.
+ */
+static bool sort_by_time(EventTraceRecord* records, size_t count) {
+    size_t i = 1;
+    while (i < count && records[i - 1].time_ns <= records[i].time_ns) i++;
+    if (i >= count) return true;
+
+    EventTraceRecord* scratch = malloc(count * sizeof(EventTraceRecord));
+    if (!scratch) return false;
+
+    EventTraceRecord* from = records;
+    EventTraceRecord* to = scratch;
+    for (size_t width = 1; width < count; width *= 2) {
+        for (size_t lo = 0; lo < count; lo += 2 * width) {
+            size_t mid = lo + width < count ? lo + width : count;
+            size_t hi = lo + 2 * width < count ? lo + 2 * width : count;
+            size_t a = lo, b = mid, out = lo;
+            while (a < mid && b < hi) {
+                to[out++] = from[b].time_ns < from[a].time_ns ? from[b++] : from[a++];
+            }
+            while (a < mid) to[out++] = from[a++];
+            while (b < hi) to[out++] = from[b++];
+        }
+        EventTraceRecord* swap = from;
+        from = to;
+        to = swap;
+    }
+
+    if (from != records) {
+        memcpy(records, from, count * sizeof(EventTraceRecord));
+    }
+    free(scratch);
+    return true;
+}
+
+bool event_trace_load(const char* path, EventTraceRecord** records, size_t* count,
+                      uint64_t* overwritten) {
+    if (!path || !records || !count) return false;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        LOG_ERROR("Failed to open event trace file: %s", path);
+        return false;
+    }
+
+    TraceFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 ||
+        header.version != TRACE_VERSION ||
+        header.record_size != sizeof(EventTraceRecord) ||
+        header.capacity == 0) {
+        LOG_ERROR("Not an event trace file: %s", path);
+        fclose(file);
+        return false;
+    }
+
+    /* Once the ring wrapped, the oldest record sits at the write position */
+    uint64_t held = header.recorded < header.capacity ? header.recorded : header.capacity;
+    uint64_t oldest = header.recorded < header.capacity ? 0 : header.recorded % header.capacity;
+
+    EventTraceRecord* loaded = malloc((held > 0 ? held : 1) * sizeof(EventTraceRecord));
+    if (!loaded) {
+        LOG_ERROR("Failed to allocate %llu trace records", (unsigned long long)held);
+        fclose(file);
+        return false;
+    }
+
+    /* Tail of the ring first, then its head */
+    size_t first_run = (size_t)(held - oldest);
+    bool ok = fseek(file, (long)(sizeof(header) + oldest * sizeof(EventTraceRecord)), SEEK_SET) == 0 &&
+              fread(loaded, sizeof(EventTraceRecord), first_run, file) == first_run;
+    if (ok && oldest > 0) {
+        ok = fseek(file, (long)sizeof(header), SEEK_SET) == 0 &&
+             fread(loaded + first_run, sizeof(EventTraceRecord), (size_t)oldest, file) == oldest;
+    }
+    fclose(file);
+
+    if (!ok) {
+        LOG_ERROR("Event trace file is truncated: %s", path);
+        free(loaded);
+        return false;
+    }
+
+    if (!sort_by_time(loaded, (size_t)held)) {
+        LOG_ERROR("Failed to sort %llu trace records", (unsigned long long)held);
+        free(loaded);
+        return false;
+    }
+
+    *records = loaded;
+    *count = (size_t)held;
+    if (overwritten) *overwritten = header.recorded - held;
+    return true;
+}
+
+uint32_t event_trace_latency_bucket(uint64_t ns) {
+    uint64_t us = ns / 1000;
+    if (us == 0) return 0;
+
+    uint32_t bucket = 64 - (uint32_t)__builtin_clzll(us);
+    return bucket < EVENT_TRACE_BUCKETS ? bucket : EVENT_TRACE_BUCKETS - 1;
+}
+
+static int compare_by_count(const void* a, const void* b) {
+    const EventTraceTypeStats* x = a;
+    const EventTraceTypeStats* y = b;
+    if (x->count != y->count) return x->count > y->count ? -1 : 1;
+    return (int)x->type - (int)y->type;
+}
+
+size_t event_trace_summarize(const EventTraceRecord* records, size_t count,
+                             EventTraceTypeStats* stats, size_t max_stats) {
+    if (!records || !stats || max_stats == 0) return 0;
+
+    /* Slot of each type in the working array, 0 = not seen yet */
+    uint32_t* slots = calloc(UINT16_MAX + 1, sizeof(uint32_t));
+    EventTraceTypeStats* all = NULL;
+    size_t types = 0;
+    size_t capacity = 0;
+    if (!slots) return 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const EventTraceRecord* record = &records[i];
+
+        if (slots[record->type] == 0) {
+            if (types == capacity) {
+                capacity = capacity ? capacity * 2 : 16;
+                EventTraceTypeStats* grown = realloc(all, capacity * sizeof(EventTraceTypeStats));
+                if (!grown) {
+                    free(all);
+                    free(slots);
+                    return 0;
+                }
+                all = grown;
+            }
+            memset(&all[types], 0, sizeof(EventTraceTypeStats));
+            all[types].type = record->type;
+            all[types].first_ns = record->time_ns;
+            slots[record->type] = (uint32_t)++types;
+        }
+
+        EventTraceTypeStats* s = &all[slots[record->type] - 1];
+        s->count++;
+        s->last_ns = record->time_ns;
+
+        switch (record->kind) {
+            case EVENT_TRACE_PUBLISHED:
+                s->published++;
+                break;
+            case EVENT_TRACE_DISPATCHED:
+                s->dispatched++;
+                s->latency_buckets[event_trace_latency_bucket(record->latency_ns)]++;
+                s->latency_total_ns += record->latency_ns;
+                if (record->latency_ns > s->latency_max_ns) s->latency_max_ns = record->latency_ns;
+                break;
+            case EVENT_TRACE_COALESCED:
+                s->coalesced++;
+                break;
+            default:
+                break;
+        }
+
+        if (record->kind != EVENT_TRACE_COALESCED) {
+            s->delivery_total_ns += record->duration_ns / (record->batch_size ? record->batch_size : 1);
+        }
+    }
+
+    if (types > 0) {
+        qsort(all, types, sizeof(EventTraceTypeStats), compare_by_count);
+    }
+    size_t written = types < max_stats ? types : max_stats;
+    if (written > 0) {
+        memcpy(stats, all, written * sizeof(EventTraceTypeStats));
+    }
+
+    free(all);
+    free(slots);
+    return written;
+}
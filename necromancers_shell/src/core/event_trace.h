@@ -0,0 +1,143 @@
+#ifndef EVENT_TRACE_H
+#define EVENT_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Event Trace - Binary recorder for EventBus traffic
+ *
+ * Appends one fixed-size record per delivered event to a ring file: the
+ * newest `capacity` records are kept, older ones are overwritten. Records
+ * are buffered and written in batches, so tracing costs a clock read and
+ * a copy per event. Written from the dispatching thread only; queued
+ * events carry their queue time from the producer.
+ *
+ * The file is a header followed by the ring, in host byte order. Offline
+ * tools read it back with event_trace_load() and event_trace_summarize().
+ *
+ * Usage:
+ *   EventTrace* trace = event_trace_create("events.trace", 1 << 20);
+ *   event_bus_set_trace(bus, trace);
+ *   ...
+ *   event_bus_set_trace(bus, NULL);
+ *   event_trace_destroy(trace);   // flushes
+ */
+
+/* What happened to the event */
+typedef enum {
+    EVENT_TRACE_PUBLISHED = 1,    /* Delivered synchronously by publish */
+    EVENT_TRACE_DISPATCHED = 2,   /* Queued, delivered by dispatch */
+    EVENT_TRACE_COALESCED = 3     /* Queued, replaced by a later duplicate */
+} EventTraceKind;
+
+/* One event (32 bytes on disk) */
+typedef struct {
+    uint64_t time_ns;             /* Delivery start, monotonic clock */
+    uint64_t latency_ns;          /* Queue to delivery start, 0 when published */
+    uint32_t duration_ns;         /* Delivery of the event's batch (saturates) */
+    uint32_t payload_bytes;
+    uint16_t type;                /* EventType */
+    uint16_t subscribers;         /* Subscribers called (saturates) */
+    uint16_t batch_size;          /* Events delivered together */
+    uint8_t kind;                 /* EventTraceKind */
+    uint8_t reserved;
+} EventTraceRecord;
+
+/* Latency histogram: bucket 0 is < 1 us, bucket b is [2^(b-1), 2^b) us */
+#define EVENT_TRACE_BUCKETS 28
+
+/* Per-type summary of a trace */
+typedef struct {
+    uint16_t type;
+    uint64_t count;
+    uint64_t published;
+    uint64_t dispatched;
+    uint64_t coalesced;
+    uint64_t latency_buckets[EVENT_TRACE_BUCKETS];   /* Dispatched events */
+    uint64_t latency_total_ns;
+    uint64_t latency_max_ns;
+    uint64_t delivery_total_ns;   /* Each event's share of its batch */
+    uint64_t first_ns;
+    uint64_t last_ns;
+} EventTraceTypeStats;
+
+/* Opaque recorder structure */
+typedef struct EventTrace EventTrace;
+
+/**
+ * Create a trace file (truncates an existing one)
+ *
+ * @param path File path
+ * @param capacity Records kept in the ring (0 = default 65536)
+ * @return Recorder pointer or NULL on failure
+ */
+EventTrace* event_trace_create(const char* path, size_t capacity);
+
+/**
+ * Flush and close a trace
+ *
+ * @param trace Recorder (can be NULL)
+ */
+void event_trace_destroy(EventTrace* trace);
+
+/**
+ * Append a record (buffered)
+ *
+ * @param trace Recorder
+ * @param record Record to append
+ */
+void event_trace_record(EventTrace* trace, const EventTraceRecord* record);
+
+/**
+ * Write buffered records and the header to disk
+ *
+ * @param trace Recorder
+ * @return true on success
+ */
+bool event_trace_flush(EventTrace* trace);
+
+/**
+ * Get number of records appended since creation
+ *
+ * @param trace Recorder
+ * @return Record count (may exceed the ring capacity)
+ */
+uint64_t event_trace_get_recorded(const EventTrace* trace);
+
+/**
+ * Read a trace file, sorted by time (stable)
+ * The file holds records in write order, in which events published from
+ * a callback precede the dispatched batch that delivered them.
+ *
+ * @param path File path
+ * @param records Output array (caller frees)
+ * @param count Output record count
+ * @param overwritten Output count of records lost to wraparound (can be NULL)
+ * @return true on success, false if missing, truncated or not a trace
+ */
+bool event_trace_load(const char* path, EventTraceRecord** records, size_t* count,
+                      uint64_t* overwritten);
+
+/**
+ * Get the latency histogram bucket of a duration
+ *
+ * @param ns Duration in nanoseconds
+ * @return Bucket index (0 to EVENT_TRACE_BUCKETS - 1)
+ */
+uint32_t event_trace_latency_bucket(uint64_t ns);
+
+/**
+ * Replay records into per-type statistics
+ *
+ * @param records Records in time order
+ * @param count Record count
+ * @param stats Output array, most frequent type first
+ * @param max_stats Capacity of stats
+ * @return Number of types written
+ */
+size_t event_trace_summarize(const EventTraceRecord* records, size_t count,
+                             EventTraceTypeStats* stats, size_t max_stats);
+
+#endif /* EVENT_TRACE_H */
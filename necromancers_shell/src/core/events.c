@@ -1,35 +1,121 @@
 #include "core/events.h"
+#include "core/event_trace.h"
+#include "core/timing.h"
 #include "utils/logger.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
 
-/* Maximum queued events */
+/* Maximum queued events (power of two, the ring never grows) */
 #define MAX_EVENT_QUEUE 1024
 
+/* Bytes per payload frame; larger payloads than fit go to the heap */
+#define PAYLOAD_FRAME_SIZE (64 * 1024)
+
+/* Where a queued event's payload lives */
+#define PAYLOAD_INLINE -1
+#define PAYLOAD_HEAP 2
+
+/* Separates fields written by different threads */
+#define CACHE_LINE 64
+
+/* Open-addressed table used to find duplicates when coalescing */
+#define COALESCE_TABLE_SIZE (2 * MAX_EVENT_QUEUE)
+
 /* Subscription entry */
-typedef struct Subscription {
+typedef struct {
     size_t id;
-    EventType type;
-    EventCallback callback;
+    EventCallback callback;             /* One of callback, batch_callback */
+    EventBatchCallback batch_callback;
     void* userdata;
     bool active;
-    struct Subscription* next;
 } Subscription;
 
-/* Queued event entry */
+/*
+ * Subscribers of one event type, in subscription order. Unsubscribing
+ * only clears the active flag; the array is compacted when nothing is
+ * walking it, so callbacks may unsubscribe anyone at any time.
+ */
+typedef struct {
+    Subscription* items;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t dead;                      /* Inactive entries awaiting compaction */
+    uint32_t walking;                   /* Deliveries in progress */
+    bool coalesce;
+    size_t coalesce_key;                /* Leading payload bytes compared */
+} SubscriberList;
+
+/* Events of one type within a dispatch */
+typedef struct {
+    EventType type;
+    uint32_t start;
+    uint32_t count;
+    uint32_t filled;
+} EventGroup;
+
+/* Queued event entry, one ring slot */
 typedef struct QueuedEvent {
+    atomic_size_t sequence;  /* Ring position it is free for, +1 once filled */
     Event event;
-    bool data_owned;  /* true if we need to free event.data */
+    uint64_t queued_ns;      /* Queue time while tracing, else 0 */
+    int payload_frame;       /* Frame index, PAYLOAD_INLINE or PAYLOAD_HEAP */
+    union {
+        max_align_t align;
+        unsigned char bytes[EVENT_INLINE_PAYLOAD];
+    } payload;
 } QueuedEvent;
 
-/* Event bus structure */
+/*
+ * Payload frame: bump buffer for payloads too large to go inline.
+ * Producers pin the frame they copy into; the pin is dropped once the
+ * event is dispatched, and a frame is only rewound while unpinned.
+ */
+typedef struct {
+    atomic_size_t used;
+    atomic_size_t pins;
+    unsigned char* bytes;
+} PayloadFrame;
+
+/*
+ * Event bus structure
+ *
+ * The queue is a bounded multi-producer/single-consumer ring: producers
+ * claim a position with a CAS on enqueue_pos and publish the slot through
+ * its sequence number, the dispatching thread consumes in order.
+ */
 struct EventBus {
-    Subscription* subscriptions[EVENT_COUNT];  /* Subscription lists per event type */
-    QueuedEvent* event_queue;
-    size_t queue_size;
-    size_t queue_capacity;
+    SubscriberList subscribers[EVENT_COUNT];
     size_t next_subscription_id;
     size_t total_subscriptions;
+
+    /* Dispatch scratch, sized for a full ring */
+    Event* staged;                       /* Taken from the ring, queue order */
+    Event* grouped;                      /* Same events grouped by type */
+    uint64_t* staged_ns;                 /* Queue times alongside staged */
+    uint64_t* grouped_ns;                /* Queue times alongside grouped */
+    EventGroup* groups;
+    uint32_t type_stamp[EVENT_COUNT];    /* Type seen in the current dispatch */
+    uint16_t type_group[EVENT_COUNT];
+    uint32_t coalesce_stamp[COALESCE_TABLE_SIZE];
+    uint16_t coalesce_index[COALESCE_TABLE_SIZE];
+    uint32_t stamp;
+    bool dispatching;
+
+    EventTrace* trace;                   /* Recorder, NULL when off */
+    atomic_bool tracing;                 /* Tells producers to stamp queue times */
+
+    QueuedEvent* ring;
+    PayloadFrame frames[2];
+    atomic_int current_frame;            /* Frame producers copy into */
+    atomic_size_t dropped;               /* Events refused since last dispatch */
+
+    char pad0[CACHE_LINE];
+    atomic_size_t enqueue_pos;           /* Producers */
+    char pad1[CACHE_LINE];
+    atomic_size_t dequeue_pos;           /* Consumer */
+    char pad2[CACHE_LINE];
 };
 
 /* Event type names for debugging */
@@ -68,6 +154,8 @@ static const char* g_event_names[] = {
     [EVENT_DIALOGUE_CHOICE_SELECTED] = "DIALOGUE_CHOICE_SELECTED"
 };
 
+static size_t drain_queue(EventBus* bus, bool dispatch);
+
 const char* event_type_name(EventType type) {
     if (type >= 0 && type < EVENT_COUNT && type < sizeof(g_event_names) / sizeof(g_event_names[0])) {
         const char* name = g_event_names[type];
@@ -86,16 +174,44 @@ EventBus* event_bus_create(void) {
         return NULL;
     }
 
-    /* Initialize event queue */
-    bus->queue_capacity = 128;  /* Start with reasonable capacity */
-    bus->event_queue = calloc(bus->queue_capacity, sizeof(QueuedEvent));
-    if (!bus->event_queue) {
+    /* Initialize event ring, payload frames and dispatch scratch */
+    bus->ring = calloc(MAX_EVENT_QUEUE, sizeof(QueuedEvent));
+    bus->frames[0].bytes = malloc(PAYLOAD_FRAME_SIZE);
+    bus->frames[1].bytes = malloc(PAYLOAD_FRAME_SIZE);
+    bus->staged = malloc(MAX_EVENT_QUEUE * sizeof(Event));
+    bus->grouped = malloc(MAX_EVENT_QUEUE * sizeof(Event));
+    bus->groups = malloc(MAX_EVENT_QUEUE * sizeof(EventGroup));
+    bus->staged_ns = malloc(MAX_EVENT_QUEUE * sizeof(uint64_t));
+    bus->grouped_ns = malloc(MAX_EVENT_QUEUE * sizeof(uint64_t));
+    if (!bus->ring || !bus->frames[0].bytes || !bus->frames[1].bytes ||
+        !bus->staged || !bus->grouped || !bus->groups ||
+        !bus->staged_ns || !bus->grouped_ns) {
         LOG_ERROR("Failed to allocate event queue");
+        free(bus->ring);
+        free(bus->frames[0].bytes);
+        free(bus->frames[1].bytes);
+        free(bus->staged);
+        free(bus->grouped);
+        free(bus->groups);
+        free(bus->staged_ns);
+        free(bus->grouped_ns);
         free(bus);
         return NULL;
     }
 
-    bus->queue_size = 0;
+    for (size_t i = 0; i < MAX_EVENT_QUEUE; i++) {
+        atomic_init(&bus->ring[i].sequence, i);
+    }
+    for (int f = 0; f < 2; f++) {
+        atomic_init(&bus->frames[f].used, 0);
+        atomic_init(&bus->frames[f].pins, 0);
+    }
+    atomic_init(&bus->current_frame, 0);
+    atomic_init(&bus->dropped, 0);
+    atomic_init(&bus->enqueue_pos, 0);
+    atomic_init(&bus->dequeue_pos, 0);
+    atomic_init(&bus->tracing, false);
+
     bus->next_subscription_id = 1;
     bus->total_subscriptions = 0;
 
@@ -108,72 +224,97 @@ void event_bus_destroy(EventBus* bus) {
 
     /* Free all subscriptions */
     for (size_t i = 0; i < EVENT_COUNT; i++) {
-        Subscription* sub = bus->subscriptions[i];
-        while (sub) {
-            Subscription* next = sub->next;
-            free(sub);
-            sub = next;
-        }
+        free(bus->subscribers[i].items);
     }
 
     /* Free queued event data */
-    for (size_t i = 0; i < bus->queue_size; i++) {
-        if (bus->event_queue[i].data_owned) {
-            free(bus->event_queue[i].event.data);
-        }
-    }
-
-    free(bus->event_queue);
+    drain_queue(bus, false);
+
+    free(bus->staged);
+    free(bus->grouped);
+    free(bus->groups);
+    free(bus->staged_ns);
+    free(bus->grouped_ns);
+    free(bus->ring);
+    free(bus->frames[0].bytes);
+    free(bus->frames[1].bytes);
     free(bus);
 
     LOG_DEBUG("Destroyed event bus");
 }
 
-size_t event_bus_subscribe(EventBus* bus, EventType type,
-                           EventCallback callback, void* userdata) {
-    if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT || !callback) {
+/* Helper: drop inactive subscribers unless the list is being walked */
+static void compact_subscribers(SubscriberList* list) {
+    if (list->dead == 0 || list->walking > 0) return;
+
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < list->count; i++) {
+        if (list->items[i].active) {
+            list->items[kept++] = list->items[i];
+        }
+    }
+    list->count = kept;
+    list->dead = 0;
+}
+
+/* Helper: add a subscriber of either kind */
+static size_t add_subscription(EventBus* bus, EventType type, EventCallback callback,
+                               EventBatchCallback batch_callback, void* userdata) {
+    if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT || (!callback && !batch_callback)) {
         LOG_ERROR("Invalid event bus, type, or callback");
         return 0;
     }
 
-    /* Create new subscription */
-    Subscription* sub = malloc(sizeof(Subscription));
-    if (!sub) {
-        LOG_ERROR("Failed to allocate subscription");
-        return 0;
+    SubscriberList* list = &bus->subscribers[type];
+    compact_subscribers(list);
+
+    if (list->count == list->capacity) {
+        uint32_t capacity = list->capacity ? list->capacity * 2 : 4;
+        Subscription* items = realloc(list->items, capacity * sizeof(Subscription));
+        if (!items) {
+            LOG_ERROR("Failed to allocate subscription");
+            return 0;
+        }
+        list->items = items;
+        list->capacity = capacity;
     }
 
-    sub->id = bus->next_subscription_id++;
-    sub->type = type;
+    /* The ID carries the type so unsubscribing finds the list directly */
+    Subscription* sub = &list->items[list->count++];
+    sub->id = bus->next_subscription_id++ * EVENT_COUNT + (size_t)type;
     sub->callback = callback;
+    sub->batch_callback = batch_callback;
     sub->userdata = userdata;
     sub->active = true;
-
-    /* Add to list (prepend) */
-    sub->next = bus->subscriptions[type];
-    bus->subscriptions[type] = sub;
     bus->total_subscriptions++;
 
     LOG_DEBUG("Subscribed to %s (ID: %zu)", event_type_name(type), sub->id);
     return sub->id;
 }
 
+size_t event_bus_subscribe(EventBus* bus, EventType type,
+                           EventCallback callback, void* userdata) {
+    return add_subscription(bus, type, callback, NULL, userdata);
+}
+
+size_t event_bus_subscribe_batch(EventBus* bus, EventType type,
+                                 EventBatchCallback callback, void* userdata) {
+    return add_subscription(bus, type, NULL, callback, userdata);
+}
+
 bool event_bus_unsubscribe(EventBus* bus, size_t subscription_id) {
     if (!bus || subscription_id == 0) return false;
 
-    /* Search all event types for this subscription */
-    for (size_t i = 0; i < EVENT_COUNT; i++) {
-        Subscription** ptr = &bus->subscriptions[i];
-        while (*ptr) {
-            if ((*ptr)->id == subscription_id) {
-                Subscription* sub = *ptr;
-                *ptr = sub->next;
-                free(sub);
-                bus->total_subscriptions--;
-                LOG_DEBUG("Unsubscribed ID: %zu", subscription_id);
-                return true;
-            }
-            ptr = &(*ptr)->next;
+    SubscriberList* list = &bus->subscribers[subscription_id % EVENT_COUNT];
+    for (uint32_t i = 0; i < list->count; i++) {
+        Subscription* sub = &list->items[i];
+        if (sub->id == subscription_id && sub->active) {
+            sub->active = false;
+            list->dead++;
+            bus->total_subscriptions--;
+            compact_subscribers(list);
+            LOG_DEBUG("Unsubscribed ID: %zu", subscription_id);
+            return true;
         }
     }
 
@@ -184,21 +325,106 @@ bool event_bus_unsubscribe(EventBus* bus, size_t subscription_id) {
 void event_bus_unsubscribe_all(EventBus* bus, EventType type) {
     if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT) return;
 
+    SubscriberList* list = &bus->subscribers[type];
     size_t count = 0;
-    Subscription* sub = bus->subscriptions[type];
-    while (sub) {
-        Subscription* next = sub->next;
-        free(sub);
-        count++;
-        sub = next;
+    for (uint32_t i = 0; i < list->count; i++) {
+        if (list->items[i].active) {
+            list->items[i].active = false;
+            list->dead++;
+            count++;
+        }
     }
 
-    bus->subscriptions[type] = NULL;
     bus->total_subscriptions -= count;
+    compact_subscribers(list);
 
     LOG_DEBUG("Unsubscribed all (%zu) from %s", count, event_type_name(type));
 }
 
+void event_bus_set_trace(EventBus* bus, EventTrace* trace) {
+    if (!bus) return;
+
+    if (bus->trace && bus->trace != trace) {
+        event_trace_flush(bus->trace);
+    }
+    bus->trace = trace;
+    atomic_store(&bus->tracing, trace != NULL);
+}
+
+/* Helper: saturate a count into a narrower record field */
+static uint32_t clamp_u32(uint64_t value) {
+    return value > UINT32_MAX ? UINT32_MAX : (uint32_t)value;
+}
+
+static uint16_t clamp_u16(uint64_t value) {
+    return value > UINT16_MAX ? UINT16_MAX : (uint16_t)value;
+}
+
+/**
+ * Helper: record a delivered batch, one record per event
+ * Events queued before tracing started have no queue time and report no
+ * latency.
+ */
+static void trace_batch(EventBus* bus, EventTraceKind kind, const Event* events,
+                        const uint64_t* queued_ns, size_t count, size_t subscribers,
+                        uint64_t start) {
+    uint64_t end = kind == EVENT_TRACE_COALESCED ? start : timing_get_ns();
+
+    for (size_t i = 0; i < count; i++) {
+        EventTraceRecord record = {
+            .time_ns = start,
+            .latency_ns = (queued_ns[i] && queued_ns[i] < start) ? start - queued_ns[i] : 0,
+            .duration_ns = clamp_u32(end - start),
+            .payload_bytes = clamp_u32(events[i].data_size),
+            .type = (uint16_t)events[i].type,
+            .subscribers = clamp_u16(subscribers),
+            .batch_size = clamp_u16(count),
+            .kind = (uint8_t)kind
+        };
+        event_trace_record(bus->trace, &record);
+    }
+}
+
+bool event_bus_set_coalescing(EventBus* bus, EventType type, bool enabled, size_t key_size) {
+    if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT) return false;
+
+    bus->subscribers[type].coalesce = enabled;
+    bus->subscribers[type].coalesce_key = key_size;
+    return true;
+}
+
+/**
+ * Helper: hand events of one type to its subscribers
+ * Newest subscribers first, as before; those added meanwhile wait for the
+ * next delivery. Each batch subscriber gets the events in one call.
+ *
+ * @return Number of subscribers called
+ */
+static size_t deliver(EventBus* bus, EventType type, const Event* events, size_t count) {
+    SubscriberList* list = &bus->subscribers[type];
+    compact_subscribers(list);
+    list->walking++;
+
+    size_t called = 0;
+    for (uint32_t i = list->count; i-- > 0;) {
+        /* Index each time: callbacks may grow the array */
+        if (!list->items[i].active) continue;
+        called++;
+
+        if (list->items[i].batch_callback) {
+            list->items[i].batch_callback(events, count, list->items[i].userdata);
+            continue;
+        }
+        for (size_t e = 0; e < count && list->items[i].active; e++) {
+            list->items[i].callback(&events[e], list->items[i].userdata);
+        }
+    }
+
+    list->walking--;
+    compact_subscribers(list);
+    return called;
+}
+
 bool event_bus_publish(EventBus* bus, EventType type, void* data) {
     if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT) return false;
 
@@ -209,136 +435,332 @@ bool event_bus_publish(EventBus* bus, EventType type, void* data) {
     };
 
     /* Call all subscribers */
-    size_t count = 0;
-    Subscription* sub = bus->subscriptions[type];
-    while (sub) {
-        if (sub->active && sub->callback) {
-            sub->callback(&event, sub->userdata);
-            count++;
-        }
-        sub = sub->next;
+    uint64_t start = bus->trace ? timing_get_ns() : 0;
+    size_t count = deliver(bus, type, &event, 1);
+    if (bus->trace) {
+        trace_batch(bus, EVENT_TRACE_PUBLISHED, &event, &start, 1, count, start);
     }
 
     LOG_DEBUG("Published %s to %zu subscribers", event_type_name(type), count);
     return true;
 }
 
-static bool event_queue_grow(EventBus* bus) {
-    size_t new_capacity = bus->queue_capacity * 2;
-    if (new_capacity > MAX_EVENT_QUEUE) {
-        new_capacity = MAX_EVENT_QUEUE;
-    }
+/* Helper: copy a large payload into the current frame, pinning it */
+static void* frame_copy(EventBus* bus, const void* data, size_t data_size, int* frame) {
+    const size_t alignment = _Alignof(max_align_t);
+    size_t size = (data_size + alignment - 1) & ~(alignment - 1);
 
-    if (new_capacity <= bus->queue_capacity) {
-        LOG_ERROR("Event queue at maximum capacity");
-        return false;
-    }
+    for (;;) {
+        int f = atomic_load(&bus->current_frame);
+        PayloadFrame* pf = &bus->frames[f];
+        atomic_fetch_add(&pf->pins, 1);
 
-    QueuedEvent* new_queue = realloc(bus->event_queue, new_capacity * sizeof(QueuedEvent));
-    if (!new_queue) {
-        LOG_ERROR("Failed to grow event queue");
-        return false;
+        /* The consumer may have moved on between the load and the pin */
+        if (atomic_load(&bus->current_frame) != f) {
+            atomic_fetch_sub(&pf->pins, 1);
+            continue;
+        }
+
+        size_t offset = atomic_fetch_add(&pf->used, size);
+        if (offset + size > PAYLOAD_FRAME_SIZE) {
+            atomic_fetch_sub(&pf->pins, 1);
+            return NULL;
+        }
+
+        memcpy(pf->bytes + offset, data, data_size);
+        *frame = f;
+        return pf->bytes + offset;
     }
+}
 
-    bus->event_queue = new_queue;
-    bus->queue_capacity = new_capacity;
+/* Helper: release a dispatched event's payload */
+static void release_payload(EventBus* bus, QueuedEvent* qe) {
+    if (qe->payload_frame == PAYLOAD_HEAP) {
+        free(qe->event.data);
+    } else if (qe->payload_frame != PAYLOAD_INLINE) {
+        atomic_fetch_sub(&bus->frames[qe->payload_frame].pins, 1);
+    }
+}
 
-    LOG_DEBUG("Grew event queue to %zu", new_capacity);
-    return true;
+/* Helper: claim the next ring slot, NULL when full */
+static QueuedEvent* claim_slot(EventBus* bus, size_t* position) {
+    size_t pos = atomic_load_explicit(&bus->enqueue_pos, memory_order_relaxed);
+
+    for (;;) {
+        QueuedEvent* qe = &bus->ring[pos & (MAX_EVENT_QUEUE - 1)];
+        size_t seq = atomic_load_explicit(&qe->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&bus->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                *position = pos;
+                return qe;
+            }
+        } else if (diff < 0) {
+            return NULL;  /* Slot not consumed yet: ring full */
+        } else {
+            pos = atomic_load_explicit(&bus->enqueue_pos, memory_order_relaxed);
+        }
+    }
 }
 
 bool event_bus_queue(EventBus* bus, EventType type, const void* data, size_t data_size) {
     if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT) return false;
 
-    /* Grow queue if needed */
-    if (bus->queue_size >= bus->queue_capacity) {
-        if (!event_queue_grow(bus)) {
-            return false;
+    /* No logging here: producers may be on any thread */
+    bool has_data = data && data_size > 0;
+    void* stored = NULL;
+    int frame = PAYLOAD_INLINE;
+
+    /* Large payloads are placed before claiming a slot */
+    if (has_data && data_size > EVENT_INLINE_PAYLOAD) {
+        stored = frame_copy(bus, data, data_size, &frame);
+        if (!stored) {
+            stored = malloc(data_size);
+            if (!stored) {
+                atomic_fetch_add(&bus->dropped, 1);
+                return false;
+            }
+            memcpy(stored, data, data_size);
+            frame = PAYLOAD_HEAP;
         }
     }
 
-    QueuedEvent* qe = &bus->event_queue[bus->queue_size];
-    qe->event.type = type;
-    qe->event.data_size = data_size;
-    qe->data_owned = false;
-
-    /* Copy data if provided */
-    if (data && data_size > 0) {
-        qe->event.data = malloc(data_size);
-        if (!qe->event.data) {
-            LOG_ERROR("Failed to allocate event data");
-            return false;
-        }
-        memcpy(qe->event.data, data, data_size);
-        qe->data_owned = true;
-    } else {
-        qe->event.data = NULL;
+    size_t pos;
+    QueuedEvent* qe = claim_slot(bus, &pos);
+    if (!qe) {
+        QueuedEvent unused = { .event.data = stored, .payload_frame = frame };
+        release_payload(bus, &unused);
+        atomic_fetch_add(&bus->dropped, 1);
+        return false;
     }
 
-    bus->queue_size++;
+    if (has_data && frame == PAYLOAD_INLINE) {
+        memcpy(qe->payload.bytes, data, data_size);
+        stored = qe->payload.bytes;
+    }
+    qe->event.type = type;
+    qe->event.data = stored;
+    qe->event.data_size = has_data ? data_size : 0;
+    qe->payload_frame = frame;
+    qe->queued_ns = atomic_load_explicit(&bus->tracing, memory_order_relaxed) ? timing_get_ns() : 0;
 
-    LOG_DEBUG("Queued %s (queue size: %zu)", event_type_name(type), bus->queue_size);
+    /* Publish to the consumer */
+    atomic_store_explicit(&qe->sequence, pos + 1, memory_order_release);
     return true;
 }
 
-void event_bus_dispatch(EventBus* bus) {
-    if (!bus || bus->queue_size == 0) return;
+/* Helper: next stamp for the seen-markers, clearing them on wrap */
+static uint32_t next_stamp(EventBus* bus) {
+    if (++bus->stamp == 0) {
+        memset(bus->type_stamp, 0, sizeof(bus->type_stamp));
+        memset(bus->coalesce_stamp, 0, sizeof(bus->coalesce_stamp));
+        bus->stamp = 1;
+    }
+    return bus->stamp;
+}
 
-    LOG_DEBUG("Dispatching %zu queued events", bus->queue_size);
+/* Helper: payload bytes that identify an event for coalescing */
+static size_t coalesce_key_size(const Event* event, size_t key_size) {
+    if (!event->data) return 0;
+    return key_size < event->data_size ? key_size : event->data_size;
+}
 
-    /* Process all queued events */
-    for (size_t i = 0; i < bus->queue_size; i++) {
-        QueuedEvent* qe = &bus->event_queue[i];
-        Event* event = &qe->event;
+static uint32_t hash_bytes(const void* data, size_t size) {
+    const unsigned char* bytes = data;
+    uint32_t hash = 2166136261u ^ (uint32_t)size;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
 
-        /* Call all subscribers */
-        Subscription* sub = bus->subscriptions[event->type];
-        while (sub) {
-            if (sub->active && sub->callback) {
-                sub->callback(event, sub->userdata);
+/**
+ * Helper: drop events whose key an event later in the batch repeats
+ * The latest of each key stays, at its own position.
+ *
+ * @return Events left
+ */
+static size_t coalesce(EventBus* bus, size_t key_size, Event* events,
+                       uint64_t* queued_ns, size_t count) {
+    uint32_t stamp = next_stamp(bus);
+    size_t kept = count;
+
+    for (size_t j = count; j-- > 0;) {
+        size_t size = coalesce_key_size(&events[j], key_size);
+        uint32_t h = hash_bytes(events[j].data, size) & (COALESCE_TABLE_SIZE - 1);
+        bool duplicate = false;
+
+        while (bus->coalesce_stamp[h] == stamp) {
+            const Event* later = &events[bus->coalesce_index[h]];
+            if (coalesce_key_size(later, key_size) == size &&
+                (size == 0 || memcmp(later->data, events[j].data, size) == 0)) {
+                duplicate = true;
+                break;
             }
-            sub = sub->next;
+            h = (h + 1) & (COALESCE_TABLE_SIZE - 1);
         }
 
-        /* Free owned data */
-        if (qe->data_owned) {
-            free(event->data);
+        if (duplicate) {
+            if (bus->trace) {
+                trace_batch(bus, EVENT_TRACE_COALESCED, &events[j], &queued_ns[j], 1, 0,
+                            timing_get_ns());
+            }
+            events[j].type = EVENT_NONE;
+            kept--;
+        } else {
+            bus->coalesce_stamp[h] = stamp;
+            bus->coalesce_index[h] = (uint16_t)j;
         }
     }
 
-    /* Clear queue */
-    bus->queue_size = 0;
+    size_t write = 0;
+    for (size_t j = 0; j < count; j++) {
+        if (events[j].type != EVENT_NONE) {
+            queued_ns[write] = queued_ns[j];
+            events[write++] = events[j];
+        }
+    }
+    return kept;
 }
 
-void event_bus_clear_queue(EventBus* bus) {
-    if (!bus) return;
+/**
+ * Helper: deliver staged events grouped by type
+ * Types go in order of their first event; each type's events keep queue
+ * order and reach every subscriber as one batch.
+ */
+static void dispatch_staged(EventBus* bus, size_t count) {
+    uint32_t stamp = next_stamp(bus);
+    size_t group_count = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        EventType type = bus->staged[i].type;
+        if (bus->type_stamp[type] != stamp) {
+            bus->type_stamp[type] = stamp;
+            bus->type_group[type] = (uint16_t)group_count;
+            bus->groups[group_count++] = (EventGroup){ .type = type };
+        }
+        bus->groups[bus->type_group[type]].count++;
+    }
+
+    uint32_t start = 0;
+    for (size_t g = 0; g < group_count; g++) {
+        bus->groups[g].start = start;
+        start += bus->groups[g].count;
+    }
+    for (size_t i = 0; i < count; i++) {
+        EventGroup* group = &bus->groups[bus->type_group[bus->staged[i].type]];
+        bus->grouped_ns[group->start + group->filled] = bus->staged_ns[i];
+        bus->grouped[group->start + group->filled++] = bus->staged[i];
+    }
 
-    /* Free owned data */
-    for (size_t i = 0; i < bus->queue_size; i++) {
-        if (bus->event_queue[i].data_owned) {
-            free(bus->event_queue[i].event.data);
+    for (size_t g = 0; g < group_count; g++) {
+        EventGroup* group = &bus->groups[g];
+        Event* batch = bus->grouped + group->start;
+        uint64_t* batch_ns = bus->grouped_ns + group->start;
+        size_t batch_size = group->count;
+
+        const SubscriberList* list = &bus->subscribers[group->type];
+        if (list->coalesce && batch_size > 1) {
+            batch_size = coalesce(bus, list->coalesce_key, batch, batch_ns, batch_size);
+        }
+
+        uint64_t start = bus->trace ? timing_get_ns() : 0;
+        size_t called = deliver(bus, group->type, batch, batch_size);
+        if (bus->trace) {
+            trace_batch(bus, EVENT_TRACE_DISPATCHED, batch, batch_ns, batch_size, called, start);
         }
     }
+}
 
-    bus->queue_size = 0;
+/* Helper: take events queued before the call, optionally dispatching them */
+static size_t drain_queue(EventBus* bus, bool dispatch) {
+    if (bus->dispatching) {
+        LOG_WARN("Event queue can not be drained from inside a dispatch");
+        return 0;
+    }
+
+    size_t start = atomic_load_explicit(&bus->dequeue_pos, memory_order_relaxed);
+    size_t end = atomic_load(&bus->enqueue_pos);
+    size_t count = 0;
+
+    for (size_t pos = start; pos != end; pos++) {
+        QueuedEvent* qe = &bus->ring[pos & (MAX_EVENT_QUEUE - 1)];
+
+        /* Claimed but not yet filled: picked up next time */
+        if (atomic_load_explicit(&qe->sequence, memory_order_acquire) != pos + 1) break;
+        bus->staged_ns[count] = qe->queued_ns;
+        bus->staged[count++] = qe->event;
+    }
+
+    if (dispatch && count > 0) {
+        bus->dispatching = true;
+        dispatch_staged(bus, count);
+        bus->dispatching = false;
+    }
+
+    /* Slots and payloads are only handed back once every callback ran */
+    for (size_t i = 0; i < count; i++) {
+        QueuedEvent* qe = &bus->ring[(start + i) & (MAX_EVENT_QUEUE - 1)];
+        release_payload(bus, qe);
+        atomic_store_explicit(&qe->sequence, start + i + MAX_EVENT_QUEUE, memory_order_release);
+    }
+    atomic_store_explicit(&bus->dequeue_pos, start + count, memory_order_relaxed);
+
+    return count;
+}
+
+/**
+ * Helper: start a new payload frame
+ * The other frame is rewound if nothing pins it, then becomes current;
+ * producers still copying into the old one finish there.
+ */
+static void flip_payload_frame(EventBus* bus) {
+    int next = 1 - atomic_load(&bus->current_frame);
+    if (atomic_load(&bus->frames[next].pins) == 0) {
+        atomic_store(&bus->frames[next].used, 0);
+    }
+    atomic_store(&bus->current_frame, next);
+}
+
+void event_bus_dispatch(EventBus* bus) {
+    if (!bus) return;
+
+    size_t dropped = atomic_exchange(&bus->dropped, 0);
+    if (dropped > 0) {
+        LOG_ERROR("Event queue full, dropped %zu event(s)", dropped);
+    }
+    if (event_bus_queue_size(bus) == 0) return;
+
+    flip_payload_frame(bus);
+
+    /* Events queued meanwhile (by callbacks or other threads) wait for the next dispatch */
+    size_t count = drain_queue(bus, true);
+    LOG_DEBUG("Dispatched %zu queued events", count);
+}
+
+void event_bus_clear_queue(EventBus* bus) {
+    if (!bus) return;
+
+    flip_payload_frame(bus);
+    drain_queue(bus, false);
     LOG_DEBUG("Cleared event queue");
 }
 
 size_t event_bus_queue_size(const EventBus* bus) {
-    return bus ? bus->queue_size : 0;
+    if (!bus) return 0;
+
+    size_t head = atomic_load(&bus->dequeue_pos);
+    size_t tail = atomic_load(&bus->enqueue_pos);
+    return tail - head;
 }
 
 size_t event_bus_subscriber_count(const EventBus* bus, EventType type) {
     if (!bus || type <= EVENT_NONE || type >= EVENT_COUNT) return 0;
 
-    size_t count = 0;
-    Subscription* sub = bus->subscriptions[type];
-    while (sub) {
-        if (sub->active) count++;
-        sub = sub->next;
-    }
-
-    return count;
+    return bus->subscribers[type].count - bus->subscribers[type].dead;
 }
 
 size_t event_bus_total_subscriptions(const EventBus* bus) {
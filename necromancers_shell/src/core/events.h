@@ -2,7 +2,9 @@
 #define EVENTS_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include "core/event_trace.h"
 
 /**
  * Event Bus - Pub/Sub Event System
@@ -10,6 +12,20 @@
  * Decoupled event-driven architecture for game systems.
  * Supports multiple subscribers per event type and event queuing.
  *
+ * Threading: event_bus_queue() may be called from any thread at once
+ * (simulation workers, autosave, AI) without locks. Everything else,
+ * including dispatch, belongs to the main thread. Queued payloads up to
+ * EVENT_INLINE_PAYLOAD bytes are stored in the queue itself, larger ones
+ * in a per-frame payload buffer, so queuing does not allocate.
+ *
+ * Dispatch groups the queued events by type and hands each type's events
+ * to a subscriber together; batch subscribers get them in one call.
+ * Types with frequent repeats can have duplicates within one dispatch
+ * coalesced into the latest (event_bus_set_coalescing).
+ *
+ * An EventTrace recorder can be attached to log every delivered event
+ * with its queue latency and delivery time (event_bus_set_trace).
+ *
  * Usage:
  *   EventBus* bus = event_bus_create();
  *   event_bus_subscribe(bus, EVENT_DAMAGE_TAKEN, on_damage, userdata);
@@ -72,6 +88,9 @@ typedef enum {
     EVENT_COUNT = 10000
 } EventType;
 
+/* Payload bytes stored inline in a queued event */
+#define EVENT_INLINE_PAYLOAD 64
+
 /* Forward declarations */
 typedef struct EventBus EventBus;
 typedef struct Event Event;
@@ -86,6 +105,12 @@ struct Event {
 /* Event callback function */
 typedef void (*EventCallback)(const Event* event, void* userdata);
 
+/* Batch callback: events of one type, in queue order */
+typedef void (*EventBatchCallback)(const Event* events, size_t count, void* userdata);
+
+/* Coalescing key size meaning the whole payload */
+#define EVENT_COALESCE_PAYLOAD SIZE_MAX
+
 /**
  * Create event bus
  *
@@ -114,8 +139,23 @@ void event_bus_destroy(EventBus* bus);
 size_t event_bus_subscribe(EventBus* bus, EventType type,
                            EventCallback callback, void* userdata);
 
+/**
+ * Subscribe to batches of an event type
+ * Dispatch calls the callback once with all queued events of the type;
+ * publish calls it with a batch of one.
+ *
+ * @param bus Event bus
+ * @param type Event type to listen for
+ * @param callback Batch callback function
+ * @param userdata User data passed to callback
+ * @return Subscription ID or 0 on failure
+ */
+size_t event_bus_subscribe_batch(EventBus* bus, EventType type,
+                                 EventBatchCallback callback, void* userdata);
+
 /**
  * Unsubscribe from events
+ * Safe from inside callbacks; the subscriber is not called again.
  *
  * @param bus Event bus
  * @param subscription_id Subscription ID from event_bus_subscribe
@@ -131,6 +171,33 @@ bool event_bus_unsubscribe(EventBus* bus, size_t subscription_id);
  */
 void event_bus_unsubscribe_all(EventBus* bus, EventType type);
 
+/**
+ * Coalesce duplicate queued events of a type
+ * Within one dispatch, events of the type whose payloads share the same
+ * first key_size bytes are delivered once, as the latest of them (at its
+ * position). Publish is not affected.
+ *
+ * @param bus Event bus
+ * @param type Event type
+ * @param enabled Turn coalescing on or off
+ * @param key_size Leading payload bytes identifying duplicates, e.g. the
+ *                 size of an ID field, or EVENT_COALESCE_PAYLOAD to merge
+ *                 only identical payloads
+ * @return true on success
+ */
+bool event_bus_set_coalescing(EventBus* bus, EventType type, bool enabled, size_t key_size);
+
+/**
+ * Attach or detach an event trace recorder
+ * While attached, every published, dispatched or coalesced event is
+ * recorded. Queue latency is measured for events queued after attaching.
+ * The bus does not own the recorder; detach before destroying it.
+ *
+ * @param bus Event bus
+ * @param trace Recorder, or NULL to stop recording (flushes the old one)
+ */
+void event_bus_set_trace(EventBus* bus, EventTrace* trace);
+
 /**
  * Publish an event immediately (synchronous)
  * All subscribers are called immediately
@@ -144,19 +211,25 @@ bool event_bus_publish(EventBus* bus, EventType type, void* data);
 
 /**
  * Queue an event for later dispatch (asynchronous)
- * Event data is copied and will be freed after dispatch
+ * Event data is copied and released after dispatch. Safe to call from
+ * any thread; lock-free and, except for payloads too large for the
+ * current frame's buffer, allocation-free.
  *
  * @param bus Event bus
  * @param type Event type
  * @param data Event data (will be copied, can be NULL)
  * @param data_size Size of data to copy
- * @return true on success
+ * @return true on success, false if the queue is full (reported by the
+ *         next dispatch)
  */
 bool event_bus_queue(EventBus* bus, EventType type, const void* data, size_t data_size);
 
 /**
  * Dispatch all queued events
- * Processes and clears the event queue
+ * Processes the events queued before the call, grouped by type: types in
+ * order of their first queued event, each type's events in queue order.
+ * Events queued meanwhile, by callbacks or other threads, wait for the
+ * next dispatch. Main thread only, and not from inside a callback.
  *
  * @param bus Event bus
  */
@@ -171,6 +244,7 @@ void event_bus_clear_queue(EventBus* bus);
 
 /**
  * Get number of queued events
+ * Includes events other threads are still filling in.
  *
  * @param bus Event bus
  * @return Queue size
@@ -4,10 +4,15 @@
 #include <string.h>
 #include <assert.h>
 #include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+struct PoolSlab;
 
 /* Block header for tracking */
 typedef struct BlockHeader {
     struct BlockHeader* next;  /* Next in free list */
+    struct PoolSlab* slab;     /* Owning slab */
     bool is_allocated;         /* Allocation flag */
     #ifdef DEBUG
     const char* file;          /* Allocation location */
@@ -15,26 +20,169 @@ typedef struct BlockHeader {
     #endif
 } BlockHeader;
 
+/* One contiguous chunk of blocks */
+typedef struct PoolSlab {
+    struct PoolSlab* next;     /* Next slab in chain */
+    char* memory;              /* Raw memory block */
+    size_t block_count;
+    size_t allocated_count;    /* Blocks out of the free list */
+} PoolSlab;
+
 /* Pool structure */
 struct MemoryPool {
-    void* memory;              /* Raw memory block */
+    PoolSlab* slabs;           /* Slab chain (oldest first) */
+    PoolSlab* last_slab;
+    size_t slab_count;
     BlockHeader* free_list;    /* Free block list */
     size_t block_size;         /* Actual block size (including header) */
     size_t user_block_size;    /* User-visible block size */
-    size_t block_count;
+    size_t block_count;        /* Blocks across all slabs */
+    size_t max_blocks;         /* Growth limit (0 = unbounded) */
     size_t allocated_count;
+    size_t cached_count;       /* Free blocks parked in thread magazines */
     size_t peak_usage;
     size_t total_allocs;
     size_t total_frees;
+
+    /* Thread cache support */
+    bool thread_cache;
+    size_t magazine_size;
+    uint64_t id;               /* Never reused, keys thread magazines */
+    atomic_uint_fast64_t epoch; /* Bumped by reset to invalidate magazines */
+    pthread_mutex_t lock;
 };
 
+/* Per-thread cache of free blocks for one pool */
+typedef struct {
+    uint64_t pool_id;          /* 0 = slot unused */
+    uint64_t epoch;
+    size_t count;
+    size_t reported;           /* count last folded into pool->cached_count */
+    size_t local_allocs;       /* Not yet folded into pool statistics */
+    size_t local_frees;
+    BlockHeader* blocks[POOL_MAGAZINE_MAX];
+} PoolMagazine;
+
+static _Thread_local PoolMagazine tls_magazines[POOL_MAX_THREAD_CACHES];
+static atomic_uint_fast64_t next_pool_id = 1;
+
+/* IDs of live thread-cached pools, so threads can reclaim magazine slots
+ * left behind by pools destroyed elsewhere */
+static pthread_mutex_t live_pools_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t* live_pool_ids;
+static size_t live_pool_count;
+static size_t live_pool_capacity;
+static atomic_uint_fast64_t pools_destroyed;
+static _Thread_local uint64_t tls_pools_destroyed;
+
 /* Helper: align size to pointer boundary */
 static inline size_t align_size(size_t size) {
     const size_t alignment = sizeof(void*);
     return (size + alignment - 1) & ~(alignment - 1);
 }
 
-MemoryPool* pool_create(size_t block_size, size_t block_count) {
+static inline void pool_lock(MemoryPool* pool) {
+    if (pool->thread_cache) pthread_mutex_lock(&pool->lock);
+}
+
+static inline void pool_unlock(MemoryPool* pool) {
+    if (pool->thread_cache) pthread_mutex_unlock(&pool->lock);
+}
+
+/* Helper: thread free list through a slab (lowest address popped first) */
+static void slab_build_free_list(MemoryPool* pool, PoolSlab* slab) {
+    for (size_t i = slab->block_count; i-- > 0;) {
+        BlockHeader* block = (BlockHeader*)(slab->memory + i * pool->block_size);
+        block->slab = slab;
+        block->is_allocated = false;
+        block->next = pool->free_list;
+        pool->free_list = block;
+    }
+    slab->allocated_count = 0;
+}
+
+/* Helper: chain a new slab of block_count blocks (caller holds lock) */
+static bool pool_add_slab(MemoryPool* pool, size_t block_count) {
+    PoolSlab* slab = malloc(sizeof(PoolSlab));
+    if (!slab) {
+        LOG_ERROR("Failed to allocate slab structure");
+        return false;
+    }
+
+    size_t total_size = pool->block_size * block_count;
+    slab->memory = malloc(total_size);
+    if (!slab->memory) {
+        LOG_ERROR("Failed to allocate %zu bytes for pool slab", total_size);
+        free(slab);
+        return false;
+    }
+
+    slab->next = NULL;
+    slab->block_count = block_count;
+    slab_build_free_list(pool, slab);
+
+    if (pool->last_slab) {
+        pool->last_slab->next = slab;
+    } else {
+        pool->slabs = slab;
+    }
+    pool->last_slab = slab;
+    pool->slab_count++;
+    pool->block_count += block_count;
+
+    return true;
+}
+
+/* Helper: grow pool by one slab, doubling the previous slab (caller holds lock) */
+static bool pool_grow(MemoryPool* pool) {
+    size_t next = pool->last_slab->block_count * 2;
+    if (next > POOL_MAX_SLAB_BLOCKS) next = POOL_MAX_SLAB_BLOCKS;
+    if (next < pool->last_slab->block_count) next = pool->last_slab->block_count;
+
+    if (pool->max_blocks > 0) {
+        if (pool->block_count >= pool->max_blocks) {
+            return false;
+        }
+        size_t remaining = pool->max_blocks - pool->block_count;
+        if (next > remaining) next = remaining;
+    }
+
+    if (!pool_add_slab(pool, next)) {
+        return false;
+    }
+
+    LOG_DEBUG("Grew memory pool: slab %zu with %zu blocks (%zu total)",
+              pool->slab_count, next, pool->block_count);
+    return true;
+}
+
+/* Helper: pop a block off the shared free list (caller holds lock) */
+static BlockHeader* depot_pop(MemoryPool* pool) {
+    if (!pool->free_list && !pool_grow(pool)) {
+        return NULL;
+    }
+
+    BlockHeader* block = pool->free_list;
+    pool->free_list = block->next;
+    block->next = NULL;
+    block->slab->allocated_count++;
+    return block;
+}
+
+/* Helper: push a block back onto the shared free list (caller holds lock) */
+static void depot_push(MemoryPool* pool, BlockHeader* block) {
+    block->next = pool->free_list;
+    pool->free_list = block;
+    block->slab->allocated_count--;
+}
+
+static inline void update_peak(MemoryPool* pool) {
+    if (pool->allocated_count > pool->peak_usage) {
+        pool->peak_usage = pool->allocated_count;
+    }
+}
+
+MemoryPool* pool_create_bounded(size_t block_size, size_t block_count, size_t max_blocks) {
     if (block_size == 0 || block_count == 0) {
         LOG_ERROR("Invalid pool parameters: block_size=%zu, count=%zu",
                   block_size, block_count);
@@ -42,51 +190,226 @@ MemoryPool* pool_create(size_t block_size, size_t block_count) {
     }
 
     /* Allocate pool structure */
-    MemoryPool* pool = malloc(sizeof(MemoryPool));
+    MemoryPool* pool = calloc(1, sizeof(MemoryPool));
     if (!pool) {
         LOG_ERROR("Failed to allocate pool structure");
         return NULL;
     }
 
     /* Calculate actual block size (user size + header, aligned) */
-    size_t actual_block_size = align_size(block_size + sizeof(BlockHeader));
-    size_t total_size = actual_block_size * block_count;
+    pool->block_size = align_size(block_size + sizeof(BlockHeader));
+    pool->user_block_size = block_size;
+    pool->max_blocks = (max_blocks > 0 && max_blocks < block_count) ? block_count : max_blocks;
+    pool->id = atomic_fetch_add(&next_pool_id, 1);
+    atomic_init(&pool->epoch, 0);
 
-    /* Allocate memory block */
-    pool->memory = malloc(total_size);
-    if (!pool->memory) {
-        LOG_ERROR("Failed to allocate %zu bytes for pool", total_size);
+    /* Allocate initial slab */
+    if (!pool_add_slab(pool, block_count)) {
         free(pool);
         return NULL;
     }
 
-    /* Initialize pool */
-    pool->block_size = actual_block_size;
-    pool->user_block_size = block_size;
-    pool->block_count = block_count;
-    pool->allocated_count = 0;
-    pool->peak_usage = 0;
-    pool->total_allocs = 0;
-    pool->total_frees = 0;
+    LOG_DEBUG("Created memory pool: %zu blocks of %zu bytes (%zu total)",
+              block_count, block_size, pool->block_size * block_count);
 
-    /* Build free list */
-    pool->free_list = NULL;
-    for (size_t i = 0; i < block_count; i++) {
-        BlockHeader* block = (BlockHeader*)((char*)pool->memory + i * actual_block_size);
-        block->is_allocated = false;
-        block->next = pool->free_list;
-        pool->free_list = block;
+    return pool;
+}
+
+MemoryPool* pool_create(size_t block_size, size_t block_count) {
+    return pool_create_bounded(block_size, block_count, 0);
+}
+
+/* Helper: add pool to the live registry */
+static bool live_pools_add(uint64_t id) {
+    pthread_mutex_lock(&live_pools_lock);
+    if (live_pool_count == live_pool_capacity) {
+        size_t capacity = live_pool_capacity ? live_pool_capacity * 2 : 16;
+        uint64_t* ids = realloc(live_pool_ids, capacity * sizeof(uint64_t));
+        if (!ids) {
+            pthread_mutex_unlock(&live_pools_lock);
+            return false;
+        }
+        live_pool_ids = ids;
+        live_pool_capacity = capacity;
     }
+    live_pool_ids[live_pool_count++] = id;
+    pthread_mutex_unlock(&live_pools_lock);
+    return true;
+}
 
-    LOG_DEBUG("Created memory pool: %zu blocks of %zu bytes (%zu total)",
-              block_count, block_size, total_size);
+/* Helper: drop pool from the live registry */
+static void live_pools_remove(uint64_t id) {
+    pthread_mutex_lock(&live_pools_lock);
+    for (size_t i = 0; i < live_pool_count; i++) {
+        if (live_pool_ids[i] == id) {
+            live_pool_ids[i] = live_pool_ids[--live_pool_count];
+            break;
+        }
+    }
+    atomic_fetch_add_explicit(&pools_destroyed, 1, memory_order_relaxed);
+    if (live_pool_count == 0) {
+        free(live_pool_ids);
+        live_pool_ids = NULL;
+        live_pool_capacity = 0;
+    }
+    pthread_mutex_unlock(&live_pools_lock);
+}
 
-    return pool;
+/* Helper: free this thread's slots whose pool has been destroyed.
+ * Their blocks went away with the pool's slabs. */
+static PoolMagazine* magazine_reclaim(void) {
+    /* Nothing to reclaim unless a pool died since the last look */
+    uint64_t destroyed = atomic_load_explicit(&pools_destroyed, memory_order_relaxed);
+    if (destroyed == tls_pools_destroyed) return NULL;
+
+    PoolMagazine* empty = NULL;
+    pthread_mutex_lock(&live_pools_lock);
+    tls_pools_destroyed = atomic_load_explicit(&pools_destroyed, memory_order_relaxed);
+    for (size_t i = 0; i < POOL_MAX_THREAD_CACHES; i++) {
+        PoolMagazine* mag = &tls_magazines[i];
+        bool live = false;
+        for (size_t j = 0; j < live_pool_count && !live; j++) {
+            live = live_pool_ids[j] == mag->pool_id;
+        }
+        if (!live) {
+            mag->pool_id = 0;
+            if (!empty) empty = mag;
+        }
+    }
+    pthread_mutex_unlock(&live_pools_lock);
+    return empty;
+}
+
+/* Helper: find calling thread's magazine for pool, claiming a slot if create */
+static PoolMagazine* magazine_find(const MemoryPool* pool, bool create) {
+    PoolMagazine* empty = NULL;
+    for (size_t i = 0; i < POOL_MAX_THREAD_CACHES; i++) {
+        PoolMagazine* mag = &tls_magazines[i];
+        if (mag->pool_id == pool->id) {
+            uint64_t epoch = atomic_load_explicit(&pool->epoch, memory_order_acquire);
+            if (mag->epoch != epoch) {
+                /* Pool was reset; cached blocks already returned to slabs */
+                mag->epoch = epoch;
+                mag->count = 0;
+                mag->reported = 0;
+                mag->local_allocs = 0;
+                mag->local_frees = 0;
+            }
+            return mag;
+        }
+        if (!empty && mag->pool_id == 0) {
+            empty = &tls_magazines[i];
+        }
+    }
+
+    if (!create) {
+        return NULL;
+    }
+    if (!empty) {
+        empty = magazine_reclaim();
+        if (!empty) return NULL;
+    }
+
+    memset(empty, 0, sizeof(*empty));
+    empty->pool_id = pool->id;
+    empty->epoch = atomic_load_explicit(&pool->epoch, memory_order_acquire);
+    return empty;
+}
+
+/* Helper: fold magazine counters into pool statistics (caller holds lock) */
+static void magazine_fold(MemoryPool* pool, PoolMagazine* mag) {
+    pool->total_allocs += mag->local_allocs;
+    pool->total_frees += mag->local_frees;
+    pool->allocated_count += mag->local_allocs;
+    pool->allocated_count -= mag->local_frees;
+    update_peak(pool);
+    mag->local_allocs = 0;
+    mag->local_frees = 0;
+}
+
+/* Helper: sync pool->cached_count with magazine occupancy (caller holds lock) */
+static void magazine_report(MemoryPool* pool, PoolMagazine* mag) {
+    pool->cached_count -= mag->reported;
+    pool->cached_count += mag->count;
+    mag->reported = mag->count;
+}
+
+/* Helper: return blocks until only keep remain in magazine */
+static void magazine_drain(MemoryPool* pool, PoolMagazine* mag, size_t keep) {
+    pthread_mutex_lock(&pool->lock);
+    magazine_fold(pool, mag);
+    while (mag->count > keep) {
+        depot_push(pool, mag->blocks[--mag->count]);
+    }
+    magazine_report(pool, mag);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void* magazine_alloc(MemoryPool* pool, PoolMagazine* mag) {
+    if (mag->count == 0) {
+        /* Refill half a magazine from the shared slabs */
+        size_t want = pool->magazine_size / 2;
+        if (want == 0) want = 1;
+
+        pthread_mutex_lock(&pool->lock);
+        magazine_fold(pool, mag);
+        while (mag->count < want) {
+            BlockHeader* block = depot_pop(pool);
+            if (!block) break;
+            mag->blocks[mag->count++] = block;
+        }
+        magazine_report(pool, mag);
+        pthread_mutex_unlock(&pool->lock);
+
+        if (mag->count == 0) {
+            LOG_ERROR("Pool exhausted: %zu/%zu blocks allocated",
+                      pool->allocated_count, pool->max_blocks);
+            return NULL;
+        }
+    }
+
+    BlockHeader* block = mag->blocks[--mag->count];
+    block->is_allocated = true;
+    mag->local_allocs++;
+    return (char*)block + sizeof(BlockHeader);
+}
+
+static void magazine_free(MemoryPool* pool, PoolMagazine* mag, BlockHeader* block) {
+    if (mag->count == pool->magazine_size) {
+        magazine_drain(pool, mag, pool->magazine_size / 2);
+    }
+    mag->blocks[mag->count++] = block;
+    mag->local_frees++;
 }
 
 void pool_destroy(MemoryPool* pool) {
     if (!pool) return;
 
+    /* Release this thread's magazine so the slot can be reused; other
+     * threads reclaim theirs once the pool leaves the live registry */
+    if (pool->thread_cache) {
+        PoolMagazine* mag = magazine_find(pool, false);
+        if (mag) {
+            magazine_drain(pool, mag, 0);
+            mag->pool_id = 0;
+        }
+        live_pools_remove(pool->id);
+
+        /* Other threads' magazines may hold unfolded frees; count from
+         * the block flags instead */
+        if (pool->allocated_count > 0) {
+            size_t allocated = 0;
+            for (const PoolSlab* slab = pool->slabs; slab; slab = slab->next) {
+                for (size_t i = 0; i < slab->block_count; i++) {
+                    const BlockHeader* block =
+                        (const BlockHeader*)(slab->memory + i * pool->block_size);
+                    if (block->is_allocated) allocated++;
+                }
+            }
+            pool->allocated_count = allocated;
+        }
+    }
+
     /* Check for leaks */
     if (pool->allocated_count > 0) {
         LOG_WARN("Destroying pool with %zu blocks still allocated (potential leak)",
@@ -94,10 +417,20 @@ void pool_destroy(MemoryPool* pool) {
         pool_check_leaks(pool);
     }
 
-    LOG_DEBUG("Destroying pool: %zu total allocs, %zu peak usage",
-              pool->total_allocs, pool->peak_usage);
+    LOG_DEBUG("Destroying pool: %zu total allocs, %zu peak usage, %zu slabs",
+              pool->total_allocs, pool->peak_usage, pool->slab_count);
 
-    free(pool->memory);
+    PoolSlab* slab = pool->slabs;
+    while (slab) {
+        PoolSlab* next = slab->next;
+        free(slab->memory);
+        free(slab);
+        slab = next;
+    }
+
+    if (pool->thread_cache) {
+        pthread_mutex_destroy(&pool->lock);
+    }
     free(pool);
 }
 
@@ -107,30 +440,37 @@ void* pool_alloc(MemoryPool* pool) {
         return NULL;
     }
 
-    /* Check if pool exhausted */
-    if (!pool->free_list) {
-        LOG_ERROR("Pool exhausted: %zu/%zu blocks allocated",
-                  pool->allocated_count, pool->block_count);
-        return NULL;
-    }
+    void* user_ptr = NULL;
+
+    PoolMagazine* mag = pool->thread_cache ? magazine_find(pool, true) : NULL;
+    if (mag) {
+        user_ptr = magazine_alloc(pool, mag);
+        if (!user_ptr) return NULL;
+    } else {
+        pool_lock(pool);
+
+        /* Pop from free list, growing the pool if needed */
+        BlockHeader* block = depot_pop(pool);
+        if (!block) {
+            LOG_ERROR("Pool exhausted: %zu/%zu blocks allocated",
+                      pool->allocated_count, pool->block_count);
+            pool_unlock(pool);
+            return NULL;
+        }
 
-    /* Pop from free list */
-    BlockHeader* block = pool->free_list;
-    pool->free_list = block->next;
+        /* Mark as allocated */
+        block->is_allocated = true;
 
-    /* Mark as allocated */
-    block->is_allocated = true;
-    block->next = NULL;
+        /* Update statistics */
+        pool->allocated_count++;
+        pool->total_allocs++;
+        update_peak(pool);
 
-    /* Update statistics */
-    pool->allocated_count++;
-    pool->total_allocs++;
-    if (pool->allocated_count > pool->peak_usage) {
-        pool->peak_usage = pool->allocated_count;
-    }
+        pool_unlock(pool);
 
-    /* Return user-visible pointer (after header) */
-    void* user_ptr = (char*)block + sizeof(BlockHeader);
+        /* Return user-visible pointer (after header) */
+        user_ptr = (char*)block + sizeof(BlockHeader);
+    }
 
     #ifdef DEBUG
     memset(user_ptr, 0xCD, pool->user_block_size);  /* Debug pattern */
@@ -155,9 +495,20 @@ void pool_free(MemoryPool* pool, void* ptr) {
 
     /* Validate block */
     #ifdef DEBUG
-    /* Check if pointer is within pool bounds */
-    ptrdiff_t offset = (char*)block - (char*)pool->memory;
-    if (offset < 0 || (size_t)offset >= pool->block_size * pool->block_count) {
+    /* Check if pointer is within one of the pool's slabs */
+    pool_lock(pool);
+    const PoolSlab* owner = NULL;
+    ptrdiff_t offset = 0;
+    for (const PoolSlab* slab = pool->slabs; slab; slab = slab->next) {
+        offset = (char*)block - slab->memory;
+        if (offset >= 0 && (size_t)offset < pool->block_size * slab->block_count) {
+            owner = slab;
+            break;
+        }
+    }
+    pool_unlock(pool);
+
+    if (!owner) {
         LOG_ERROR("Attempting to free pointer not from this pool: %p", ptr);
         return;
     }
@@ -182,35 +533,91 @@ void pool_free(MemoryPool* pool, void* ptr) {
     memset(ptr, 0xDD, pool->user_block_size);  /* Debug pattern for freed memory */
     #endif
 
+    PoolMagazine* mag = pool->thread_cache ? magazine_find(pool, true) : NULL;
+    if (mag) {
+        magazine_free(pool, mag, block);
+        return;
+    }
+
+    pool_lock(pool);
+
     /* Push to free list */
-    block->next = pool->free_list;
-    pool->free_list = block;
+    depot_push(pool, block);
 
     /* Update statistics */
     pool->allocated_count--;
     pool->total_frees++;
+
+    pool_unlock(pool);
 }
 
 void pool_reset(MemoryPool* pool) {
     if (!pool) return;
 
+    pool_lock(pool);
+
     LOG_DEBUG("Resetting pool: freeing %zu allocated blocks", pool->allocated_count);
 
-    /* Rebuild free list */
+    /* Rebuild free list across every slab */
     pool->free_list = NULL;
-    for (size_t i = 0; i < pool->block_count; i++) {
-        BlockHeader* block = (BlockHeader*)((char*)pool->memory + i * pool->block_size);
-        block->is_allocated = false;
-        block->next = pool->free_list;
-        pool->free_list = block;
+    for (PoolSlab* slab = pool->slabs; slab; slab = slab->next) {
+        slab_build_free_list(pool, slab);
     }
 
     pool->allocated_count = 0;
+    pool->cached_count = 0;
+
+    /* Any magazine contents now live on the free list again */
+    atomic_fetch_add_explicit(&pool->epoch, 1, memory_order_release);
+
+    pool_unlock(pool);
+}
+
+bool pool_enable_thread_cache(MemoryPool* pool, size_t magazine_size) {
+    if (!pool) return false;
+
+    if (pool->thread_cache) {
+        LOG_WARN("Thread cache already enabled for pool");
+        return true;
+    }
+
+    if (magazine_size == 0) magazine_size = POOL_MAGAZINE_MAX;
+    if (magazine_size > POOL_MAGAZINE_MAX) magazine_size = POOL_MAGAZINE_MAX;
+
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        LOG_ERROR("Failed to initialize pool mutex");
+        return false;
+    }
+
+    if (!live_pools_add(pool->id)) {
+        LOG_ERROR("Failed to register thread-cached pool");
+        pthread_mutex_destroy(&pool->lock);
+        return false;
+    }
+
+    pool->magazine_size = magazine_size;
+    pool->thread_cache = true;
+
+    LOG_DEBUG("Enabled thread cache: %zu blocks per magazine", magazine_size);
+    return true;
+}
+
+void pool_thread_cache_flush(MemoryPool* pool) {
+    if (!pool || !pool->thread_cache) return;
+
+    PoolMagazine* mag = magazine_find(pool, false);
+    if (!mag) return;
+
+    magazine_drain(pool, mag, 0);
+    mag->pool_id = 0;
 }
 
 void pool_get_stats(const MemoryPool* pool, MemoryStats* stats) {
     if (!pool || !stats) return;
 
+    MemoryPool* mutable_pool = (MemoryPool*)pool;
+    pool_lock(mutable_pool);
+
     stats->total_bytes = pool->block_size * pool->block_count;
     stats->block_size = pool->user_block_size;
     stats->block_count = pool->block_count;
@@ -218,6 +625,41 @@ void pool_get_stats(const MemoryPool* pool, MemoryStats* stats) {
     stats->peak_usage = pool->peak_usage;
     stats->total_allocs = pool->total_allocs;
     stats->total_frees = pool->total_frees;
+    stats->slab_count = pool->slab_count;
+    stats->max_blocks = pool->max_blocks;
+    stats->cached_blocks = pool->cached_count;
+
+    /* Fragmentation: share of non-empty slab capacity not in use */
+    size_t used = 0;
+    size_t capacity = 0;
+    for (const PoolSlab* slab = pool->slabs; slab; slab = slab->next) {
+        if (slab->allocated_count > 0) {
+            used += slab->allocated_count;
+            capacity += slab->block_count;
+        }
+    }
+    stats->fragmentation = capacity > 0 ? 1.0f - (float)used / (float)capacity : 0.0f;
+
+    pool_unlock(mutable_pool);
+}
+
+size_t pool_get_slab_stats(const MemoryPool* pool, MemorySlabStats* out, size_t max_slabs) {
+    if (!pool) return 0;
+
+    MemoryPool* mutable_pool = (MemoryPool*)pool;
+    pool_lock(mutable_pool);
+
+    size_t index = 0;
+    for (const PoolSlab* slab = pool->slabs; slab; slab = slab->next, index++) {
+        if (out && index < max_slabs) {
+            out[index].block_count = slab->block_count;
+            out[index].allocated_blocks = slab->allocated_count;
+            out[index].total_bytes = slab->block_count * pool->block_size;
+        }
+    }
+
+    pool_unlock(mutable_pool);
+    return index;
 }
 
 bool pool_check_leaks(const MemoryPool* pool) {
@@ -233,12 +675,14 @@ bool pool_check_leaks(const MemoryPool* pool) {
     /* In debug mode, could walk memory and report allocated blocks */
     #ifdef DEBUG
     size_t leaked = 0;
-    for (size_t i = 0; i < pool->block_count; i++) {
-        BlockHeader* block = (BlockHeader*)((char*)pool->memory + i * pool->block_size);
-        if (block->is_allocated) {
-            leaked++;
-            void* user_ptr = (char*)block + sizeof(BlockHeader);
-            LOG_WARN("  Leaked block #%zu at %p", leaked, user_ptr);
+    for (const PoolSlab* slab = pool->slabs; slab; slab = slab->next) {
+        for (size_t i = 0; i < slab->block_count; i++) {
+            BlockHeader* block = (BlockHeader*)(slab->memory + i * pool->block_size);
+            if (block->is_allocated) {
+                leaked++;
+                void* user_ptr = (char*)block + sizeof(BlockHeader);
+                LOG_WARN("  Leaked block #%zu at %p", leaked, user_ptr);
+            }
         }
     }
     #endif
@@ -263,4 +707,201 @@ void pool_print_stats(const MemoryPool* pool) {
     LOG_INFO("  Total allocs:   %zu", stats.total_allocs);
     LOG_INFO("  Total frees:    %zu", stats.total_frees);
     LOG_INFO("  Net allocations: %zu", stats.total_allocs - stats.total_frees);
+    LOG_INFO("  Thread cached:  %zu", stats.cached_blocks);
+    LOG_INFO("  Fragmentation:  %.1f%%", stats.fragmentation * 100.0f);
+    LOG_INFO("  Slabs:          %zu%s", stats.slab_count,
+             stats.max_blocks > 0 ? " (bounded)" : "");
+
+    MemorySlabStats slabs[32];
+    size_t slab_count = pool_get_slab_stats(pool, slabs, 32);
+    for (size_t i = 0; i < slab_count && i < 32; i++) {
+        float slab_pct = (float)slabs[i].allocated_blocks / slabs[i].block_count * 100.0f;
+        LOG_INFO("    Slab %2zu: %zu/%zu blocks (%.1f%%), %zu bytes",
+                 i, slabs[i].allocated_blocks, slabs[i].block_count,
+                 slab_pct, slabs[i].total_bytes);
+    }
+    if (slab_count > 32) {
+        LOG_INFO("    ... %zu more slabs", slab_count - 32);
+    }
+}
+
+/* ========================================================================
+ * Arena Allocator
+ * ======================================================================== */
+
+#define ARENA_DEFAULT_CHUNK 4096
+
+/* Arena chunk (data follows header) */
+typedef struct ArenaChunk {
+    struct ArenaChunk* next;
+    size_t size;
+    size_t used;
+    max_align_t data[];
+} ArenaChunk;
+
+struct Arena {
+    ArenaChunk* chunks;        /* Current chunk first */
+    size_t chunk_size;         /* Minimum size for new chunks */
+    size_t chunk_count;
+    size_t bytes_used;
+    size_t bytes_reserved;
+    size_t peak_bytes;
+    size_t total_allocs;
+    size_t resets;
+};
+
+static inline size_t arena_align(size_t size) {
+    const size_t alignment = _Alignof(max_align_t);
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/* Helper: push a fresh chunk of at least size bytes */
+static ArenaChunk* arena_add_chunk(Arena* arena, size_t size) {
+    if (size < arena->chunk_size) size = arena->chunk_size;
+
+    ArenaChunk* chunk = malloc(sizeof(ArenaChunk) + size);
+    if (!chunk) {
+        LOG_ERROR("Failed to allocate %zu byte arena chunk", size);
+        return NULL;
+    }
+
+    chunk->size = size;
+    chunk->used = 0;
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    arena->chunk_count++;
+    arena->bytes_reserved += size;
+    return chunk;
+}
+
+Arena* arena_create(size_t chunk_size) {
+    Arena* arena = calloc(1, sizeof(Arena));
+    if (!arena) {
+        LOG_ERROR("Failed to allocate arena structure");
+        return NULL;
+    }
+
+    arena->chunk_size = arena_align(chunk_size > 0 ? chunk_size : ARENA_DEFAULT_CHUNK);
+    if (!arena_add_chunk(arena, arena->chunk_size)) {
+        free(arena);
+        return NULL;
+    }
+
+    return arena;
+}
+
+void arena_destroy(Arena* arena) {
+    if (!arena) return;
+
+    ArenaChunk* chunk = arena->chunks;
+    while (chunk) {
+        ArenaChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    if (!arena) return NULL;
+
+    size = arena_align(size > 0 ? size : 1);
+
+    ArenaChunk* chunk = arena->chunks;
+    if (!chunk || chunk->size - chunk->used < size) {
+        /* Grow geometrically so long commands need few chunks */
+        size_t want = chunk ? chunk->size * 2 : arena->chunk_size;
+        if (want < size) want = size;
+        chunk = arena_add_chunk(arena, want);
+        if (!chunk) return NULL;
+    }
+
+    void* ptr = (char*)chunk->data + chunk->used;
+    chunk->used += size;
+    arena->bytes_used += size;
+    arena->total_allocs++;
+    return ptr;
+}
+
+void* arena_calloc(Arena* arena, size_t count, size_t size) {
+    if (size > 0 && count > SIZE_MAX / size) return NULL;
+
+    void* ptr = arena_alloc(arena, count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+char* arena_strndup(Arena* arena, const char* str, size_t len) {
+    if (!str) return NULL;
+
+    const char* end = memchr(str, '\0', len);
+    if (end) len = (size_t)(end - str);
+
+    char* copy = arena_alloc(arena, len + 1);
+    if (!copy) return NULL;
+
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+char* arena_strdup(Arena* arena, const char* str) {
+    if (!str) return NULL;
+    return arena_strndup(arena, str, strlen(str));
+}
+
+void arena_reset(Arena* arena) {
+    if (!arena) return;
+
+    if (arena->bytes_used > arena->peak_bytes) {
+        arena->peak_bytes = arena->bytes_used;
+    }
+
+    /* Collapse to one chunk sized for everything the last cycle needed */
+    if (arena->chunk_count > 1) {
+        size_t reserved = arena->bytes_reserved;
+        ArenaChunk* chunk = arena->chunks;
+        while (chunk) {
+            ArenaChunk* next = chunk->next;
+            free(chunk);
+            chunk = next;
+        }
+        arena->chunks = NULL;
+        arena->chunk_count = 0;
+        arena->bytes_reserved = 0;
+
+        if (!arena_add_chunk(arena, reserved)) {
+            /* arena_alloc will retry on demand */
+            LOG_WARN("Arena reset could not preallocate %zu bytes", reserved);
+        }
+    } else if (arena->chunks) {
+        arena->chunks->used = 0;
+    }
+
+    arena->bytes_used = 0;
+    arena->resets++;
+}
+
+bool arena_owns(const Arena* arena, const void* ptr) {
+    if (!arena || !ptr) return false;
+
+    for (const ArenaChunk* chunk = arena->chunks; chunk; chunk = chunk->next) {
+        const char* start = (const char*)chunk->data;
+        if ((const char*)ptr >= start && (const char*)ptr < start + chunk->used) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void arena_get_stats(const Arena* arena, ArenaStats* stats) {
+    if (!arena || !stats) return;
+
+    stats->chunk_count = arena->chunk_count;
+    stats->bytes_used = arena->bytes_used;
+    stats->bytes_reserved = arena->bytes_reserved;
+    stats->peak_bytes = arena->bytes_used > arena->peak_bytes ?
+                        arena->bytes_used : arena->peak_bytes;
+    stats->total_allocs = arena->total_allocs;
+    stats->resets = arena->resets;
 }
@@ -10,49 +10,94 @@
  * Provides fast, fixed-size block allocation with minimal fragmentation.
  * Tracks allocations for debugging and leak detection.
  *
+ * Pools are built from a chain of slabs. The first slab holds block_count
+ * blocks; when it runs out a new slab is chained on (each twice the size of
+ * the previous one, up to POOL_MAX_SLAB_BLOCKS), so pools can back objects
+ * whose count is unbounded. Use pool_create_bounded() to cap the total.
+ *
+ * Multi-threaded users can enable per-thread magazine caches with
+ * pool_enable_thread_cache(). Each thread then allocates and frees from a
+ * small private stack of blocks and only takes the pool lock to exchange
+ * half a magazine with the shared slabs.
+ *
  * Usage:
- *   MemoryPool* pool = pool_create(1024, 100); // 100 blocks of 1024 bytes
+ *   MemoryPool* pool = pool_create(1024, 100); // slabs of 100+ blocks of 1024 bytes
  *   void* ptr = pool_alloc(pool);
  *   pool_free(pool, ptr);
  *   pool_destroy(pool);
  */
 
+/* Largest number of blocks a single grown slab may hold */
+#define POOL_MAX_SLAB_BLOCKS 65536
+
+/* Largest per-thread magazine (blocks cached per thread per pool) */
+#define POOL_MAGAZINE_MAX 64
+
+/* Number of pools a single thread can hold magazines for at once */
+#define POOL_MAX_THREAD_CACHES 8
+
 /* Opaque pool structure */
 typedef struct MemoryPool MemoryPool;
 
 /* Memory statistics */
 typedef struct {
-    size_t total_bytes;        /* Total pool size */
+    size_t total_bytes;        /* Total pool size (all slabs) */
     size_t block_size;         /* Size of each block */
-    size_t block_count;        /* Total blocks */
+    size_t block_count;        /* Total blocks (all slabs) */
     size_t allocated_blocks;   /* Currently allocated */
     size_t peak_usage;         /* Peak allocation count */
     size_t total_allocs;       /* Lifetime allocations */
     size_t total_frees;        /* Lifetime frees */
+    size_t slab_count;         /* Number of chained slabs */
+    size_t max_blocks;         /* Growth limit (0 = unbounded) */
+    size_t cached_blocks;      /* Free blocks parked in thread magazines */
+    float fragmentation;       /* Unused fraction of non-empty slabs (0.0-1.0) */
 } MemoryStats;
 
+/* Per-slab statistics */
+typedef struct {
+    size_t block_count;        /* Blocks in this slab */
+    size_t allocated_blocks;   /* Blocks handed out (incl. thread magazines) */
+    size_t total_bytes;        /* Slab size in bytes */
+} MemorySlabStats;
+
 /**
- * Create a memory pool
+ * Create a growable memory pool
  *
  * @param block_size Size of each block (bytes)
- * @param block_count Number of blocks
+ * @param block_count Number of blocks in the initial slab
  * @return Pool pointer or NULL on failure
  */
 MemoryPool* pool_create(size_t block_size, size_t block_count);
 
+/**
+ * Create a memory pool with a growth limit
+ *
+ * @param block_size Size of each block (bytes)
+ * @param block_count Number of blocks in the initial slab
+ * @param max_blocks Maximum total blocks (0 = unbounded, < block_count = block_count)
+ * @return Pool pointer or NULL on failure
+ */
+MemoryPool* pool_create_bounded(size_t block_size, size_t block_count, size_t max_blocks);
+
 /**
  * Destroy a memory pool
  * Logs warning if blocks still allocated
  *
+ * Other threads must no longer use the pool, but need not flush their
+ * magazines first: their cached blocks go away with the pool's slabs and
+ * the slots are reclaimed the next time those threads need one.
+ *
  * @param pool Pool to destroy
  */
 void pool_destroy(MemoryPool* pool);
 
 /**
  * Allocate a block from pool
+ * Grows the pool with a new slab when all slabs are full.
  *
  * @param pool Pool to allocate from
- * @return Pointer to block or NULL if pool exhausted
+ * @return Pointer to block or NULL if pool reached its limit
  */
 void* pool_alloc(MemoryPool* pool);
 
@@ -66,20 +111,55 @@ void pool_free(MemoryPool* pool, void* ptr);
 
 /**
  * Reset pool (free all blocks at once)
- * Much faster than individual frees
+ * Much faster than individual frees. Slabs are kept for reuse and any
+ * thread magazines are invalidated. Must not run concurrently with other
+ * threads using the pool.
  *
  * @param pool Pool to reset
  */
 void pool_reset(MemoryPool* pool);
 
+/**
+ * Enable per-thread magazine caches
+ * Makes the pool safe to use from multiple threads. Must be called before
+ * the pool is shared.
+ *
+ * @param pool Pool to configure
+ * @param magazine_size Blocks cached per thread (clamped to POOL_MAGAZINE_MAX)
+ * @return true on success
+ */
+bool pool_enable_thread_cache(MemoryPool* pool, size_t magazine_size);
+
+/**
+ * Return the calling thread's cached blocks to the pool
+ * Call before a worker thread exits, and before reading exact statistics.
+ *
+ * @param pool Pool to flush
+ */
+void pool_thread_cache_flush(MemoryPool* pool);
+
 /**
  * Get pool statistics
  *
+ * Allocation counts performed through thread magazines are folded into the
+ * pool when a magazine refills or flushes, so they are exact once all
+ * threads have flushed.
+ *
  * @param pool Pool to query
  * @param stats Output statistics
  */
 void pool_get_stats(const MemoryPool* pool, MemoryStats* stats);
 
+/**
+ * Get per-slab statistics
+ *
+ * @param pool Pool to query
+ * @param out Output array (may be NULL to just count slabs)
+ * @param max_slabs Capacity of out
+ * @return Total number of slabs in the pool
+ */
+size_t pool_get_slab_stats(const MemoryPool* pool, MemorySlabStats* out, size_t max_slabs);
+
 /**
  * Check for memory leaks
  * Logs any allocated blocks
@@ -96,4 +176,112 @@ bool pool_check_leaks(const MemoryPool* pool);
  */
 void pool_print_stats(const MemoryPool* pool);
 
+/**
+ * Arena (Bump) Allocator
+ *
+ * Hands out variable-size allocations by bumping a pointer through large
+ * chunks. Individual allocations are never freed; arena_reset() reclaims
+ * everything at once. Intended for short-lived scratch data such as the
+ * per-command tokenizer/parser/result allocations.
+ *
+ * Usage:
+ *   Arena* arena = arena_create(4096);
+ *   char* copy = arena_strdup(arena, "hello");
+ *   arena_reset(arena);   // copy is now invalid
+ *   arena_destroy(arena);
+ */
+
+/* Opaque arena structure */
+typedef struct Arena Arena;
+
+/* Arena statistics */
+typedef struct {
+    size_t chunk_count;        /* Chunks currently held */
+    size_t bytes_used;         /* Bytes handed out since last reset */
+    size_t bytes_reserved;     /* Bytes held across all chunks */
+    size_t peak_bytes;         /* Largest bytes_used seen before a reset */
+    size_t total_allocs;       /* Lifetime allocations */
+    size_t resets;             /* Number of resets */
+} ArenaStats;
+
+/**
+ * Create an arena
+ *
+ * @param chunk_size Size of the first chunk (bytes, 0 = default 4096)
+ * @return Arena pointer or NULL on failure
+ */
+Arena* arena_create(size_t chunk_size);
+
+/**
+ * Destroy an arena and every allocation made from it
+ *
+ * @param arena Arena to destroy
+ */
+void arena_destroy(Arena* arena);
+
+/**
+ * Allocate from arena (aligned for any type)
+ * Adds a new chunk when the current one is full.
+ *
+ * @param arena Arena to allocate from
+ * @param size Bytes to allocate
+ * @return Pointer or NULL on failure
+ */
+void* arena_alloc(Arena* arena, size_t size);
+
+/**
+ * Allocate zeroed memory from arena
+ *
+ * @param arena Arena to allocate from
+ * @param count Number of elements
+ * @param size Size of each element
+ * @return Pointer or NULL on failure
+ */
+void* arena_calloc(Arena* arena, size_t count, size_t size);
+
+/**
+ * Copy a string into the arena
+ *
+ * @param arena Arena to allocate from
+ * @param str String to copy
+ * @return Copy or NULL on failure
+ */
+char* arena_strdup(Arena* arena, const char* str);
+
+/**
+ * Copy at most len bytes of a string into the arena (always terminated)
+ *
+ * @param arena Arena to allocate from
+ * @param str String to copy
+ * @param len Maximum bytes to copy
+ * @return Copy or NULL on failure
+ */
+char* arena_strndup(Arena* arena, const char* str, size_t len);
+
+/**
+ * Release every allocation at once
+ * Keeps a single chunk large enough for the previous high-water mark so
+ * steady-state use does no further mallocs.
+ *
+ * @param arena Arena to reset
+ */
+void arena_reset(Arena* arena);
+
+/**
+ * Check whether a pointer was allocated from this arena
+ *
+ * @param arena Arena to check
+ * @param ptr Pointer to test
+ * @return true if ptr lies inside one of the arena's chunks
+ */
+bool arena_owns(const Arena* arena, const void* ptr);
+
+/**
+ * Get arena statistics
+ *
+ * @param arena Arena to query
+ * @param stats Output statistics
+ */
+void arena_get_stats(const Arena* arena, ArenaStats* stats);
+
 #endif /* MEMORY_H */
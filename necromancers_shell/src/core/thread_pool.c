@@ -0,0 +1,302 @@
+#define _POSIX_C_SOURCE 200809L  /* for sysconf */
+
+#include "core/thread_pool.h"
+#include "utils/logger.h"
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define INITIAL_DEQUE_CAPACITY 64
+
+/* Queued task */
+typedef struct {
+    ThreadTask task;
+    void* arg;
+} PoolTask;
+
+/* Ring buffer of tasks; owner works the bottom, thieves take the top */
+typedef struct {
+    pthread_mutex_t lock;
+    PoolTask* tasks;
+    size_t capacity;
+    size_t top;                /* Index of the oldest task */
+    size_t count;
+} TaskDeque;
+
+/* Worker thread and the deque it owns */
+typedef struct {
+    ThreadPool* pool;
+    size_t index;
+    pthread_t thread;
+} PoolWorker;
+
+/* Pool structure */
+struct ThreadPool {
+    PoolWorker* workers;
+    size_t worker_count;
+    size_t started_count;      /* Workers whose thread is running */
+    TaskDeque* deques;         /* One per worker, then the shared one */
+    size_t deque_count;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready; /* Signalled when a task is queued */
+    pthread_cond_t all_done;   /* Broadcast when pending drops to zero */
+    atomic_size_t queued;      /* Tasks sitting in deques */
+    size_t pending;            /* Tasks submitted and not yet finished */
+    bool stopping;
+};
+
+/* Worker the current thread runs as, if any */
+static _Thread_local ThreadPool* tls_pool = NULL;
+static _Thread_local size_t tls_index = 0;
+
+/* Helper: grow a deque, unwrapping the ring (caller holds deque lock) */
+static bool deque_grow(TaskDeque* deque) {
+    size_t capacity = deque->capacity ? deque->capacity * 2 : INITIAL_DEQUE_CAPACITY;
+    PoolTask* tasks = malloc(sizeof(PoolTask) * capacity);
+    if (!tasks) return false;
+
+    for (size_t i = 0; i < deque->count; i++) {
+        tasks[i] = deque->tasks[(deque->top + i) % deque->capacity];
+    }
+    free(deque->tasks);
+    deque->tasks = tasks;
+    deque->capacity = capacity;
+    deque->top = 0;
+    return true;
+}
+
+static bool deque_push_bottom(TaskDeque* deque, PoolTask task) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count == deque->capacity && !deque_grow(deque)) {
+        pthread_mutex_unlock(&deque->lock);
+        return false;
+    }
+    deque->tasks[(deque->top + deque->count) % deque->capacity] = task;
+    deque->count++;
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+static bool deque_pop_bottom(TaskDeque* deque, PoolTask* task) {
+    pthread_mutex_lock(&deque->lock);
+    bool found = deque->count > 0;
+    if (found) {
+        deque->count--;
+        *task = deque->tasks[(deque->top + deque->count) % deque->capacity];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static bool deque_steal_top(TaskDeque* deque, PoolTask* task) {
+    pthread_mutex_lock(&deque->lock);
+    bool found = deque->count > 0;
+    if (found) {
+        *task = deque->tasks[deque->top];
+        deque->top = (deque->top + 1) % deque->capacity;
+        deque->count--;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+/* Helper: index of the shared deque for submissions from outside */
+static inline size_t shared_deque(const ThreadPool* pool) {
+    return pool->deque_count - 1;
+}
+
+/**
+ * Helper: take the next task for the deque at home
+ * Workers pop their own newest task first; everyone else steals oldest first.
+ */
+static bool take_task(ThreadPool* pool, size_t home, bool owner, PoolTask* task) {
+    bool found = owner ? deque_pop_bottom(&pool->deques[home], task)
+                       : deque_steal_top(&pool->deques[home], task);
+    for (size_t k = 1; !found && k < pool->deque_count; k++) {
+        found = deque_steal_top(&pool->deques[(home + k) % pool->deque_count], task);
+    }
+    if (found) atomic_fetch_sub(&pool->queued, 1);
+    return found;
+}
+
+static void finish_task(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->pending--;
+    if (pool->pending == 0) {
+        pthread_cond_broadcast(&pool->all_done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void* worker_main(void* arg) {
+    PoolWorker* worker = arg;
+    ThreadPool* pool = worker->pool;
+    tls_pool = pool;
+    tls_index = worker->index;
+
+    for (;;) {
+        PoolTask task;
+        if (take_task(pool, worker->index, true, &task)) {
+            task.task(task.arg);
+            finish_task(pool);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        while (atomic_load(&pool->queued) == 0 && !pool->stopping) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        bool done = pool->stopping && atomic_load(&pool->queued) == 0;
+        pthread_mutex_unlock(&pool->lock);
+        if (done) break;
+    }
+
+    tls_pool = NULL;
+    return NULL;
+}
+
+size_t thread_pool_default_worker_count(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus <= 1) return 0;
+    return (size_t)cpus - 1;
+}
+
+/* Helper: allocate a pool with room for worker_count workers, none started */
+static ThreadPool* pool_alloc(size_t worker_count) {
+    ThreadPool* pool = calloc(1, sizeof(ThreadPool));
+    if (!pool) {
+        LOG_ERROR("Failed to allocate thread pool");
+        return NULL;
+    }
+
+    pool->deque_count = worker_count + 1;
+    pool->deques = calloc(pool->deque_count, sizeof(TaskDeque));
+    pool->workers = calloc(worker_count ? worker_count : 1, sizeof(PoolWorker));
+    if (!pool->deques || !pool->workers) {
+        LOG_ERROR("Failed to allocate thread pool workers");
+        free(pool->deques);
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < pool->deque_count; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->all_done, NULL);
+    atomic_init(&pool->queued, 0);
+    pool->worker_count = worker_count;
+    return pool;
+}
+
+ThreadPool* thread_pool_create(size_t worker_count) {
+    if (worker_count == 0) {
+        worker_count = thread_pool_default_worker_count();
+    }
+    if (worker_count > THREAD_POOL_MAX_WORKERS) {
+        worker_count = THREAD_POOL_MAX_WORKERS;
+    }
+
+    ThreadPool* pool = pool_alloc(worker_count);
+    if (!pool) return NULL;
+
+    for (size_t i = 0; i < worker_count; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->workers[i].thread, NULL, worker_main, &pool->workers[i]) != 0) {
+            /* Fewer workers still work; the waiter picks up the slack */
+            LOG_WARN("Started only %zu of %zu pool workers", i, worker_count);
+            break;
+        }
+        pool->started_count++;
+    }
+
+    LOG_DEBUG("Thread pool created (%zu workers)", pool->started_count);
+    return pool;
+}
+
+ThreadPool* thread_pool_create_inline(void) {
+    return pool_alloc(0);
+}
+
+void thread_pool_destroy(ThreadPool* pool) {
+    if (!pool) return;
+
+    thread_pool_wait(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < pool->started_count; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    for (size_t i = 0; i < pool->deque_count; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+        free(pool->deques[i].tasks);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_cond_destroy(&pool->all_done);
+    free(pool->deques);
+    free(pool->workers);
+    free(pool);
+}
+
+bool thread_pool_submit(ThreadPool* pool, ThreadTask task, void* arg) {
+    if (!pool || !task) return false;
+
+    /* Workers keep their own tasks local; everyone else shares one deque */
+    size_t home = tls_pool == pool ? tls_index : shared_deque(pool);
+    PoolTask entry = { task, arg };
+
+    /* Counted before the push so a fast thief can never finish it first */
+    pthread_mutex_lock(&pool->lock);
+    pool->pending++;
+    atomic_fetch_add(&pool->queued, 1);
+    bool pushed = deque_push_bottom(&pool->deques[home], entry);
+    if (pushed) {
+        pthread_cond_signal(&pool->work_ready);
+    } else {
+        pool->pending--;
+        atomic_fetch_sub(&pool->queued, 1);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (!pushed) {
+        LOG_ERROR("Failed to queue thread pool task");
+    }
+    return pushed;
+}
+
+void thread_pool_wait(ThreadPool* pool) {
+    if (!pool) return;
+
+    for (;;) {
+        PoolTask task;
+        if (take_task(pool, shared_deque(pool), false, &task)) {
+            task.task(task.arg);
+            finish_task(pool);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        bool done = pool->pending == 0;
+        if (!done && atomic_load(&pool->queued) == 0) {
+            /* Everything left is running on workers */
+            pthread_cond_wait(&pool->all_done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+        if (done) break;
+    }
+}
+
+size_t thread_pool_get_worker_count(const ThreadPool* pool) {
+    return pool ? pool->started_count : 0;
+}
@@ -0,0 +1,97 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Work-Stealing Thread Pool
+ *
+ * Runs short tasks on a fixed set of worker threads. Every worker owns a
+ * deque: tasks a worker submits go to the bottom of its own deque and it
+ * pops from there (newest first), while idle workers steal from the top
+ * of the others' deques (oldest first). Tasks submitted from outside the
+ * pool go to a shared deque that every worker steals from.
+ *
+ * thread_pool_wait() does not just block: the waiting thread runs queued
+ * tasks itself. A pool with zero workers is therefore valid and runs
+ * everything on the waiting thread, in submission order.
+ *
+ * Usage:
+ *   ThreadPool* pool = thread_pool_create(0);  // one worker per spare core
+ *   thread_pool_submit(pool, task, arg);
+ *   thread_pool_wait(pool);                    // returns when all tasks ran
+ *   thread_pool_destroy(pool);
+ */
+
+/* Upper bound on worker threads */
+#define THREAD_POOL_MAX_WORKERS 64
+
+/* Opaque pool structure */
+typedef struct ThreadPool ThreadPool;
+
+/* Task function */
+typedef void (*ThreadTask)(void* arg);
+
+/**
+ * Create a thread pool
+ *
+ * @param worker_count Number of worker threads; 0 picks one per online
+ *                     CPU minus the calling thread (which may be none)
+ * @return Pool pointer or NULL on failure
+ */
+ThreadPool* thread_pool_create(size_t worker_count);
+
+/**
+ * Get the worker count thread_pool_create(0) would start
+ *
+ * Lets callers with a known amount of parallel work cap it.
+ *
+ * @return Online CPUs minus the calling thread
+ */
+size_t thread_pool_default_worker_count(void);
+
+/**
+ * Create a thread pool without worker threads
+ * Tasks run on the thread calling thread_pool_wait()
+ *
+ * @return Pool pointer or NULL on failure
+ */
+ThreadPool* thread_pool_create_inline(void);
+
+/**
+ * Destroy a thread pool
+ * Runs any tasks still queued, then joins the workers
+ *
+ * @param pool Thread pool (can be NULL)
+ */
+void thread_pool_destroy(ThreadPool* pool);
+
+/**
+ * Queue a task
+ * May be called from inside a running task.
+ *
+ * @param pool Thread pool
+ * @param task Task function
+ * @param arg Argument passed to task
+ * @return true on success, false if pool or task is NULL or out of memory
+ */
+bool thread_pool_submit(ThreadPool* pool, ThreadTask task, void* arg);
+
+/**
+ * Run queued tasks until every submitted task has finished
+ * Includes tasks submitted by running tasks. Must not be called from a task.
+ *
+ * @param pool Thread pool
+ */
+void thread_pool_wait(ThreadPool* pool);
+
+/**
+ * Get number of worker threads
+ *
+ * @param pool Thread pool
+ * @return Worker count (0 for an inline pool)
+ */
+size_t thread_pool_get_worker_count(const ThreadPool* pool);
+
+#endif /* THREAD_POOL_H */
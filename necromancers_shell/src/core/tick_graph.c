@@ -0,0 +1,219 @@
+#include "core/tick_graph.h"
+#include "utils/logger.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define INITIAL_NODE_CAPACITY 8
+
+/* Graph node */
+typedef struct {
+    const char* name;
+    TickFunction run;
+    TickFunction merge;
+    void* context;
+    int* dependents;           /* Nodes waiting on this one */
+    size_t dependent_count;
+    size_t dependent_capacity;
+    size_t dependency_count;   /* Nodes this one waits on */
+    struct TickGraph* graph;
+} TickNode;
+
+/* Graph structure */
+struct TickGraph {
+    TickNode* nodes;
+    size_t node_count;
+    size_t node_capacity;
+
+    /* Per-run state, sized with the nodes */
+    atomic_size_t* remaining;  /* Unfinished dependencies per node */
+    int* order;                /* Topological order, valid when ordered */
+    bool ordered;              /* Cleared by every change to the graph */
+    ThreadPool* pool;          /* Pool of the run in progress */
+};
+
+TickGraph* tick_graph_create(void) {
+    TickGraph* graph = calloc(1, sizeof(TickGraph));
+    if (!graph) {
+        LOG_ERROR("Failed to allocate tick graph");
+        return NULL;
+    }
+    return graph;
+}
+
+void tick_graph_destroy(TickGraph* graph) {
+    if (!graph) return;
+
+    for (size_t i = 0; i < graph->node_count; i++) {
+        free(graph->nodes[i].dependents);
+    }
+    free(graph->nodes);
+    free(graph->remaining);
+    free(graph->order);
+    free(graph);
+}
+
+/* Helper: grow node storage (per-run arrays too) */
+static bool reserve_nodes(TickGraph* graph, size_t capacity) {
+    TickNode* nodes = realloc(graph->nodes, sizeof(TickNode) * capacity);
+    if (!nodes) return false;
+    graph->nodes = nodes;
+
+    atomic_size_t* remaining = realloc(graph->remaining, sizeof(atomic_size_t) * capacity);
+    if (!remaining) return false;
+    graph->remaining = remaining;
+
+    int* order = realloc(graph->order, sizeof(int) * capacity);
+    if (!order) return false;
+    graph->order = order;
+
+    graph->node_capacity = capacity;
+    return true;
+}
+
+int tick_graph_add(TickGraph* graph, const char* name,
+                   TickFunction run, TickFunction merge, void* context) {
+    if (!graph || !run) return -1;
+
+    if (graph->node_count == graph->node_capacity) {
+        size_t capacity = graph->node_capacity ? graph->node_capacity * 2 : INITIAL_NODE_CAPACITY;
+        if (!reserve_nodes(graph, capacity)) {
+            LOG_ERROR("Failed to grow tick graph to %zu nodes", capacity);
+            return -1;
+        }
+    }
+
+    TickNode* node = &graph->nodes[graph->node_count];
+    node->name = name ? name : "unnamed";
+    node->run = run;
+    node->merge = merge;
+    node->context = context;
+    node->dependents = NULL;
+    node->dependent_count = 0;
+    node->dependent_capacity = 0;
+    node->dependency_count = 0;
+    node->graph = graph;
+
+    graph->ordered = false;
+    return (int)graph->node_count++;
+}
+
+bool tick_graph_depend(TickGraph* graph, int node, int dependency) {
+    if (!graph || node < 0 || dependency < 0 || node == dependency ||
+        (size_t)node >= graph->node_count || (size_t)dependency >= graph->node_count) {
+        return false;
+    }
+
+    TickNode* before = &graph->nodes[dependency];
+    if (before->dependent_count == before->dependent_capacity) {
+        size_t capacity = before->dependent_capacity ? before->dependent_capacity * 2 : 4;
+        int* dependents = realloc(before->dependents, sizeof(int) * capacity);
+        if (!dependents) {
+            LOG_ERROR("Failed to add tick graph dependency");
+            return false;
+        }
+        before->dependents = dependents;
+        before->dependent_capacity = capacity;
+    }
+
+    before->dependents[before->dependent_count++] = node;
+    graph->nodes[node].dependency_count++;
+    graph->ordered = false;
+    return true;
+}
+
+/**
+ * Helper: compute the topological order, lowest ready node first
+ * Uses the remaining counters as scratch. Quadratic, but graphs are small
+ * and the order is cached until the graph changes.
+ */
+static bool compute_order(TickGraph* graph) {
+    size_t n = graph->node_count;
+    for (size_t i = 0; i < n; i++) {
+        atomic_store(&graph->remaining[i], graph->nodes[i].dependency_count);
+    }
+
+    for (size_t placed = 0; placed < n; placed++) {
+        size_t next = n;
+        for (size_t i = 0; i < n && next == n; i++) {
+            if (atomic_load(&graph->remaining[i]) == 0) next = i;
+        }
+        if (next == n) {
+            LOG_ERROR("Tick graph dependencies form a cycle");
+            return false;
+        }
+
+        /* Mark as placed so it is not picked again */
+        atomic_store(&graph->remaining[next], SIZE_MAX);
+        graph->order[placed] = (int)next;
+        const TickNode* node = &graph->nodes[next];
+        for (size_t d = 0; d < node->dependent_count; d++) {
+            atomic_fetch_sub(&graph->remaining[node->dependents[d]], 1);
+        }
+    }
+
+    graph->ordered = true;
+    return true;
+}
+
+static void run_node_task(void* arg);
+
+/* Helper: hand a ready node to the pool, or run it here if that fails */
+static void start_node(TickGraph* graph, TickNode* node) {
+    if (!thread_pool_submit(graph->pool, run_node_task, node)) {
+        run_node_task(node);
+    }
+}
+
+static void run_node_task(void* arg) {
+    TickNode* node = arg;
+    TickGraph* graph = node->graph;
+
+    node->run(node->context);
+
+    /* The last dependency to finish starts each dependent */
+    for (size_t d = 0; d < node->dependent_count; d++) {
+        int dependent = node->dependents[d];
+        if (atomic_fetch_sub(&graph->remaining[dependent], 1) == 1) {
+            start_node(graph, &graph->nodes[dependent]);
+        }
+    }
+}
+
+bool tick_graph_run(TickGraph* graph, ThreadPool* pool) {
+    if (!graph) return false;
+    if (!graph->ordered && !compute_order(graph)) return false;
+
+    size_t n = graph->node_count;
+    if (pool) {
+        graph->pool = pool;
+        for (size_t i = 0; i < n; i++) {
+            atomic_store(&graph->remaining[i], graph->nodes[i].dependency_count);
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (graph->nodes[i].dependency_count == 0) {
+                start_node(graph, &graph->nodes[i]);
+            }
+        }
+        thread_pool_wait(pool);
+        graph->pool = NULL;
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            TickNode* node = &graph->nodes[graph->order[i]];
+            node->run(node->context);
+        }
+    }
+
+    /* Deterministic merge, in the order nodes were added */
+    for (size_t i = 0; i < n; i++) {
+        if (graph->nodes[i].merge) {
+            graph->nodes[i].merge(graph->nodes[i].context);
+        }
+    }
+
+    return true;
+}
+
+size_t tick_graph_get_node_count(const TickGraph* graph) {
+    return graph ? graph->node_count : 0;
+}
@@ -0,0 +1,93 @@
+#ifndef TICK_GRAPH_H
+#define TICK_GRAPH_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "core/thread_pool.h"
+
+/**
+ * Tick Graph - Dependency-ordered subsystem updates
+ *
+ * Each node is a subsystem update with an optional merge step. Nodes
+ * declare which other nodes they depend on; a run executes every node
+ * once, starting a node as soon as all of its dependencies finished, so
+ * independent nodes run concurrently on a thread pool.
+ *
+ * Run functions must only touch state their node owns (or state of
+ * nodes they depend on). Anything shared is handed over in the merge
+ * step instead: merge functions run on the calling thread after every
+ * node finished, in the order the nodes were added. The result of a run
+ * is therefore the same whatever the thread count or scheduling.
+ *
+ * Usage:
+ *   TickGraph* graph = tick_graph_create();
+ *   int physics = tick_graph_add(graph, "physics", run_physics, NULL, world);
+ *   int ai = tick_graph_add(graph, "ai", run_ai, merge_ai, world);
+ *   tick_graph_depend(graph, ai, physics);   // ai runs after physics
+ *   tick_graph_run(graph, pool);             // pool may be NULL
+ *   tick_graph_destroy(graph);
+ */
+
+/* Opaque graph structure */
+typedef struct TickGraph TickGraph;
+
+/* Node run or merge function */
+typedef void (*TickFunction)(void* context);
+
+/**
+ * Create an empty tick graph
+ *
+ * @return Graph pointer or NULL on failure
+ */
+TickGraph* tick_graph_create(void);
+
+/**
+ * Destroy a tick graph
+ *
+ * @param graph Tick graph (can be NULL)
+ */
+void tick_graph_destroy(TickGraph* graph);
+
+/**
+ * Add a node
+ *
+ * @param graph Tick graph
+ * @param name Node name for logging (not copied, must outlive the graph)
+ * @param run Update function, may run on any thread
+ * @param merge Merge function run on the calling thread, or NULL
+ * @param context Argument passed to run and merge
+ * @return Node ID, or -1 on failure
+ */
+int tick_graph_add(TickGraph* graph, const char* name,
+                   TickFunction run, TickFunction merge, void* context);
+
+/**
+ * Declare that node runs only after dependency finished
+ *
+ * @param graph Tick graph
+ * @param node Dependent node ID
+ * @param dependency Node ID it waits for
+ * @return true on success, false on invalid IDs, self-dependency or no memory
+ */
+bool tick_graph_depend(TickGraph* graph, int node, int dependency);
+
+/**
+ * Run every node once, then every merge step in node order
+ *
+ * @param graph Tick graph
+ * @param pool Thread pool to run on, or NULL to run on the calling thread
+ *             in dependency order (ties broken by node order). The pool
+ *             must not be running other tasks.
+ * @return true on success, false if the dependencies form a cycle
+ */
+bool tick_graph_run(TickGraph* graph, ThreadPool* pool);
+
+/**
+ * Get number of nodes
+ *
+ * @param graph Tick graph
+ * @return Node count
+ */
+size_t tick_graph_get_node_count(const TickGraph* graph);
+
+#endif /* TICK_GRAPH_H */
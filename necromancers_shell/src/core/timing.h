@@ -57,6 +57,14 @@ double timing_get_fps(void);
  */
 double timing_get_time(void);
 
+/**
+ * Get a monotonic timestamp
+ * Safe from any thread; only differences between timestamps are meaningful.
+ *
+ * @return Nanoseconds since an arbitrary fixed point
+ */
+uint64_t timing_get_ns(void);
+
 /**
  * Sleep for specified milliseconds
  *
@@ -0,0 +1,340 @@
+#include "core/timing_wheel.h"
+#include "utils/logger.h"
+#include <stdlib.h>
+
+#define WHEEL_LEVELS 4
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1u << WHEEL_BITS)
+#define OVERFLOW_LIST (WHEEL_LEVELS * WHEEL_SLOTS)
+#define LIST_COUNT (OVERFLOW_LIST + 1)
+#define NO_TIMER UINT32_MAX
+#define INITIAL_TIMER_CAPACITY 64
+
+/* Timer node, linked into one slot list (or the free list) */
+typedef struct {
+    uint64_t at;
+    TimerCallback callback;
+    void* userdata;
+    uint32_t prev;
+    uint32_t next;
+    uint32_t generation;       /* Bumped on free, invalidates old handles */
+    uint16_t list;
+    bool active;
+} Timer;
+
+typedef struct {
+    uint32_t head;
+    uint32_t tail;
+} TimerList;
+
+/* Wheel structure */
+struct TimingWheel {
+    uint64_t now;
+    Timer* timers;
+    uint32_t capacity;
+    uint32_t free_head;
+    size_t pending;
+
+    /* Level l slot s is lists[l * WHEEL_SLOTS + s], then the overflow list */
+    TimerList lists[LIST_COUNT];
+    uint64_t occupied[WHEEL_LEVELS];   /* Non-empty slots per level */
+};
+
+/*
+ * Placement: a timer goes to the lowest level whose span covers its
+ * distance from now, in the slot of its own time at that level's
+ * resolution. Slots are therefore absolute, and on level l >= 1 the slot
+ * for the current period only ever holds timers one full turn ahead;
+ * those due within the period were moved down when it began.
+ */
+
+static uint64_t level_span(int level) {
+    return (uint64_t)1 << (WHEEL_BITS * (level + 1));
+}
+
+static uint32_t slot_of(uint64_t hour, int level) {
+    return (uint32_t)(hour >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+}
+
+static uint64_t rotate_right(uint64_t bits, uint32_t count) {
+    return count ? (bits >> count) | (bits << (64 - count)) : bits;
+}
+
+/* Helper: append a timer to a list */
+static void list_append(TimingWheel* wheel, uint16_t list, uint32_t index) {
+    TimerList* l = &wheel->lists[list];
+    Timer* timer = &wheel->timers[index];
+
+    timer->list = list;
+    timer->prev = l->tail;
+    timer->next = NO_TIMER;
+    if (l->tail != NO_TIMER) {
+        wheel->timers[l->tail].next = index;
+    } else {
+        l->head = index;
+    }
+    l->tail = index;
+
+    if (list < OVERFLOW_LIST) {
+        wheel->occupied[list / WHEEL_SLOTS] |= (uint64_t)1 << (list % WHEEL_SLOTS);
+    }
+}
+
+/* Helper: unlink a timer from its list */
+static void list_unlink(TimingWheel* wheel, uint32_t index) {
+    Timer* timer = &wheel->timers[index];
+    TimerList* l = &wheel->lists[timer->list];
+
+    if (timer->prev != NO_TIMER) {
+        wheel->timers[timer->prev].next = timer->next;
+    } else {
+        l->head = timer->next;
+    }
+    if (timer->next != NO_TIMER) {
+        wheel->timers[timer->next].prev = timer->prev;
+    } else {
+        l->tail = timer->prev;
+    }
+
+    if (l->head == NO_TIMER && timer->list < OVERFLOW_LIST) {
+        wheel->occupied[timer->list / WHEEL_SLOTS] &=
+            ~((uint64_t)1 << (timer->list % WHEEL_SLOTS));
+    }
+}
+
+/* Helper: put a timer in the list matching its distance from now */
+static void place(TimingWheel* wheel, uint32_t index) {
+    uint64_t at = wheel->timers[index].at;
+
+    /* Overdue timers fire with the current hour */
+    if (at <= wheel->now) {
+        list_append(wheel, (uint16_t)slot_of(wheel->now, 0), index);
+        return;
+    }
+
+    uint64_t delta = at - wheel->now;
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+        if (delta < level_span(level)) {
+            list_append(wheel, (uint16_t)(level * WHEEL_SLOTS + slot_of(at, level)), index);
+            return;
+        }
+    }
+    list_append(wheel, OVERFLOW_LIST, index);
+}
+
+/* Helper: empty a list and place its timers again */
+static void cascade(TimingWheel* wheel, uint16_t list) {
+    uint32_t index = wheel->lists[list].head;
+    wheel->lists[list].head = NO_TIMER;
+    wheel->lists[list].tail = NO_TIMER;
+    if (list < OVERFLOW_LIST) {
+        wheel->occupied[list / WHEEL_SLOTS] &= ~((uint64_t)1 << (list % WHEEL_SLOTS));
+    }
+
+    while (index != NO_TIMER) {
+        uint32_t next = wheel->timers[index].next;
+        place(wheel, index);
+        index = next;
+    }
+}
+
+/* Helper: earliest time in a list */
+static uint64_t list_min(const TimingWheel* wheel, uint16_t list) {
+    uint64_t earliest = TIMING_WHEEL_NEVER;
+    for (uint32_t i = wheel->lists[list].head; i != NO_TIMER; i = wheel->timers[i].next) {
+        if (wheel->timers[i].at < earliest) earliest = wheel->timers[i].at;
+    }
+    return earliest;
+}
+
+/**
+ * Helper: move the current hour forward
+ * Nothing may be due before the new hour. Slots of periods skipped on the
+ * way hold only timers a turn ahead, so only the slots of the new hour's
+ * periods need their timers moved down, coarsest level first.
+ */
+static void move_to(TimingWheel* wheel, uint64_t hour) {
+    uint64_t old = wheel->now;
+    wheel->now = hour;
+
+    int top_shift = WHEEL_BITS * WHEEL_LEVELS;
+    if ((hour >> top_shift) != (old >> top_shift)) {
+        cascade(wheel, OVERFLOW_LIST);
+    }
+
+    for (int level = WHEEL_LEVELS - 1; level >= 1; level--) {
+        int shift = WHEEL_BITS * level;
+        if ((hour >> shift) != (old >> shift)) {
+            cascade(wheel, (uint16_t)(level * WHEEL_SLOTS + slot_of(hour, level)));
+        }
+    }
+}
+
+/* Helper: release a timer node */
+static void free_timer(TimingWheel* wheel, uint32_t index) {
+    Timer* timer = &wheel->timers[index];
+    timer->active = false;
+    timer->generation++;
+    timer->next = wheel->free_head;
+    wheel->free_head = index;
+    wheel->pending--;
+}
+
+/* Helper: fire everything in the current hour's slot */
+static size_t drain(TimingWheel* wheel) {
+    uint16_t list = (uint16_t)slot_of(wheel->now, 0);
+    size_t fired = 0;
+
+    /* Callbacks may append to this slot; those fire too */
+    while (wheel->lists[list].head != NO_TIMER) {
+        uint32_t index = wheel->lists[list].head;
+        TimerCallback callback = wheel->timers[index].callback;
+        void* userdata = wheel->timers[index].userdata;
+
+        list_unlink(wheel, index);
+        free_timer(wheel, index);
+        callback(wheel->now, userdata);
+        fired++;
+    }
+
+    return fired;
+}
+
+TimingWheel* timing_wheel_create(uint64_t now) {
+    TimingWheel* wheel = calloc(1, sizeof(TimingWheel));
+    if (!wheel) {
+        LOG_ERROR("Failed to allocate timing wheel");
+        return NULL;
+    }
+
+    wheel->now = now;
+    wheel->free_head = NO_TIMER;
+    for (uint32_t i = 0; i < LIST_COUNT; i++) {
+        wheel->lists[i].head = NO_TIMER;
+        wheel->lists[i].tail = NO_TIMER;
+    }
+    return wheel;
+}
+
+void timing_wheel_destroy(TimingWheel* wheel) {
+    if (!wheel) return;
+    free(wheel->timers);
+    free(wheel);
+}
+
+/* Helper: take a node off the free list, growing storage if needed */
+static uint32_t alloc_timer(TimingWheel* wheel) {
+    if (wheel->free_head == NO_TIMER) {
+        uint32_t capacity = wheel->capacity ? wheel->capacity * 2 : INITIAL_TIMER_CAPACITY;
+        if (capacity <= wheel->capacity || capacity == NO_TIMER) return NO_TIMER;
+
+        Timer* timers = realloc(wheel->timers, sizeof(Timer) * capacity);
+        if (!timers) return NO_TIMER;
+        wheel->timers = timers;
+
+        /* Chain new nodes so the lowest index is handed out first */
+        for (uint32_t i = capacity; i-- > wheel->capacity;) {
+            timers[i].generation = 0;
+            timers[i].active = false;
+            timers[i].next = wheel->free_head;
+            wheel->free_head = i;
+        }
+        wheel->capacity = capacity;
+    }
+
+    uint32_t index = wheel->free_head;
+    wheel->free_head = wheel->timers[index].next;
+    return index;
+}
+
+TimerId timing_wheel_schedule(TimingWheel* wheel, uint64_t hour,
+                              TimerCallback callback, void* userdata) {
+    if (!wheel || !callback) return 0;
+
+    uint32_t index = alloc_timer(wheel);
+    if (index == NO_TIMER) {
+        LOG_ERROR("Failed to allocate timer");
+        return 0;
+    }
+
+    Timer* timer = &wheel->timers[index];
+    timer->at = hour;
+    timer->callback = callback;
+    timer->userdata = userdata;
+    timer->active = true;
+    wheel->pending++;
+    place(wheel, index);
+
+    return ((TimerId)timer->generation << 32) | (index + 1);
+}
+
+bool timing_wheel_cancel(TimingWheel* wheel, TimerId id) {
+    if (!wheel || id == 0) return false;
+
+    uint64_t slot = (id & 0xFFFFFFFFu);
+    if (slot == 0 || slot > wheel->capacity) return false;
+
+    uint32_t index = (uint32_t)(slot - 1);
+    Timer* timer = &wheel->timers[index];
+    if (!timer->active || timer->generation != (uint32_t)(id >> 32)) return false;
+
+    list_unlink(wheel, index);
+    free_timer(wheel, index);
+    return true;
+}
+
+size_t timing_wheel_advance(TimingWheel* wheel, uint64_t hour) {
+    if (!wheel || hour < wheel->now) return 0;
+
+    size_t fired = 0;
+    for (;;) {
+        fired += drain(wheel);
+        if (wheel->now == hour) break;
+
+        /* Jump straight to the next due timer */
+        uint64_t next = timing_wheel_next_due(wheel);
+        move_to(wheel, next < hour ? next : hour);
+    }
+
+    return fired;
+}
+
+uint64_t timing_wheel_next_due(const TimingWheel* wheel) {
+    if (!wheel || wheel->pending == 0) return TIMING_WHEEL_NEVER;
+
+    uint64_t earliest = TIMING_WHEEL_NEVER;
+
+    /* Level 0 holds one hour per slot */
+    uint32_t current = slot_of(wheel->now, 0);
+    uint64_t ahead = rotate_right(wheel->occupied[0], current);
+    if (ahead) {
+        earliest = wheel->now + (uint64_t)__builtin_ctzll(ahead);
+    }
+
+    /*
+     * Coarser levels: the first occupied slot after the current period
+     * holds the level's earliest timers; the current period's slot only
+     * has timers a full turn ahead.
+     */
+    for (int level = 1; level < WHEEL_LEVELS; level++) {
+        current = slot_of(wheel->now, level);
+        ahead = rotate_right(wheel->occupied[level], current);
+        if (!ahead) continue;
+
+        uint32_t offset = (ahead & ~(uint64_t)1) ? (uint32_t)__builtin_ctzll(ahead & ~(uint64_t)1) : 0;
+        uint16_t list = (uint16_t)(level * WHEEL_SLOTS + ((current + offset) & (WHEEL_SLOTS - 1)));
+        uint64_t candidate = list_min(wheel, list);
+        if (candidate < earliest) earliest = candidate;
+    }
+
+    uint64_t overflow = list_min(wheel, OVERFLOW_LIST);
+    return overflow < earliest ? overflow : earliest;
+}
+
+uint64_t timing_wheel_now(const TimingWheel* wheel) {
+    return wheel ? wheel->now : 0;
+}
+
+size_t timing_wheel_pending(const TimingWheel* wheel) {
+    return wheel ? wheel->pending : 0;
+}
@@ -0,0 +1,121 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Hierarchical Timing Wheel
+ *
+ * Schedules callbacks at whole game hours. Four wheels of 64 slots each
+ * cover 64, 64^2, 64^3 and 64^4 hours ahead (about 1900 years); timers
+ * further out wait in an overflow list. A timer sits in the wheel matching
+ * how far away it is and moves to finer wheels as its time approaches.
+ *
+ * Scheduling and cancelling are O(1). Advancing jumps straight to the next
+ * due timer, so its cost depends on the timers that fire (and the few
+ * that move between wheels), not on the number of hours skipped.
+ *
+ * Usage:
+ *   TimingWheel* wheel = timing_wheel_create(now_hour);
+ *   TimerId id = timing_wheel_schedule(wheel, now_hour + 24, on_day, ctx);
+ *   timing_wheel_cancel(wheel, id);               // if no longer wanted
+ *   timing_wheel_advance(wheel, now_hour + 100);  // fires what is due
+ *   timing_wheel_destroy(wheel);
+ */
+
+/* Timer handle; 0 is never a valid timer */
+typedef uint64_t TimerId;
+
+/* Returned by timing_wheel_next_due() when nothing is scheduled */
+#define TIMING_WHEEL_NEVER UINT64_MAX
+
+/* Opaque wheel structure */
+typedef struct TimingWheel TimingWheel;
+
+/**
+ * Timer callback
+ * May schedule and cancel timers, including on the wheel it runs from.
+ *
+ * @param hour Hour the timer was due (the wheel's current hour)
+ * @param userdata Pointer given when scheduling
+ */
+typedef void (*TimerCallback)(uint64_t hour, void* userdata);
+
+/**
+ * Create a timing wheel
+ *
+ * @param now Current game hour
+ * @return Wheel pointer or NULL on failure
+ */
+TimingWheel* timing_wheel_create(uint64_t now);
+
+/**
+ * Destroy a timing wheel
+ * Pending timers are dropped without firing.
+ *
+ * @param wheel Timing wheel (can be NULL)
+ */
+void timing_wheel_destroy(TimingWheel* wheel);
+
+/**
+ * Schedule a callback
+ * Timers due at the same hour fire in the order they were scheduled.
+ * A time not after the current hour fires at the next advance (or, from
+ * inside a callback, later in the same drain).
+ *
+ * @param wheel Timing wheel
+ * @param hour Game hour to fire at
+ * @param callback Function to call
+ * @param userdata Passed to callback
+ * @return Timer handle, or 0 on failure
+ */
+TimerId timing_wheel_schedule(TimingWheel* wheel, uint64_t hour,
+                              TimerCallback callback, void* userdata);
+
+/**
+ * Cancel a pending timer
+ *
+ * @param wheel Timing wheel
+ * @param id Timer handle
+ * @return true if the timer was pending, false if it already fired,
+ *         was cancelled or never existed
+ */
+bool timing_wheel_cancel(TimingWheel* wheel, TimerId id);
+
+/**
+ * Advance to an hour, firing every timer due up to and including it
+ * Timers fire in time order. Advancing backwards does nothing.
+ *
+ * @param wheel Timing wheel
+ * @param hour Hour to advance to
+ * @return Number of timers fired
+ */
+size_t timing_wheel_advance(TimingWheel* wheel, uint64_t hour);
+
+/**
+ * Get the hour of the earliest pending timer
+ *
+ * @param wheel Timing wheel
+ * @return Hour, or TIMING_WHEEL_NEVER if nothing is scheduled
+ */
+uint64_t timing_wheel_next_due(const TimingWheel* wheel);
+
+/**
+ * Get the wheel's current hour
+ *
+ * @param wheel Timing wheel
+ * @return Current hour
+ */
+uint64_t timing_wheel_now(const TimingWheel* wheel);
+
+/**
+ * Get number of pending timers
+ *
+ * @param wheel Timing wheel
+ * @return Pending timer count
+ */
+size_t timing_wheel_pending(const TimingWheel* wheel);
+
+#endif /* TIMING_WHEEL_H */
@@ -0,0 +1,88 @@
+#include "harvest_data.h"
+#include "../utils/logger.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file harvest_data.c
+ * @brief Implementation of harvest distribution loader
+ */
+
+/* Data keys in SoulType order */
+static const char* SOUL_TYPE_KEYS[SOUL_TYPE_COUNT] = {
+    "common",
+    "warrior",
+    "mage",
+    "innocent",
+    "corrupted",
+    "ancient"
+};
+
+/* Section IDs in LocationType order */
+static const char* LOCATION_TYPE_KEYS[LOCATION_TYPE_COUNT] = {
+    "graveyard",
+    "battlefield",
+    "village",
+    "crypt",
+    "ritual_site"
+};
+
+/**
+ * @brief Parse location type from section ID
+ */
+static LocationType parse_location_type(const char* type_str) {
+    for (int i = 0; i < LOCATION_TYPE_COUNT; i++) {
+        if (strcmp(type_str, LOCATION_TYPE_KEYS[i]) == 0) {
+            return (LocationType)i;
+        }
+    }
+    return LOCATION_TYPE_COUNT;
+}
+
+size_t harvest_data_load(const DataFile* data_file, SoulHarvestTable* table) {
+    if (!data_file || !table) {
+        LOG_ERROR("harvest_data_load: NULL parameter");
+        return 0;
+    }
+
+    size_t section_count = 0;
+    const DataSection** sections = data_file_get_sections(data_file, "HARVEST", &section_count);
+
+    if (!sections || section_count == 0) {
+        LOG_WARN("No HARVEST sections found in data file");
+        free((void*)sections);
+        return 0;
+    }
+
+    size_t loaded_count = 0;
+    for (size_t i = 0; i < section_count; i++) {
+        const DataSection* section = sections[i];
+
+        LocationType loc_type = parse_location_type(section->section_id);
+        if (loc_type == LOCATION_TYPE_COUNT) {
+            LOG_WARN("Unknown location type in harvest data: %s", section->section_id);
+            continue;
+        }
+
+        uint32_t weights[SOUL_TYPE_COUNT];
+        for (int t = 0; t < SOUL_TYPE_COUNT; t++) {
+            int64_t weight = data_value_get_int(data_section_get(section, SOUL_TYPE_KEYS[t]), 0);
+            weights[t] = weight < 0 ? 0 : (uint32_t)weight;
+        }
+
+        int64_t spread = data_value_get_int(data_section_get(section, "quality_spread"),
+                                            SOUL_HARVEST_DEFAULT_SPREAD);
+        if (spread < 0) spread = 0;
+        if (spread > 100) spread = 100;
+
+        if (!soul_harvest_table_set(table, loc_type, weights, (uint8_t)spread)) {
+            LOG_WARN("Invalid harvest weights for %s, keeping previous values",
+                     section->section_id);
+            continue;
+        }
+        loaded_count++;
+    }
+
+    free((void*)sections);
+    return loaded_count;
+}
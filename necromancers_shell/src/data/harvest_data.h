@@ -0,0 +1,28 @@
+#ifndef HARVEST_DATA_H
+#define HARVEST_DATA_H
+
+#include <stddef.h>
+#include "../game/souls/soul_harvest.h"
+#include "data_loader.h"
+
+/**
+ * @file harvest_data.h
+ * @brief Load soul harvest distributions from data files
+ *
+ * Reads [HARVEST:<location type>] sections from data/harvest.dat. Each
+ * section gives an integer weight per soul type (common, warrior, mage,
+ * innocent, corrupted, ancient; missing keys count as 0) and an optional
+ * quality_spread. Location types without a section keep their current
+ * distribution.
+ */
+
+/**
+ * @brief Load harvest distributions into a harvest table
+ *
+ * @param data_file Loaded data file
+ * @param table Harvest table to update
+ * @return Number of location types updated
+ */
+size_t harvest_data_load(const DataFile* data_file, SoulHarvestTable* table);
+
+#endif /* HARVEST_DATA_H */
@@ -8,6 +8,7 @@
 
 #include "save_load.h"
 #include "../utils/logger.h"
+#include "../utils/rng.h"
 #include "../game/minions/minion_manager.h"
 #include "../game/world/territory.h"
 #include "../game/world/location.h"
@@ -59,6 +60,7 @@ static bool write_minion_manager(FILE* fp, const MinionManager* mgr);
 static bool write_resources(FILE* fp, const Resources* res);
 static bool write_corruption(FILE* fp, const CorruptionState* cor);
 static bool write_consciousness(FILE* fp, const ConsciousnessState* con);
+static bool write_rng_streams(FILE* fp);
 static bool write_location(FILE* fp, const Location* loc);
 static bool write_territory_manager(FILE* fp, const TerritoryManager* mgr);
 static bool write_quest_manager(FILE* fp, const QuestManager* mgr);
@@ -68,11 +70,12 @@ static bool write_memory_manager(FILE* fp, const MemoryManager* mgr);
 static bool write_divine_council(FILE* fp, const DivineCouncil* council);
 static bool write_thessara_relationship(FILE* fp, const ThessaraRelationship* thessara);
 
-static SoulManager* read_soul_manager(FILE* fp);
+static SoulManager* read_soul_manager(FILE* fp, uint8_t version_minor);
 static MinionManager* read_minion_manager(FILE* fp);
 static bool read_resources(FILE* fp, Resources* res);
 static bool read_corruption(FILE* fp, CorruptionState* cor);
 static bool read_consciousness(FILE* fp, ConsciousnessState* con);
+static bool read_rng_streams(FILE* fp, Rng states[RNG_STREAM_COUNT]);
 static Location* read_location(FILE* fp);
 static TerritoryManager* read_territory_manager(FILE* fp);
 static QuestManager* read_quest_manager(FILE* fp);
@@ -533,6 +536,29 @@ static bool read_consciousness(FILE* fp, ConsciousnessState* con) {
            read_uint32(fp, &con->last_decay_month);
 }
 
+static bool write_rng_streams(FILE* fp) {
+    Rng states[RNG_STREAM_COUNT];
+    rng_streams_get_state(states);
+
+    bool success = true;
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        for (int w = 0; w < 4; w++) {
+            success = success && write_uint64(fp, states[i].s[w]);
+        }
+    }
+    return success;
+}
+
+static bool read_rng_streams(FILE* fp, Rng states[RNG_STREAM_COUNT]) {
+    bool success = true;
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        for (int w = 0; w < 4; w++) {
+            success = success && read_uint64(fp, &states[i].s[w]);
+        }
+    }
+    return success;
+}
+
 static bool write_soul_manager(FILE* fp, const SoulManager* mgr) {
     if (!mgr) {
         /* Write null marker */
@@ -557,7 +583,8 @@ static bool write_soul_manager(FILE* fp, const SoulManager* mgr) {
         if (!write_uint32(fp, soul->id) ||
             !write_uint32(fp, (uint32_t)soul->type) ||
             !write_uint8(fp, soul->quality) ||
-            !write_string(fp, soul->memories, SOUL_MEMORY_MAX_LENGTH) ||
+            !write_uint8(fp, soul->memory_template) ||
+            !write_uint8(fp, soul->memory_degradation) ||
             !write_uint32(fp, soul->energy) ||
             !write_bool(fp, soul->bound) ||
             !write_uint32(fp, soul->bound_minion_id) ||
@@ -571,7 +598,7 @@ static bool write_soul_manager(FILE* fp, const SoulManager* mgr) {
     return true;
 }
 
-static SoulManager* read_soul_manager(FILE* fp) {
+static SoulManager* read_soul_manager(FILE* fp, uint8_t version_minor) {
     uint32_t count;
     if (!read_uint32(fp, &count)) {
         return NULL;
@@ -595,11 +622,30 @@ static SoulManager* read_soul_manager(FILE* fp) {
 
         uint32_t type_u32;
         uint64_t timestamp_u64;
+        bool memories_ok;
 
         if (!read_uint32(fp, &soul->id) ||
             !read_uint32(fp, &type_u32) ||
-            !read_uint8(fp, &soul->quality) ||
-            !read_string(fp, soul->memories, SOUL_MEMORY_MAX_LENGTH) ||
+            !read_uint8(fp, &soul->quality)) {
+            free(soul);
+            soul_manager_destroy(mgr);
+            return NULL;
+        }
+
+        if (version_minor == 0) {
+            /* 1.0 saves stored the memory text itself */
+            char memories[SOUL_MEMORY_MAX_LENGTH];
+            memories_ok = read_string(fp, memories, sizeof(memories));
+            if (memories_ok && !soul_memory_from_text(memories, &soul->memory_template,
+                                                      &soul->memory_degradation)) {
+                soul_generate_memories(soul, (SoulType)type_u32, soul->quality);
+            }
+        } else {
+            memories_ok = read_uint8(fp, &soul->memory_template) &&
+                          read_uint8(fp, &soul->memory_degradation);
+        }
+
+        if (!memories_ok ||
             !read_uint32(fp, &soul->energy) ||
             !read_bool(fp, &soul->bound) ||
             !read_uint32(fp, &soul->bound_minion_id) ||
@@ -1994,6 +2040,8 @@ bool save_game(const GameState* state, const char* filepath) {
     success = success && write_uint32(fp, state->civilian_kills);
     success = success && write_bool(fp, state->game_completed);
     success = success && write_uint32(fp, (uint32_t)state->ending_achieved);
+    success = success && write_uint64(fp, state->game_seed);
+    success = success && write_rng_streams(fp);
 
     if (!success) {
         LOG_ERROR("Failed to write game state data");
@@ -2176,7 +2224,7 @@ GameState* load_game(const char* filepath, char* error_buffer, size_t error_size
     }
 
     /* Read managers */
-    state->souls = read_soul_manager(mem_fp);
+    state->souls = read_soul_manager(mem_fp, header.version_minor);
     state->minions = read_minion_manager(mem_fp);
     state->territory = read_territory_manager(mem_fp);
     state->quests = read_quest_manager(mem_fp);
@@ -2192,6 +2240,9 @@ GameState* load_game(const char* filepath, char* error_buffer, size_t error_size
     success = success && read_corruption(mem_fp, &state->corruption);
     success = success && read_consciousness(mem_fp, &state->consciousness);
 
+    /* Harvest odds come from data files, not the save */
+    game_state_init_harvest(state);
+
     /* Read scalar fields */
     success = success && read_uint32(mem_fp, &state->current_location_id);
     success = success && read_uint32(mem_fp, &state->player_level);
@@ -2207,6 +2258,23 @@ GameState* load_game(const char* filepath, char* error_buffer, size_t error_size
         state->ending_achieved = (EndingType)ending_u32;
     }
 
+    /* Saves before 1.2 have no game seed; start a fresh one. Saves before
+     * 1.3 have only the seed, so their streams restart from the first draw */
+    uint64_t game_seed = (uint64_t)time(NULL);
+    if (header.version_minor >= 2) {
+        success = success && read_uint64(mem_fp, &game_seed);
+    }
+    if (header.version_minor >= 3) {
+        Rng streams[RNG_STREAM_COUNT];
+        success = success && read_rng_streams(mem_fp, streams);
+        if (success) {
+            state->game_seed = game_seed;
+            rng_streams_set_state(game_seed, streams);
+        }
+    } else if (success) {
+        game_state_set_seed(state, game_seed);
+    }
+
     if (!success) {
         if (error_buffer) {
             snprintf(error_buffer, error_size, "Failed to deserialize game state");
@@ -2340,6 +2408,7 @@ bool save_metadata_json(const GameState* state, const char* filepath) {
     fprintf(fp, "  \"souls_collected\": %zu,\n", soul_manager_count((SoulManager*)state->souls));
     fprintf(fp, "  \"minions_raised\": %zu,\n", minion_manager_count((MinionManager*)state->minions));
     fprintf(fp, "  \"current_location\": \"%s\",\n", loc_name);
+    fprintf(fp, "  \"game_seed\": %llu,\n", (unsigned long long)state->game_seed);
     fprintf(fp, "  \"game_completed\": %s\n", state->game_completed ? "true" : "false");
     fprintf(fp, "}\n");
 
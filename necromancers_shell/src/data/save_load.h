@@ -23,7 +23,7 @@
  * @brief Current save file format version
  */
 #define SAVE_VERSION_MAJOR 1
-#define SAVE_VERSION_MINOR 0
+#define SAVE_VERSION_MINOR 3
 #define SAVE_VERSION_PATCH 0
 
 /**
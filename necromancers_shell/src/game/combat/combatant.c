@@ -1,13 +1,14 @@
 #include "combatant.h"
 #include "../minions/minion.h"
 #include "enemy.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
 /* Helper to get random number in range */
 static uint8_t random_range(uint8_t min, uint8_t max) {
-    return min + (rand() % (max - min + 1));
+    return (uint8_t)(min + rng_range(rng_stream(RNG_STREAM_COMBAT), (uint32_t)(max - min + 1)));
 }
 
 Combatant* combatant_create_from_minion(void* minion_entity, bool is_player_controlled) {
@@ -6,6 +6,7 @@
 #include "damage.h"
 #include "combatant.h"
 #include "combat.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -18,7 +19,7 @@
  * @brief Roll for critical hit
  */
 bool damage_roll_critical(void) {
-    return ((float)rand() / (float)RAND_MAX) < CRIT_CHANCE;
+    return rng_double(rng_stream(RNG_STREAM_COMBAT)) < CRIT_CHANCE;
 }
 
 /**
@@ -1,4 +1,5 @@
 #include "encounter.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -92,7 +93,7 @@ EncounterTemplate* encounter_generate(uint8_t difficulty, LocationType location_
     }
 
     /* Pick random matching template */
-    uint8_t target_index = rand() % matching_count;
+    uint8_t target_index = (uint8_t)rng_range(rng_stream(RNG_STREAM_ENCOUNTER), matching_count);
     uint8_t seen = 0;
 
     for (size_t i = 0; i < TEMPLATE_COUNT; i++) {
@@ -1,4 +1,5 @@
 #include "enemy_ai.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -52,7 +53,7 @@ Combatant* ai_find_random_player(const CombatState* combat) {
     if (alive_count == 0) return NULL;
 
     /* Pick random index */
-    uint8_t target_index = rand() % alive_count;
+    uint8_t target_index = (uint8_t)rng_range(rng_stream(RNG_STREAM_AI), alive_count);
 
     /* Find that player */
     uint8_t alive_seen = 0;
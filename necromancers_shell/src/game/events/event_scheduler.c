@@ -8,12 +8,17 @@
 #include "../resources/resources.h"
 #include "../resources/corruption.h"
 #include "../../utils/logger.h"
+#include "../../utils/hash_table.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
 
 #define MAX_EVENTS 256
 #define MAX_FLAGS 128
+#define FLAG_WORDS (MAX_FLAGS / 64)
+#define EVENT_WORDS (MAX_EVENTS / 64)
+#define NO_FLAG (-1)
 
 /**
  * @brief Flag structure for game state tracking
@@ -23,15 +28,49 @@ typedef struct {
     bool set;
 } GameFlag;
 
+/**
+ * @brief Index entry: an event waiting on a key value
+ */
+typedef struct {
+    uint32_t key;
+    uint16_t event;
+} TriggerKey;
+
+/**
+ * @brief Events sorted by one key
+ */
+typedef struct {
+    TriggerKey keys[MAX_EVENTS];
+    size_t count;
+} TriggerIndex;
+
 /**
  * @brief Event scheduler structure
+ *
+ * Between checks, every untriggered event evaluated false at the last
+ * check unless it is pending. An event can only become true when one of
+ * its inputs flips, so a check wakes just the events whose keys lie in
+ * the range an input moved through, plus the pending ones.
  */
 struct EventScheduler {
     ScheduledEvent events[MAX_EVENTS];
+    int16_t event_flags[MAX_EVENTS];    /**< Interned required_flag, NO_FLAG if none */
     size_t event_count;
 
     GameFlag flags[MAX_FLAGS];
     size_t flag_count;
+    HashTable* flag_index;              /**< Name -> flag index + 1 */
+    uint64_t flags_changed[FLAG_WORDS]; /**< Set since the last check */
+
+    /* Indexes by what flips an event's condition to true */
+    TriggerIndex by_day;                /**< Day triggers, key: trigger day */
+    TriggerIndex by_min_day;            /**< Key: min_day (rising day) */
+    TriggerIndex by_max_day;            /**< Key: max_day (day going back) */
+    TriggerIndex by_corruption;         /**< Key: corruption threshold */
+    TriggerIndex by_location;           /**< Key: location ID */
+    TriggerIndex by_flag;               /**< Key: interned flag */
+
+    uint64_t pending[EVENT_WORDS];      /**< Events to evaluate regardless */
 
     uint32_t last_check_day;
     uint8_t last_check_corruption;
@@ -39,20 +78,18 @@ struct EventScheduler {
 };
 
 EventScheduler* event_scheduler_create(void) {
-    EventScheduler* scheduler = malloc(sizeof(EventScheduler));
+    EventScheduler* scheduler = calloc(1, sizeof(EventScheduler));
     if (!scheduler) {
         LOG_ERROR("Failed to allocate EventScheduler");
         return NULL;
     }
 
-    scheduler->event_count = 0;
-    scheduler->flag_count = 0;
-    scheduler->last_check_day = 0;
-    scheduler->last_check_corruption = 0;
-    scheduler->last_check_location = 0;
-
-    memset(scheduler->events, 0, sizeof(scheduler->events));
-    memset(scheduler->flags, 0, sizeof(scheduler->flags));
+    scheduler->flag_index = hash_table_create(MAX_FLAGS);
+    if (!scheduler->flag_index) {
+        LOG_ERROR("Failed to allocate EventScheduler flag index");
+        free(scheduler);
+        return NULL;
+    }
 
     LOG_DEBUG("EventScheduler created");
     return scheduler;
@@ -61,10 +98,93 @@ EventScheduler* event_scheduler_create(void) {
 void event_scheduler_destroy(EventScheduler* scheduler) {
     if (scheduler) {
         LOG_DEBUG("EventScheduler destroyed");
+        hash_table_destroy(scheduler->flag_index);
         free(scheduler);
     }
 }
 
+/**
+ * @brief Get the index of a flag, adding it unset if new
+ *
+ * @return Flag index, or NO_FLAG if the flag list is full
+ */
+static int intern_flag(EventScheduler* scheduler, const char* flag_name) {
+    void* found = hash_table_get(scheduler->flag_index, flag_name);
+    if (found) {
+        return (int)((uintptr_t)found - 1);
+    }
+
+    if (scheduler->flag_count >= MAX_FLAGS) {
+        LOG_ERROR("Flag list is full");
+        return NO_FLAG;
+    }
+
+    size_t index = scheduler->flag_count;
+    GameFlag* flag = &scheduler->flags[index];
+    snprintf(flag->name, sizeof(flag->name), "%s", flag_name);
+    flag->set = false;
+
+    /* Keyed by the stored (possibly truncated) name, like lookups compare */
+    if (!hash_table_put(scheduler->flag_index, flag->name, (void*)(uintptr_t)(index + 1))) {
+        LOG_ERROR("Failed to index flag: %s", flag_name);
+        return NO_FLAG;
+    }
+    scheduler->flag_count++;
+    return (int)index;
+}
+
+static int find_flag(const EventScheduler* scheduler, const char* flag_name) {
+    void* found = hash_table_get(scheduler->flag_index, flag_name);
+    return found ? (int)((uintptr_t)found - 1) : NO_FLAG;
+}
+
+static inline bool flag_is_set(const EventScheduler* scheduler, int flag) {
+    return flag != NO_FLAG && scheduler->flags[flag].set;
+}
+
+static inline void mark_pending(EventScheduler* scheduler, size_t event) {
+    scheduler->pending[event / 64] |= UINT64_C(1) << (event % 64);
+}
+
+/**
+ * @brief First entry with key >= key
+ */
+static size_t index_lower_bound(const TriggerIndex* index, uint32_t key) {
+    size_t lo = 0, hi = index->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index->keys[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void index_insert(TriggerIndex* index, uint32_t key, size_t event) {
+    /* After equal keys, so events with one key stay in registration order */
+    size_t at = index_lower_bound(index, key);
+    while (at < index->count && index->keys[at].key == key) at++;
+
+    memmove(&index->keys[at + 1], &index->keys[at],
+            sizeof(TriggerKey) * (index->count - at));
+    index->keys[at].key = key;
+    index->keys[at].event = (uint16_t)event;
+    index->count++;
+}
+
+/**
+ * @brief Mark every event with a key in [low, high] pending
+ */
+static void index_wake(EventScheduler* scheduler, const TriggerIndex* index,
+                       uint32_t low, uint32_t high) {
+    for (size_t i = index_lower_bound(index, low);
+         i < index->count && index->keys[i].key <= high; i++) {
+        mark_pending(scheduler, index->keys[i].event);
+    }
+}
+
 bool event_scheduler_register(EventScheduler* scheduler, ScheduledEvent event) {
     if (!scheduler) {
         return false;
@@ -75,9 +195,37 @@ bool event_scheduler_register(EventScheduler* scheduler, ScheduledEvent event) {
         return false;
     }
 
-    scheduler->events[scheduler->event_count] = event;
+    size_t i = scheduler->event_count;
+    scheduler->events[i] = event;
+    scheduler->event_flags[i] = NO_FLAG;
     scheduler->event_count++;
 
+    /* Flag events keep the flag name in required_flag */
+    if (event.requires_flag || event.trigger_type == EVENT_TRIGGER_FLAG) {
+        int flag = intern_flag(scheduler, event.required_flag);
+        scheduler->event_flags[i] = (int16_t)flag;
+        if (flag != NO_FLAG) index_insert(&scheduler->by_flag, (uint32_t)flag, i);
+    }
+
+    switch (event.trigger_type) {
+        case EVENT_TRIGGER_DAY:
+            index_insert(&scheduler->by_day, event.trigger_value, i);
+            break;
+        case EVENT_TRIGGER_CORRUPTION:
+            index_insert(&scheduler->by_corruption, event.trigger_value, i);
+            break;
+        case EVENT_TRIGGER_LOCATION:
+            index_insert(&scheduler->by_location, event.trigger_value, i);
+            break;
+        default:
+            break;
+    }
+    if (event.min_day > 0) index_insert(&scheduler->by_min_day, event.min_day, i);
+    if (event.max_day > 0) index_insert(&scheduler->by_max_day, event.max_day, i);
+
+    /* Evaluated in full at the next check */
+    mark_pending(scheduler, i);
+
     LOG_DEBUG("Event registered: %s (ID: %u, trigger: %d, value: %u)",
                event.name, event.id, event.trigger_type, event.trigger_value);
 
@@ -87,13 +235,15 @@ bool event_scheduler_register(EventScheduler* scheduler, ScheduledEvent event) {
 /**
  * @brief Check if event's trigger conditions are met
  *
- * @param event Event to check
- * @param state Game state
  * @param scheduler Scheduler (for flag checking)
+ * @param index Event index
+ * @param state Game state
  * @return true if conditions met, false otherwise
  */
-static bool event_check_conditions(const ScheduledEvent* event, const GameState* state,
-                                  const EventScheduler* scheduler) {
+static bool event_check_conditions(const EventScheduler* scheduler, size_t index,
+                                   const GameState* state) {
+    const ScheduledEvent* event = &scheduler->events[index];
+
     /* Check if already triggered */
     if (event->triggered) {
         return false;
@@ -109,7 +259,7 @@ static bool event_check_conditions(const ScheduledEvent* event, const GameState*
 
     /* Check required flag */
     if (event->requires_flag) {
-        if (!event_scheduler_has_flag(scheduler, event->required_flag)) {
+        if (!flag_is_set(scheduler, scheduler->event_flags[index])) {
             return false;
         }
     }
@@ -127,7 +277,7 @@ static bool event_check_conditions(const ScheduledEvent* event, const GameState*
 
         case EVENT_TRIGGER_FLAG:
             /* Flag name is stored in required_flag field */
-            return event_scheduler_has_flag(scheduler, event->required_flag);
+            return flag_is_set(scheduler, scheduler->event_flags[index]);
 
         case EVENT_TRIGGER_QUEST:
             /* Quest completion checking would go here */
@@ -140,27 +290,50 @@ static bool event_check_conditions(const ScheduledEvent* event, const GameState*
 }
 
 /**
- * @brief Compare events for priority sorting
+ * @brief Whether event a runs before event b (priority, then ID)
  */
-static int event_compare_priority(const void* a, const void* b) {
-    const ScheduledEvent* event_a = (const ScheduledEvent*)a;
-    const ScheduledEvent* event_b = (const ScheduledEvent*)b;
+static bool event_runs_before(const ScheduledEvent* a, const ScheduledEvent* b) {
+    if (a->priority != b->priority) {
+        return a->priority > b->priority;
+    }
+    return a->id < b->id;
+}
 
-    /* Higher priority first */
-    if (event_a->priority > event_b->priority) {
-        return -1;
-    } else if (event_a->priority < event_b->priority) {
-        return 1;
+/**
+ * @brief Mark pending every event whose inputs changed since the last check
+ */
+static void wake_changed_events(EventScheduler* scheduler, const GameState* state) {
+    uint32_t day = state->resources.day_count;
+    uint32_t last_day = scheduler->last_check_day;
+    if (day != last_day) {
+        index_wake(scheduler, &scheduler->by_day, day, day);
+        if (day > last_day) {
+            index_wake(scheduler, &scheduler->by_min_day, last_day + 1, day);
+        } else {
+            index_wake(scheduler, &scheduler->by_max_day, day, last_day - 1);
+        }
     }
 
-    /* If same priority, sort by ID */
-    if (event_a->id < event_b->id) {
-        return -1;
-    } else if (event_a->id > event_b->id) {
-        return 1;
+    uint8_t corruption = state->corruption.corruption;
+    if (corruption > scheduler->last_check_corruption) {
+        index_wake(scheduler, &scheduler->by_corruption,
+                   scheduler->last_check_corruption + 1u, corruption);
     }
 
-    return 0;
+    if (state->current_location_id != scheduler->last_check_location) {
+        index_wake(scheduler, &scheduler->by_location,
+                   state->current_location_id, state->current_location_id);
+    }
+
+    for (size_t w = 0; w < FLAG_WORDS; w++) {
+        uint64_t changed = scheduler->flags_changed[w];
+        while (changed) {
+            uint32_t flag = (uint32_t)(w * 64 + (size_t)__builtin_ctzll(changed));
+            index_wake(scheduler, &scheduler->by_flag, flag, flag);
+            changed &= changed - 1;
+        }
+        scheduler->flags_changed[w] = 0;
+    }
 }
 
 uint32_t event_scheduler_check_triggers(EventScheduler* scheduler, GameState* state) {
@@ -168,61 +341,93 @@ uint32_t event_scheduler_check_triggers(EventScheduler* scheduler, GameState* st
         return 0;
     }
 
+    wake_changed_events(scheduler, state);
+
+    /* Inputs as evaluated; changes made by callbacks wake events next time */
+    scheduler->last_check_day = state->resources.day_count;
+    scheduler->last_check_corruption = state->corruption.corruption;
+    scheduler->last_check_location = state->current_location_id;
+
     uint32_t triggered_count = 0;
     ScheduledEvent* triggered_events[MAX_EVENTS];
     size_t triggered_events_count = 0;
 
-    /* Check all events for trigger conditions */
-    for (size_t i = 0; i < scheduler->event_count; i++) {
-        ScheduledEvent* event = &scheduler->events[i];
-
-        if (event_check_conditions(event, state, scheduler)) {
-            triggered_events[triggered_events_count++] = event;
+    /* Check only the woken events, in registration order */
+    for (size_t w = 0; w < EVENT_WORDS; w++) {
+        uint64_t pending = scheduler->pending[w];
+        scheduler->pending[w] = 0;
+        while (pending) {
+            size_t i = w * 64 + (size_t)__builtin_ctzll(pending);
+            pending &= pending - 1;
+
+            if (!event_check_conditions(scheduler, i, state)) continue;
+
+            /* Insert by priority; the list is short */
+            ScheduledEvent* event = &scheduler->events[i];
+            size_t at = triggered_events_count++;
+            while (at > 0 && event_runs_before(event, triggered_events[at - 1])) {
+                triggered_events[at] = triggered_events[at - 1];
+                at--;
+            }
+            triggered_events[at] = event;
         }
     }
 
-    /* Sort triggered events by priority */
-    if (triggered_events_count > 0) {
-        qsort(triggered_events, triggered_events_count, sizeof(ScheduledEvent*),
-              event_compare_priority);
+    /* Execute triggered events in priority order */
+    for (size_t i = 0; i < triggered_events_count; i++) {
+        ScheduledEvent* event = triggered_events[i];
 
-        /* Execute triggered events in priority order */
-        for (size_t i = 0; i < triggered_events_count; i++) {
-            ScheduledEvent* event = triggered_events[i];
+        LOG_INFO("Triggering event: %s (Day %u)",
+                  event->name, state->resources.day_count);
 
-            LOG_INFO("Triggering event: %s (Day %u)",
-                      event->name, state->resources.day_count);
+        /* Mark as triggered */
+        event->triggered = true;
 
-            /* Mark as triggered */
-            event->triggered = true;
+        /* Execute callback if present */
+        if (event->callback) {
+            bool success = event->callback(state, event->id);
+            event->completed = success;
 
-            /* Execute callback if present */
-            if (event->callback) {
-                bool success = event->callback(state, event->id);
-                event->completed = success;
-
-                if (success) {
-                    LOG_DEBUG("Event %s completed successfully", event->name);
-                    triggered_count++;
-                } else {
-                    LOG_WARN("Event %s callback failed", event->name);
-                }
-            } else {
-                /* No callback, just mark as completed */
-                event->completed = true;
+            if (success) {
+                LOG_DEBUG("Event %s completed successfully", event->name);
                 triggered_count++;
+            } else {
+                LOG_WARN("Event %s callback failed", event->name);
             }
+        } else {
+            /* No callback, just mark as completed */
+            event->completed = true;
+            triggered_count++;
         }
     }
 
-    /* Update last check values */
-    scheduler->last_check_day = state->resources.day_count;
-    scheduler->last_check_corruption = state->corruption.corruption;
-    scheduler->last_check_location = state->current_location_id;
-
     return triggered_count;
 }
 
+/**
+ * @brief Smallest key above after_day of an untriggered event in index
+ */
+static uint32_t index_next_day(const EventScheduler* scheduler, const TriggerIndex* index,
+                               uint32_t after_day) {
+    if (after_day == UINT32_MAX) return UINT32_MAX;
+    for (size_t i = index_lower_bound(index, after_day + 1); i < index->count; i++) {
+        if (!scheduler->events[index->keys[i].event].triggered) {
+            return index->keys[i].key;
+        }
+    }
+    return UINT32_MAX;
+}
+
+uint32_t event_scheduler_next_day(const EventScheduler* scheduler, uint32_t after_day) {
+    if (!scheduler) {
+        return UINT32_MAX;
+    }
+
+    uint32_t next = index_next_day(scheduler, &scheduler->by_day, after_day);
+    uint32_t gated = index_next_day(scheduler, &scheduler->by_min_day, after_day);
+    return gated < next ? gated : next;
+}
+
 bool event_scheduler_was_triggered(const EventScheduler* scheduler, uint32_t event_id) {
     if (!scheduler) {
         return false;
@@ -338,6 +543,7 @@ bool event_scheduler_reset_event(EventScheduler* scheduler, uint32_t event_id) {
 
             event->triggered = false;
             event->completed = false;
+            mark_pending(scheduler, i);
             LOG_DEBUG("Event reset: %s", event->name);
             return true;
         }
@@ -351,26 +557,17 @@ bool event_scheduler_set_flag(EventScheduler* scheduler, const char* flag_name)
         return false;
     }
 
-    /* Check if flag already exists */
-    for (size_t i = 0; i < scheduler->flag_count; i++) {
-        if (strcmp(scheduler->flags[i].name, flag_name) == 0) {
-            scheduler->flags[i].set = true;
-            LOG_DEBUG("Flag set: %s", flag_name);
-            return true;
-        }
-    }
-
-    /* Add new flag */
-    if (scheduler->flag_count >= MAX_FLAGS) {
-        LOG_ERROR("Flag list is full");
+    int flag = intern_flag(scheduler, flag_name);
+    if (flag == NO_FLAG) {
         return false;
     }
 
-    snprintf(scheduler->flags[scheduler->flag_count].name, sizeof(scheduler->flags[scheduler->flag_count].name), "%s", flag_name);
-    scheduler->flags[scheduler->flag_count].set = true;
-    scheduler->flag_count++;
+    if (!scheduler->flags[flag].set) {
+        scheduler->flags[flag].set = true;
+        scheduler->flags_changed[flag / 64] |= UINT64_C(1) << (flag % 64);
+    }
 
-    LOG_DEBUG("Flag created and set: %s", flag_name);
+    LOG_DEBUG("Flag set: %s", flag_name);
     return true;
 }
 
@@ -379,11 +576,5 @@ bool event_scheduler_has_flag(const EventScheduler* scheduler, const char* flag_
         return false;
     }
 
-    for (size_t i = 0; i < scheduler->flag_count; i++) {
-        if (strcmp(scheduler->flags[i].name, flag_name) == 0) {
-            return scheduler->flags[i].set;
-        }
-    }
-
-    return false;
+    return flag_is_set(scheduler, find_flag(scheduler, flag_name));
 }
@@ -110,12 +110,30 @@ bool event_scheduler_register(EventScheduler* scheduler, ScheduledEvent event);
  * Called from game_state_advance_time() and other state change functions.
  * Executes all triggered events in priority order.
  *
+ * Events are indexed by trigger day, corruption threshold, location, day
+ * range and flag, so a check only evaluates events whose inputs changed
+ * since the previous check (plus newly registered or reset ones).
+ *
  * @param scheduler Event scheduler
  * @param state Game state
  * @return Number of events triggered
  */
 uint32_t event_scheduler_check_triggers(EventScheduler* scheduler, GameState* state);
 
+/**
+ * @brief Get the next day on which a pending event could trigger
+ *
+ * Considers the trigger day of day events and the minimum day of every
+ * pending event. Other conditions do not change while time passes, so
+ * checking triggers on the returned day and at the end of an interval
+ * is equivalent to checking every day.
+ *
+ * @param scheduler Event scheduler
+ * @param after_day Only days after this one are considered
+ * @return Next day, or UINT32_MAX if none
+ */
+uint32_t event_scheduler_next_day(const EventScheduler* scheduler, uint32_t after_day);
+
 /**
  * @brief Check if specific event has been triggered
  *
@@ -7,11 +7,17 @@
 #include "minions/minion_manager.h"
 #include "events/event_scheduler.h"
 #include "endings/ending_system.h"
+#include "narrative/purge_system.h"
+#include "narrative/reformation_program.h"
+#include "network/split_routing.h"
 #include "../data/data_loader.h"
 #include "../data/location_data.h"
+#include "../data/harvest_data.h"
+#include "../core/tick_graph.h"
 #include "../utils/logger.h"
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 GameState* game_state_create(void) {
     GameState* state = calloc(1, sizeof(GameState));
@@ -437,10 +443,7 @@ GameState* game_state_create(void) {
     /* Initialize Week 35-37 Archon Path systems */
     extern DivineJudgmentState* divine_judgment_create(void);
     extern NetworkPatchingState* network_patching_create(void);
-    extern SplitRoutingManager* split_routing_manager_create(void);
-    extern PurgeState* purge_system_create(void);
     extern ArchonState* archon_state_create(void);
-    extern ReformationProgram* reformation_program_create(void);
 
     state->divine_judgment = divine_judgment_create();
     state->network_patching = network_patching_create();
@@ -469,6 +472,12 @@ GameState* game_state_create(void) {
     /* Initialize consciousness */
     consciousness_init(&state->consciousness);
 
+    /* Initialize harvest odds */
+    game_state_init_harvest(state);
+
+    /* Seed random streams */
+    game_state_set_seed(state, (uint64_t)time(NULL));
+
     /* Initialize combat (NULL - not in combat) */
     state->combat = NULL;
 
@@ -494,6 +503,10 @@ void game_state_destroy(GameState* state) {
         return;
     }
 
+    /* Stop time kernel workers first, nothing runs on them between advances */
+    thread_pool_destroy(state->tick_pool);
+    timing_wheel_destroy(state->timers);
+
     /* Destroy combat state if active */
     if (state->combat) {
         /* Forward declaration - will include combat.h when building */
@@ -505,10 +518,7 @@ void game_state_destroy(GameState* state) {
     extern void archon_trial_manager_destroy(ArchonTrialManager*);
     extern void divine_judgment_destroy(DivineJudgmentState*);
     extern void network_patching_destroy(NetworkPatchingState*);
-    extern void split_routing_manager_destroy(SplitRoutingManager*);
-    extern void purge_system_destroy(PurgeState*);
     extern void archon_state_destroy(ArchonState*);
-    extern void reformation_program_destroy(ReformationProgram*);
 
     reformation_program_destroy(state->reformation_program);
     archon_state_destroy(state->archon_state);
@@ -547,6 +557,33 @@ void game_state_destroy(GameState* state) {
 
 /* game_state_get_instance and game_state_set_instance are now in game_globals.c */
 
+void game_state_init_harvest(GameState* state) {
+    if (!state) {
+        return;
+    }
+
+    soul_harvest_table_init_defaults(&state->harvest_table);
+
+    DataFile* harvest_data = data_file_load("data/harvest.dat");
+    if (harvest_data) {
+        size_t loaded = harvest_data_load(harvest_data, &state->harvest_table);
+        LOG_INFO("Loaded %zu harvest distributions from data/harvest.dat", loaded);
+        data_file_destroy(harvest_data);
+    } else {
+        LOG_WARN("Could not load data/harvest.dat, using default harvest odds");
+    }
+}
+
+void game_state_set_seed(GameState* state, uint64_t seed) {
+    if (!state) {
+        return;
+    }
+
+    state->game_seed = seed;
+    rng_streams_seed(seed);
+    LOG_INFO("Game seed: %llu", (unsigned long long)seed);
+}
+
 uint32_t game_state_next_soul_id(GameState* state) {
     if (!state) {
         return 0;
@@ -601,42 +638,328 @@ bool game_state_move_to_location(GameState* state, uint32_t location_id) {
     return true;
 }
 
-void game_state_advance_time(GameState* state, uint32_t hours) {
-    if (!state) {
-        return;
+/*
+ * Time advances as a discrete-event simulation. Each subsystem may report
+ * the next game hour at which something happens to it that others could
+ * observe. The kernel moves every subsystem straight to the earliest such
+ * point, lets the event scheduler look at the world there, and repeats.
+ * A long wait costs one step per point rather than work per hour.
+ *
+ * Within a step the subsystems are independent of each other, so they run
+ * as a tick graph on the state's thread pool. Each only touches its own
+ * state during the step and neither logs nor draws from the thread-local
+ * rng_stream() generators; randomness comes from generators seeded in the
+ * TimeStep on this thread, and anything to report waits for the merge,
+ * which runs on this thread in table order.
+ */
+
+#define MANA_REGEN_PER_HOUR 10
+#define HOURS_PER_MONTH (24 * 30)
+#define HOURS_PER_YEAR (HOURS_PER_MONTH * 12)
+#define SECONDS_PER_HOUR 3600
+
+/* No upcoming point of interest */
+#define NO_TIME UINT64_MAX
+
+/**
+ * @brief One step of the time kernel, shared by all subsystem nodes
+ *
+ * Nodes only write the result fields of their own subsystem.
+ */
+typedef struct {
+    GameState* state;
+    uint64_t from;              /**< Game hour the step starts at */
+    uint64_t to;                /**< Game hour the step ends at; the clock already reads it */
+    Rng death_rng;              /**< Death network generator, seeded per step */
+    uint64_t death_events;      /**< Random death events this step */
+    size_t reinforcements;      /**< Locations whose reinforcements arrived */
+    bool purge_began;           /**< Purge countdown reached zero this step */
+    int souls_reunified;        /**< Split-routed souls reunified this step */
+} TimeStep;
+
+/**
+ * @brief A subsystem driven by the time kernel
+ */
+typedef struct {
+    const char* name;
+    /** Next game hour after now worth stopping at, NO_TIME if none (may be NULL) */
+    uint64_t (*next_hour)(const GameState* state, uint64_t now);
+    /** Catch up over a TimeStep; may run on any thread */
+    TickFunction advance;
+    /** Report step results on the advancing thread (may be NULL) */
+    TickFunction merge;
+} TimeSubsystem;
+
+static uint64_t game_hour(const Resources* resources) {
+    return (uint64_t)resources->day_count * 24 + resources->time_hours;
+}
+
+uint64_t game_state_get_hour(const GameState* state) {
+    return state ? game_hour(&state->resources) : 0;
+}
+
+static void consciousness_month_timer(uint64_t hour, void* userdata) {
+    GameState* state = userdata;
+    uint32_t month = (uint32_t)(hour / HOURS_PER_MONTH);
+
+    consciousness_apply_decay(&state->consciousness, month);
+    LOG_DEBUG("Month %u began, consciousness decayed to %.1f%%",
+             month, state->consciousness.stability);
+
+    game_state_schedule(state, (uint64_t)(month + 1) * HOURS_PER_MONTH,
+                        consciousness_month_timer, state);
+}
+
+/**
+ * @brief Get the game's timing wheel, creating it on first use
+ *
+ * Creation arms the recurring timers the game state owns itself, so a
+ * loaded game picks them up from its clock.
+ */
+static TimingWheel* game_timers(GameState* state) {
+    if (!state->timers) {
+        uint64_t now = game_hour(&state->resources);
+        state->timers = timing_wheel_create(now);
+        if (!state->timers) return NULL;
+
+        timing_wheel_schedule(state->timers, (now / HOURS_PER_MONTH + 1) * HOURS_PER_MONTH,
+                              consciousness_month_timer, state);
     }
+    return state->timers;
+}
+
+TimerId game_state_schedule(GameState* state, uint64_t hour,
+                            TimerCallback callback, void* userdata) {
+    if (!state) return 0;
+
+    TimingWheel* timers = game_timers(state);
+    return timers ? timing_wheel_schedule(timers, hour, callback, userdata) : 0;
+}
 
-    /* Record previous month for consciousness decay tracking */
-    uint32_t previous_month = resources_get_months_elapsed(&state->resources);
+bool game_state_cancel_timer(GameState* state, TimerId id) {
+    return state && timing_wheel_cancel(state->timers, id);
+}
+
+static void mana_advance(void* context) {
+    TimeStep* step = context;
+    uint64_t regen = (step->to - step->from) * MANA_REGEN_PER_HOUR;
+    resources_add_mana(&step->state->resources, regen > UINT32_MAX ? UINT32_MAX : (uint32_t)regen);
+}
 
-    /* Advance time */
-    resources_advance_time(&state->resources, hours);
+static void death_network_advance(void* context) {
+    TimeStep* step = context;
 
-    /* Check if we crossed a month boundary */
-    uint32_t current_month = resources_get_months_elapsed(&state->resources);
-    if (current_month > previous_month) {
-        /* Apply consciousness decay for the new month */
-        consciousness_apply_decay(&state->consciousness, current_month);
-        LOG_DEBUG("Month boundary crossed (%u -> %u), consciousness decayed to %.1f%%",
-                 previous_month, current_month, state->consciousness.stability);
+    /* Regenerate corpses, decay signatures, roll random events */
+    if (step->state->death_network) {
+        step->death_events = death_network_step(step->state->death_network,
+                                                (uint32_t)(step->to - step->from),
+                                                &step->death_rng);
     }
+}
+
+static void death_network_merge(void* context) {
+    TimeStep* step = context;
+    if (step->death_events > 0) {
+        LOG_INFO("%llu death event(s) across the network",
+                 (unsigned long long)step->death_events);
+    }
+}
+
+static uint64_t territory_status_next_hour(const GameState* state, uint64_t now) {
+    (void)now;
+    if (!state->territory_status) return NO_TIME;
 
-    /* Regenerate mana (10 per hour) */
-    uint32_t mana_regen = hours * 10;
-    resources_add_mana(&state->resources, mana_regen);
+    uint64_t next = territory_status_next_change(state->territory_status);
+    if (next == NO_TIME) return NO_TIME;
+    return (next + SECONDS_PER_HOUR - 1) / SECONDS_PER_HOUR;
+}
 
-    /* Update Death Network (regenerate corpses, decay signatures, random events) */
-    if (state->death_network) {
-        death_network_update(state->death_network, hours);
+static void territory_status_advance(void* context) {
+    TimeStep* step = context;
+    if (step->state->territory_status) {
+        step->reinforcements = territory_status_update_all(step->state->territory_status,
+                                                           step->to * SECONDS_PER_HOUR);
     }
+}
+
+static void territory_status_merge(void* context) {
+    TimeStep* step = context;
+    if (step->reinforcements > 0) {
+        LOG_INFO("Reinforcements arrived at %zu location(s)", step->reinforcements);
+    }
+}
+
+static void reformation_advance(void* context) {
+    TimeStep* step = context;
+    int days = (int)(step->to / 24 - step->from / 24);
+    if (step->state->reformation_program && days > 0) {
+        reformation_program_advance_time(step->state->reformation_program, days);
+    }
+}
+
+static uint64_t purge_next_hour(const GameState* state, uint64_t now) {
+    if (!state->purge_state) return NO_TIME;
+
+    int days = purge_system_get_days_remaining(state->purge_state);
+    return days > 0 ? (now / 24 + (uint64_t)days) * 24 : NO_TIME;
+}
+
+static void purge_advance(void* context) {
+    TimeStep* step = context;
+    PurgeState* purge = step->state->purge_state;
+    if (!purge) return;
+
+    /* Steps end at the latest on the day the countdown runs out */
+    uint64_t days = step->to / 24 - step->from / 24;
+    for (uint64_t d = 0; d < days && purge_system_get_days_remaining(purge) > 0; d++) {
+        if (purge_system_advance_day(purge)) {
+            step->purge_began = true;
+        }
+    }
+}
+
+static void purge_merge(void* context) {
+    TimeStep* step = context;
+    if (step->purge_began) {
+        LOG_INFO("The Fourth Purge has begun (day %u)", step->state->resources.day_count);
+    }
+}
+
+static void split_routing_advance(void* context) {
+    TimeStep* step = context;
+    int years = (int)(step->to / HOURS_PER_YEAR - step->from / HOURS_PER_YEAR);
+    if (step->state->split_routing && years > 0) {
+        step->souls_reunified = split_routing_advance_time(step->state->split_routing, years);
+    }
+}
+
+static void split_routing_merge(void* context) {
+    TimeStep* step = context;
+    if (step->souls_reunified > 0) {
+        LOG_INFO("%d split-routed soul(s) reunified", step->souls_reunified);
+    }
+}
+
+static uint64_t scheduler_next_hour(const GameState* state, uint64_t now) {
+    if (!state->event_scheduler) return NO_TIME;
+
+    uint32_t day = event_scheduler_next_day(state->event_scheduler, (uint32_t)(now / 24));
+    return day == UINT32_MAX ? NO_TIME : (uint64_t)day * 24;
+}
 
-    /* Check for triggered events */
+static void scheduler_check(GameState* state) {
     if (state->event_scheduler) {
         uint32_t triggered = event_scheduler_check_triggers(state->event_scheduler, state);
         if (triggered > 0) {
             LOG_INFO("Triggered %u event(s) on day %u", triggered, state->resources.day_count);
         }
     }
+}
+
+/* Independent per step; the scheduler runs after them on this thread */
+static const TimeSubsystem TIME_SUBSYSTEMS[] = {
+    { "mana",             NULL,                       mana_advance,             NULL },
+    { "death_network",    NULL,                       death_network_advance,    death_network_merge },
+    { "territory_status", territory_status_next_hour, territory_status_advance, territory_status_merge },
+    { "reformation",      NULL,                       reformation_advance,      NULL },
+    { "purge",            purge_next_hour,            purge_advance,            purge_merge },
+    { "split_routing",    NULL,                       split_routing_advance,    split_routing_merge }
+};
+
+#define TIME_SUBSYSTEM_COUNT (sizeof(TIME_SUBSYSTEMS) / sizeof(TIME_SUBSYSTEMS[0]))
+
+/* The advancing thread runs nodes too, so more workers than this idle */
+#define TIME_POOL_MAX_WORKERS (TIME_SUBSYSTEM_COUNT - 1)
+
+/* Below this many death network locations a step costs less than waking workers */
+#define TIME_PARALLEL_MIN_LOCATIONS 256
+
+/* Workers for the time kernel, capped at one per node it can run alongside */
+static ThreadPool* create_time_pool(void) {
+    size_t workers = thread_pool_default_worker_count();
+    if (workers == 0) return thread_pool_create_inline();
+    return thread_pool_create(workers < TIME_POOL_MAX_WORKERS ? workers : TIME_POOL_MAX_WORKERS);
+}
+
+/**
+ * @brief Build the tick graph of one step's subsystem updates
+ *
+ * @return Graph, or NULL if it could not be built (steps then run inline)
+ */
+static TickGraph* build_time_graph(TimeStep* step) {
+    TickGraph* graph = tick_graph_create();
+    if (!graph) return NULL;
+
+    for (size_t i = 0; i < TIME_SUBSYSTEM_COUNT; i++) {
+        if (tick_graph_add(graph, TIME_SUBSYSTEMS[i].name, TIME_SUBSYSTEMS[i].advance,
+                           TIME_SUBSYSTEMS[i].merge, step) < 0) {
+            tick_graph_destroy(graph);
+            return NULL;
+        }
+    }
+    return graph;
+}
+
+void game_state_advance_time(GameState* state, uint32_t hours) {
+    if (!state) {
+        return;
+    }
+
+    /* Workers are only started once time first moves */
+    if (!state->tick_pool) {
+        state->tick_pool = create_time_pool();
+    }
+    TimingWheel* timers = game_timers(state);
+
+    TimeStep step = { .state = state };
+    TickGraph* graph = build_time_graph(&step);
+
+    /* Small worlds step inline; the graph still runs nodes in order */
+    ThreadPool* pool = state->tick_pool;
+    if (death_network_get_location_count(state->death_network) < TIME_PARALLEL_MIN_LOCATIONS) {
+        pool = NULL;
+    }
+
+    uint64_t now = game_hour(&state->resources);
+    uint64_t end = now + hours;
+    uint32_t steps = 0;
+
+    /* A zero-hour advance still lets the scheduler look once */
+    do {
+        uint64_t next = end;
+        for (size_t i = 0; i < TIME_SUBSYSTEM_COUNT; i++) {
+            if (!TIME_SUBSYSTEMS[i].next_hour) continue;
+            uint64_t at = TIME_SUBSYSTEMS[i].next_hour(state, now);
+            if (at > now && at < next) next = at;
+        }
+        uint64_t at = scheduler_next_hour(state, now);
+        if (at > now && at < next) next = at;
+        at = timing_wheel_next_due(timers);
+        if (at > now && at < next) next = at;
+
+        resources_advance_time(&state->resources, (uint32_t)(next - now));
+
+        step.from = now;
+        step.to = next;
+        step.death_events = 0;
+        step.reinforcements = 0;
+        step.purge_began = false;
+        step.souls_reunified = 0;
+        /* Drawn here so results do not depend on which worker runs the node */
+        rng_seed(&step.death_rng, rng_next_u64(rng_stream(RNG_STREAM_DEATH_NETWORK)));
+        if (!graph || !tick_graph_run(graph, pool)) {
+            for (size_t i = 0; i < TIME_SUBSYSTEM_COUNT; i++) {
+                TIME_SUBSYSTEMS[i].advance(&step);
+                if (TIME_SUBSYSTEMS[i].merge) TIME_SUBSYSTEMS[i].merge(&step);
+            }
+        }
+        timing_wheel_advance(timers, next);
+        scheduler_check(state);
+
+        now = next;
+        steps++;
+    } while (now < end);
 
-    LOG_DEBUG("Advanced time by %u hours (mana regen: %u)", hours, mana_regen);
+    tick_graph_destroy(graph);
+    LOG_DEBUG("Advanced time by %u hours in %u step(s)", hours, steps);
 }
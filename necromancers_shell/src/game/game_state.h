@@ -10,6 +10,7 @@
 #define NECROMANCER_GAME_STATE_H
 
 #include "souls/soul_manager.h"
+#include "souls/soul_harvest.h"
 #include "world/territory.h"
 #include "world/location_graph.h"
 #include "world/world_map.h"
@@ -27,6 +28,7 @@
 #include "world/null_space.h"
 #include "narrative/gods/divine_council.h"
 #include "narrative/endings/ending_types.h"
+#include "../core/timing_wheel.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -42,6 +44,7 @@ typedef struct SplitRoutingManager SplitRoutingManager;
 typedef struct PurgeState PurgeState;
 typedef struct ArchonState ArchonState;
 typedef struct ReformationProgram ReformationProgram;
+typedef struct ThreadPool ThreadPool;
 
 /**
  * @brief Central game state structure
@@ -58,6 +61,8 @@ typedef struct GameState {
     Resources resources;            /**< Resources (energy, mana, time) */
     CorruptionState corruption;     /**< Corruption tracking */
     ConsciousnessState consciousness; /**< Consciousness decay tracking */
+    SoulHarvestTable harvest_table; /**< Soul type/quality odds per location type */
+    uint64_t game_seed;             /**< Seed of all subsystem random streams */
     MemoryManager* memories;        /**< Memory fragment collection */
     NPCManager* npcs;               /**< NPC collection manager */
     RelationshipManager* relationships; /**< Player-NPC relationships */
@@ -75,6 +80,8 @@ typedef struct GameState {
     PurgeState* purge_state;        /**< Fourth Purge tracking */
     ArchonState* archon_state;      /**< Archon transformation state */
     ReformationProgram* reformation_program; /**< Necromancer reformation program */
+    ThreadPool* tick_pool;          /**< Workers for time advance (created on first use) */
+    TimingWheel* timers;            /**< Game-hour timers fired by time advance (created on first use) */
     uint32_t current_location_id;   /**< ID of current location */
     uint32_t player_level;          /**< Player level */
     uint64_t player_experience;     /**< Player XP */
@@ -119,6 +126,30 @@ GameState* game_state_get_instance(void);
  */
 void game_state_set_instance(GameState* state);
 
+/**
+ * @brief Initialize harvest distributions
+ *
+ * Loads data/harvest.dat over the built-in defaults. Called by
+ * game_state_create(); loaders that build a GameState by hand must call
+ * it too.
+ *
+ * @param state Game state
+ */
+void game_state_init_harvest(GameState* state);
+
+/**
+ * @brief Set the game seed and reseed every subsystem random stream
+ *
+ * game_state_create() picks a seed from the clock; bots, benchmarks and
+ * replays call this to make a run reproducible. Save files store the
+ * seed and each stream's position, so a loaded game continues the
+ * sequence instead of replaying it.
+ *
+ * @param state Game state
+ * @param seed New game seed
+ */
+void game_state_set_seed(GameState* state, uint64_t seed);
+
 /**
  * @brief Get next available soul ID and increment counter
  *
@@ -157,11 +188,52 @@ bool game_state_move_to_location(GameState* state, uint32_t location_id);
 /**
  * @brief Update game state for elapsed time
  *
- * Advances time, regenerates mana, etc.
+ * Advances time, regenerates mana, decays consciousness monthly, updates
+ * the Death Network and territory alerts, fires due timers and fires
+ * scheduled events. The interval is split only at points where something
+ * happens (timers, scheduled event days, alert changes), so day events
+ * and timers are never skipped and long waits cost O(events). Within a
+ * step, independent subsystems (Death Network, territory alerts,
+ * reformation, purge, split routing) update concurrently; timers then
+ * fire on the calling thread.
  *
  * @param state Game state
  * @param hours Hours to advance
  */
 void game_state_advance_time(GameState* state, uint32_t hours);
 
+/**
+ * @brief Get the current game hour (days * 24 + hour of day)
+ *
+ * @param state Game state
+ * @return Game hour
+ */
+uint64_t game_state_get_hour(const GameState* state);
+
+/**
+ * @brief Schedule a callback at a game hour
+ *
+ * The callback runs from game_state_advance_time() once the clock reaches
+ * the hour, after the subsystems caught up to it and before story events
+ * are checked. Timers are not saved; subsystems re-arm them from their
+ * own state after loading.
+ *
+ * @param state Game state
+ * @param hour Game hour to fire at (see game_state_get_hour())
+ * @param callback Function to call
+ * @param userdata Passed to callback
+ * @return Timer handle for game_state_cancel_timer(), or 0 on failure
+ */
+TimerId game_state_schedule(GameState* state, uint64_t hour,
+                            TimerCallback callback, void* userdata);
+
+/**
+ * @brief Cancel a timer scheduled with game_state_schedule()
+ *
+ * @param state Game state
+ * @param id Timer handle
+ * @return true if the timer was pending
+ */
+bool game_state_cancel_timer(GameState* state, TimerId id);
+
 #endif /* NECROMANCER_GAME_STATE_H */
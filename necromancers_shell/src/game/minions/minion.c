@@ -1,4 +1,5 @@
 #include "minion.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -102,7 +103,7 @@ Minion* minion_create(MinionType type, const char* name, uint32_t soul_id) {
     } else {
         /* Auto-generate name: Type-XXXX */
         snprintf(minion->name, sizeof(minion->name), "%s-%04d",
-                 minion_type_name(type), rand() % 10000);
+                 minion_type_name(type), (int)rng_range(rng_stream(RNG_STREAM_MINIONS), 10000));
     }
 
     /* Initialize stats from base stats */
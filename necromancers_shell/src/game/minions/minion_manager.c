@@ -1,4 +1,5 @@
 #include "minion_manager.h"
+#include "../../utils/id_map.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -14,6 +15,7 @@ struct MinionManager {
     Minion** minions;    /**< Dynamic array of minion pointers */
     size_t count;        /**< Current number of minions */
     size_t capacity;     /**< Capacity of minions array */
+    IdMap* index;        /**< Minion ID -> position in minions array */
 };
 
 MinionManager* minion_manager_create(size_t initial_capacity) {
@@ -27,7 +29,10 @@ MinionManager* minion_manager_create(size_t initial_capacity) {
     }
 
     manager->minions = (Minion**)malloc(initial_capacity * sizeof(Minion*));
-    if (!manager->minions) {
+    manager->index = id_map_create(initial_capacity);
+    if (!manager->minions || !manager->index) {
+        free(manager->minions);
+        id_map_destroy(manager->index);
         free(manager);
         return NULL;
     }
@@ -49,6 +54,7 @@ void minion_manager_destroy(MinionManager* manager) {
     }
 
     free(manager->minions);
+    id_map_destroy(manager->index);
     free(manager);
 }
 
@@ -68,6 +74,10 @@ bool minion_manager_add(MinionManager* manager, Minion* minion) {
         manager->capacity = new_capacity;
     }
 
+    if (!id_map_put_index(manager->index, minion->id, manager->count)) {
+        return false;
+    }
+
     /* Add minion to array */
     manager->minions[manager->count++] = minion;
     return true;
@@ -78,37 +88,25 @@ Minion* minion_manager_remove(MinionManager* manager, uint32_t minion_id) {
         return NULL;
     }
 
-    /* Defensive: Ensure count doesn't exceed capacity */
-    if (manager->count > manager->capacity) {
-        return NULL;
-    }
-
     /* Find minion by ID */
-    for (size_t i = 0; i < manager->count; i++) {
-        /* Defensive bounds check */
-        if (i >= manager->capacity) {
-            break;
-        }
-
-        if (!manager->minions[i]) {
-            continue;  /* Skip NULL minions */
-        }
-
-        if (manager->minions[i]->id == minion_id) {
-            /* Store pointer to return */
-            Minion* minion = manager->minions[i];
+    size_t i;
+    if (!id_map_get_index(manager->index, minion_id, &i) || i >= manager->count) {
+        return NULL;  /* Not found */
+    }
 
-            /* Shift remaining minions down */
-            for (size_t j = i; j < manager->count - 1; j++) {
-                manager->minions[j] = manager->minions[j + 1];
-            }
+    /* Store pointer to return */
+    Minion* minion = manager->minions[i];
+    id_map_remove(manager->index, minion_id);
 
-            manager->count--;
-            return minion;  /* Transfer ownership to caller */
-        }
+    /* Move the last minion into the hole; only its index entry changes */
+    size_t last = --manager->count;
+    if (i != last) {
+        manager->minions[i] = manager->minions[last];
+        id_map_put_index(manager->index, manager->minions[i]->id, i);
     }
+    manager->minions[last] = NULL;
 
-    return NULL;  /* Not found */
+    return minion;  /* Transfer ownership to caller */
 }
 
 Minion* minion_manager_get(MinionManager* manager, uint32_t minion_id) {
@@ -116,28 +114,12 @@ Minion* minion_manager_get(MinionManager* manager, uint32_t minion_id) {
         return NULL;
     }
 
-    /* Defensive: Ensure count doesn't exceed capacity */
-    if (manager->count > manager->capacity) {
+    size_t i;
+    if (!id_map_get_index(manager->index, minion_id, &i) || i >= manager->count) {
         return NULL;
     }
 
-    /* Find minion by ID */
-    for (size_t i = 0; i < manager->count; i++) {
-        /* Defensive bounds check */
-        if (i >= manager->capacity) {
-            break;
-        }
-
-        if (!manager->minions[i]) {
-            continue;  /* Skip NULL minions */
-        }
-
-        if (manager->minions[i]->id == minion_id) {
-            return manager->minions[i];
-        }
-    }
-
-    return NULL;
+    return manager->minions[i];
 }
 
 Minion* minion_manager_get_at(MinionManager* manager, size_t index) {
@@ -285,4 +267,5 @@ void minion_manager_clear(MinionManager* manager) {
     }
 
     manager->count = 0;
+    id_map_clear(manager->index);
 }
@@ -52,6 +52,7 @@ bool minion_manager_add(MinionManager* manager, Minion* minion);
  * @brief Remove a minion from the manager by ID
  *
  * Transfers ownership back to caller - caller must destroy the returned minion.
+ * The last minion takes its place, so manager order is not preserved.
  *
  * @param manager Pointer to minion manager
  * @param minion_id ID of minion to remove
@@ -75,7 +76,8 @@ Minion* minion_manager_get(MinionManager* manager, uint32_t minion_id);
  * @brief Get minion at specific index
  *
  * Returns a pointer to the minion at the given index.
- * Useful for iterating through all minions.
+ * Useful for iterating through all minions. Indices are not stable
+ * across removals; sort by ID when listing for the player.
  *
  * @param manager Pointer to minion manager
  * @param index Index of minion (0 to count-1)
@@ -40,7 +40,7 @@ typedef struct {
 /**
  * Fourth Purge state
  */
-typedef struct {
+typedef struct PurgeState {
     int purge_number;               /* Always 4 for Fourth Purge */
     int days_until_purge;           /* Countdown timer */
     bool accelerated;               /* Ashbrook triggered early */
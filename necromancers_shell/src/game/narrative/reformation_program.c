@@ -3,6 +3,7 @@
  */
 
 #include "reformation_program.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -76,29 +77,30 @@ bool reformation_program_initialize(ReformationProgram* program,
     program->target_count = REFORMATION_TARGET_COUNT;
 
     /* Generate 147 necromancers procedurally */
+    Rng* rng = rng_stream(RNG_STREAM_NARRATIVE);
     for (int i = 0; i < REFORMATION_TARGET_COUNT; i++) {
         ReformationTarget* target = &program->targets[i];
 
         target->npc_id = 10000 + i; /* Start NPC IDs at 10000 */
 
         /* Generate name */
-        int gender = rand() % 2;
+        int gender = (int)rng_range(rng, 2);
         const char* first_name;
         if (gender == 0) {
-            first_name = MALE_NAMES[rand() % MALE_NAMES_COUNT];
+            first_name = MALE_NAMES[rng_range(rng, MALE_NAMES_COUNT)];
         } else {
-            first_name = FEMALE_NAMES[rand() % FEMALE_NAMES_COUNT];
+            first_name = FEMALE_NAMES[rng_range(rng, FEMALE_NAMES_COUNT)];
         }
-        const char* surname = SURNAMES[rand() % SURNAMES_COUNT];
+        const char* surname = SURNAMES[rng_range(rng, SURNAMES_COUNT)];
         snprintf(target->name, sizeof(target->name), "%s %s", first_name, surname);
 
         /* Corruption: 65-99% */
-        target->starting_corruption = 65 + (rand() % 35);
+        target->starting_corruption = 65 + rng_range(rng, 35);
         target->current_corruption = target->starting_corruption;
         target->corruption_reduction = 0;
 
         /* Resistance level (random distribution) */
-        int roll = rand() % 100;
+        int roll = (int)rng_range(rng, 100);
         if (roll < 30) {
             target->resistance = RESISTANCE_LOW;
         } else if (roll < 60) {
@@ -110,7 +112,7 @@ bool reformation_program_initialize(ReformationProgram* program,
         }
 
         /* Initial attitude: mostly neutral to wary */
-        target->attitude_score = -10 + (rand() % 20); /* -10 to +9 */
+        target->attitude_score = -10 + (int)rng_range(rng, 20); /* -10 to +9 */
 
         target->sessions_held = 0;
         target->days_since_last_session = SESSION_COOLDOWN_DAYS; /* Can start immediately */
@@ -75,7 +75,7 @@ typedef struct {
 /**
  * Reformation program state
  */
-typedef struct {
+typedef struct ReformationProgram {
     ReformationTarget targets[REFORMATION_TARGET_COUNT];
     size_t target_count;
 
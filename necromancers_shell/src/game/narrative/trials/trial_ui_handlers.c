@@ -22,6 +22,7 @@
 #include "../../../terminal/platform_curses.h"
 #include "../../../terminal/colors.h"
 #include "../../../utils/logger.h"
+#include "../../../utils/rng.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -134,7 +135,7 @@ TrialUIResult trial_ui_run_power(GameState* state) {
         /* Execute action */
         if (choices[selected].key == 'a') {
             /* Attack */
-            uint32_t damage = 80 + (rand() % 41); /* 80-120 damage */
+            uint32_t damage = 80 + rng_range(rng_stream(RNG_STREAM_NARRATIVE), 41); /* 80-120 damage */
             bool alive = power_trial_damage_seraphim(trial, damage);
             trial->turns_elapsed++;
 
@@ -3,6 +3,7 @@
  */
 
 #include "network_patching.h"
+#include "../../utils/rng.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -127,7 +128,7 @@ PatchResult network_patching_deploy_patch(NetworkPatchingState* state,
     state->patches_deployed++;
 
     /* 95% success rate */
-    int roll = rand() % 100;
+    int roll = (int)rng_range(rng_stream(RNG_STREAM_WORLD), 100);
     PatchResult result;
 
     if (roll < BASE_SUCCESS_RATE) {
@@ -66,7 +66,7 @@ typedef struct {
 /**
  * Split-routing manager
  */
-typedef struct {
+typedef struct SplitRoutingManager {
     SplitRoutedSoul routes[MAX_SPLIT_ROUTES];
     size_t route_count;
 
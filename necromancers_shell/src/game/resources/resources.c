@@ -105,26 +105,18 @@ void resources_advance_time(Resources* resources, uint32_t hours) {
         return;
     }
 
-    resources->time_hours += hours;
-
-    /* Handle day rollover */
-    while (resources->time_hours >= 24) {
-        resources->time_hours -= 24;
-        resources->day_count++;
-
-        /* Update day of month */
-        resources->day_of_month++;
-        if (resources->day_of_month > 30) {
-            resources->day_of_month = 1;
-            resources->month++;
-
-            /* Update year */
-            if (resources->month >= 12) {
-                resources->month = 0;
-                resources->year++;
-            }
-        }
-    }
+    uint32_t total_hours = resources->time_hours + hours;
+    uint32_t days = total_hours / 24;
+    resources->time_hours = total_hours % 24;
+    resources->day_count += days;
+
+    /* Roll days into 30-day months and 12-month years in closed form */
+    uint32_t days_into_month = (resources->day_of_month - 1) + days;
+    resources->day_of_month = days_into_month % 30 + 1;
+
+    uint32_t months = resources->month + days_into_month / 30;
+    resources->month = months % 12;
+    resources->year += months / 12;
 }
 
 int resources_format_time(const Resources* resources, char* buffer, size_t buffer_size) {
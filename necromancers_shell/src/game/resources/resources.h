@@ -127,7 +127,8 @@ bool resources_increase_max_mana(Resources* resources, uint32_t amount);
  * @brief Advance time by a number of hours
  *
  * Advances the game clock. When crossing midnight (24 hours),
- * increments day_count and wraps time_hours.
+ * increments day_count and wraps time_hours. Runs in constant time
+ * however long the interval.
  *
  * @param resources Pointer to resources structure
  * @param hours Number of hours to advance
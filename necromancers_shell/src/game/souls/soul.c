@@ -1,4 +1,5 @@
 #include "soul.h"
+#include "soul_manager.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -16,49 +17,52 @@ static const char* SOUL_TYPE_NAMES[] = {
     "Ancient"
 };
 
-/* Memory templates for different soul types */
-static const char* COMMON_MEMORIES[] = {
+/*
+ * Shared memory text table. Souls store an index into this table rather
+ * than a copy of the text; each type owns SOUL_MEMORIES_PER_TYPE
+ * consecutive entries, in SoulType order.
+ */
+static const char* const SOUL_MEMORY_TABLE[SOUL_MEMORY_TEMPLATE_COUNT] = {
+    /* Common */
     "Memories of simple toil and daily labor",
     "Fragments of a quiet, unremarkable life",
     "Echoes of mundane routines and simple pleasures",
-    "Whispers of ordinary joys and sorrows"
-};
+    "Whispers of ordinary joys and sorrows",
 
-static const char* WARRIOR_MEMORIES[] = {
+    /* Warrior */
     "Battle cries echo through blood-soaked memories",
     "The weight of steel and the taste of victory",
     "Screams of fallen comrades haunt the edges",
-    "Glory and carnage intertwined in death's embrace"
-};
+    "Glory and carnage intertwined in death's embrace",
 
-static const char* MAGE_MEMORIES[] = {
+    /* Mage */
     "Arcane formulas dance at the edge of comprehension",
     "Libraries of lost knowledge flicker in the void",
     "The taste of raw magic lingers on spectral lips",
-    "Secrets of forbidden spells whisper endlessly"
-};
+    "Secrets of forbidden spells whisper endlessly",
 
-static const char* INNOCENT_MEMORIES[] = {
+    /* Innocent */
     "Laughter of children, now forever silenced",
     "Simple kindness untouched by the world's cruelty",
     "Pure hope that never knew true darkness",
-    "Gentle warmth of a life cut too short"
-};
+    "Gentle warmth of a life cut too short",
 
-static const char* CORRUPTED_MEMORIES[] = {
+    /* Corrupted */
     "Darkness that spread from within, consuming all",
     "Twisted desires that warped the soul beyond recognition",
     "Malevolence crystallized into spectral essence",
-    "Evil that persists even in death's cold grip"
-};
+    "Evil that persists even in death's cold grip",
 
-static const char* ANCIENT_MEMORIES[] = {
+    /* Ancient */
     "Centuries compressed into timeless echoes",
     "Wisdom of ages mixed with the dust of empires",
     "Memories so old they predate written history",
     "Power accumulated across countless lifetimes"
 };
 
+/* Length of the "..." marker appended to degraded memories */
+#define DEGRADED_SUFFIX_LENGTH 3
+
 Soul* soul_create(SoulType type, SoulQuality quality) {
     /* Validate inputs */
     if (type >= SOUL_TYPE_COUNT) {
@@ -83,6 +87,7 @@ Soul* soul_create(SoulType type, SoulQuality quality) {
     soul->bound = false;
     soul->bound_minion_id = 0;
     soul->timestamp = time(NULL);
+    soul->owner = NULL;
 
     /* Generate memories */
     soul_generate_memories(soul, type, quality);
@@ -90,6 +95,25 @@ Soul* soul_create(SoulType type, SoulQuality quality) {
     return soul;
 }
 
+bool soul_create_batch(const SoulType* types, const SoulQuality* qualities,
+                       size_t count, Soul** souls_out) {
+    if (!types || !qualities || !souls_out) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        souls_out[i] = soul_create(types[i], qualities[i]);
+        if (!souls_out[i]) {
+            while (i > 0) {
+                soul_destroy(souls_out[--i]);
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void soul_destroy(Soul* soul) {
     if (soul) {
         free(soul);
@@ -164,6 +188,9 @@ bool soul_bind(Soul* soul, uint32_t minion_id) {
 
     soul->bound = true;
     soul->bound_minion_id = minion_id;
+    if (soul->owner) {
+        soul_manager_sync_binding(soul->owner, soul);
+    }
     return true;
 }
 
@@ -178,6 +205,9 @@ bool soul_unbind(Soul* soul) {
 
     soul->bound = false;
     soul->bound_minion_id = 0;
+    if (soul->owner) {
+        soul_manager_sync_binding(soul->owner, soul);
+    }
     return true;
 }
 
@@ -186,59 +216,86 @@ void soul_generate_memories(Soul* soul, SoulType type, SoulQuality quality) {
         return;
     }
 
-    /* Select memory template based on type */
-    const char** templates;
-    size_t template_count;
-
-    switch (type) {
-        case SOUL_TYPE_COMMON:
-            templates = COMMON_MEMORIES;
-            template_count = sizeof(COMMON_MEMORIES) / sizeof(COMMON_MEMORIES[0]);
-            break;
-        case SOUL_TYPE_WARRIOR:
-            templates = WARRIOR_MEMORIES;
-            template_count = sizeof(WARRIOR_MEMORIES) / sizeof(WARRIOR_MEMORIES[0]);
-            break;
-        case SOUL_TYPE_MAGE:
-            templates = MAGE_MEMORIES;
-            template_count = sizeof(MAGE_MEMORIES) / sizeof(MAGE_MEMORIES[0]);
-            break;
-        case SOUL_TYPE_INNOCENT:
-            templates = INNOCENT_MEMORIES;
-            template_count = sizeof(INNOCENT_MEMORIES) / sizeof(INNOCENT_MEMORIES[0]);
-            break;
-        case SOUL_TYPE_CORRUPTED:
-            templates = CORRUPTED_MEMORIES;
-            template_count = sizeof(CORRUPTED_MEMORIES) / sizeof(CORRUPTED_MEMORIES[0]);
-            break;
-        case SOUL_TYPE_ANCIENT:
-            templates = ANCIENT_MEMORIES;
-            template_count = sizeof(ANCIENT_MEMORIES) / sizeof(ANCIENT_MEMORIES[0]);
-            break;
-        default:
-            templates = COMMON_MEMORIES;
-            template_count = sizeof(COMMON_MEMORIES) / sizeof(COMMON_MEMORIES[0]);
-            break;
+    if (type >= SOUL_TYPE_COUNT) {
+        type = SOUL_TYPE_COMMON;
     }
 
-    /* Select random template based on quality (use quality as seed) */
-    size_t index = quality % template_count;
-    strncpy(soul->memories, templates[index], SOUL_MEMORY_MAX_LENGTH - 1);
-    soul->memories[SOUL_MEMORY_MAX_LENGTH - 1] = '\0';
+    /* Select template based on type and quality (use quality as seed) */
+    soul->memory_template = (uint8_t)(type * SOUL_MEMORIES_PER_TYPE +
+                                      quality % SOUL_MEMORIES_PER_TYPE);
+    soul->memory_degradation = 0;
 
     /* For low quality souls, corrupt the memories slightly */
     if (quality < 30) {
-        /* Truncate some characters to simulate degraded memories */
-        size_t len = strlen(soul->memories);
+        /* Drop some trailing characters to simulate degraded memories */
+        size_t len = strlen(SOUL_MEMORY_TABLE[soul->memory_template]);
         if (len > 20) {
-            soul->memories[len - (30 - quality) / 5] = '.';
-            soul->memories[len - (30 - quality) / 5 + 1] = '.';
-            soul->memories[len - (30 - quality) / 5 + 2] = '.';
-            soul->memories[len - (30 - quality) / 5 + 3] = '\0';
+            soul->memory_degradation = (uint8_t)((30 - quality) / 5 + 1);
         }
     }
 }
 
+const char* soul_memory_template_text(uint8_t template_index) {
+    if (template_index >= SOUL_MEMORY_TEMPLATE_COUNT) {
+        return "";
+    }
+    return SOUL_MEMORY_TABLE[template_index];
+}
+
+size_t soul_get_memories(const Soul* soul, char* buffer, size_t buffer_size) {
+    if (!soul || !buffer || buffer_size == 0) {
+        return 0;
+    }
+
+    const char* text = soul_memory_template_text(soul->memory_template);
+    size_t len = strlen(text);
+
+    if (soul->memory_degradation == 0) {
+        snprintf(buffer, buffer_size, "%s", text);
+        return len;
+    }
+
+    /* Degraded: cut the tail and mark it with "..." */
+    size_t cut = (size_t)(soul->memory_degradation - 1);
+    size_t keep = cut < len ? len - cut : 0;
+    snprintf(buffer, buffer_size, "%.*s...", (int)keep, text);
+    return keep + DEGRADED_SUFFIX_LENGTH;
+}
+
+bool soul_memory_from_text(const char* text, uint8_t* template_out,
+                           uint8_t* degradation_out) {
+    if (!text || !template_out || !degradation_out) {
+        return false;
+    }
+
+    size_t text_len = strlen(text);
+    for (size_t i = 0; i < SOUL_MEMORY_TEMPLATE_COUNT; i++) {
+        const char* candidate = SOUL_MEMORY_TABLE[i];
+        size_t len = strlen(candidate);
+
+        if (strcmp(text, candidate) == 0) {
+            *template_out = (uint8_t)i;
+            *degradation_out = 0;
+            return true;
+        }
+
+        /* Degraded form: a prefix of the template followed by "..." */
+        if (text_len < DEGRADED_SUFFIX_LENGTH ||
+            strcmp(text + text_len - DEGRADED_SUFFIX_LENGTH, "...") != 0) {
+            continue;
+        }
+        size_t keep = text_len - DEGRADED_SUFFIX_LENGTH;
+        if (keep <= len && len - keep < UINT8_MAX &&
+            strncmp(text, candidate, keep) == 0) {
+            *template_out = (uint8_t)i;
+            *degradation_out = (uint8_t)(len - keep + 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 int soul_get_description(const Soul* soul, char* buffer, size_t buffer_size) {
     if (!soul || !buffer || buffer_size == 0) {
         return 0;
@@ -259,8 +316,10 @@ int soul_get_description(const Soul* soul, char* buffer, size_t buffer_size) {
 
     /* Write memories */
     if (written < (int)buffer_size) {
+        char memories[SOUL_MEMORY_MAX_LENGTH];
+        soul_get_memories(soul, memories, sizeof(memories));
         written += snprintf(buffer + written, buffer_size - written,
-                           "\n  Memories: %s", soul->memories);
+                           "\n  Memories: %s", memories);
     }
 
     return written;
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <time.h>
 
 /**
@@ -38,10 +39,22 @@ typedef enum {
 typedef uint8_t SoulQuality;
 
 /**
- * @brief Maximum length for soul memory strings
+ * @brief Maximum length for rendered soul memory strings
  */
 #define SOUL_MEMORY_MAX_LENGTH 256
 
+/**
+ * @brief Memory templates available to each soul type
+ */
+#define SOUL_MEMORIES_PER_TYPE 4
+
+/**
+ * @brief Number of entries in the shared memory text table
+ */
+#define SOUL_MEMORY_TEMPLATE_COUNT (SOUL_TYPE_COUNT * SOUL_MEMORIES_PER_TYPE)
+
+struct SoulManager;
+
 /**
  * @brief Core soul structure
  *
@@ -52,11 +65,13 @@ typedef struct {
     uint32_t id;                              /**< Unique soul identifier */
     SoulType type;                            /**< Type of soul */
     SoulQuality quality;                      /**< Quality value (0-100) */
-    char memories[SOUL_MEMORY_MAX_LENGTH];    /**< Flavor text memories */
+    uint8_t memory_template;                  /**< Index into the shared memory text table */
+    uint8_t memory_degradation;               /**< 0 = intact, n = last n-1 chars lost */
     uint32_t energy;                          /**< Calculated energy value */
     bool bound;                               /**< Whether soul is bound to a minion */
     uint32_t bound_minion_id;                 /**< ID of bound minion (0 if unbound) */
     time_t timestamp;                         /**< When soul was harvested */
+    struct SoulManager* owner;                /**< Manager holding this soul (NULL if none) */
 } Soul;
 
 /**
@@ -72,6 +87,21 @@ typedef struct {
  */
 Soul* soul_create(SoulType type, SoulQuality quality);
 
+/**
+ * @brief Create several souls at once
+ *
+ * Equivalent to calling soul_create() for each type/quality pair, but
+ * all-or-nothing: on failure no souls are left allocated.
+ *
+ * @param types Array of count soul types
+ * @param qualities Array of count qualities
+ * @param count Number of souls to create
+ * @param souls_out Output array of count soul pointers
+ * @return true on success, false on invalid type or allocation failure
+ */
+bool soul_create_batch(const SoulType* types, const SoulQuality* qualities,
+                       size_t count, Soul** souls_out);
+
 /**
  * @brief Destroy a soul and free its memory
  *
@@ -104,6 +134,7 @@ uint32_t soul_calculate_energy(SoulType type, SoulQuality quality);
  *
  * Marks the soul as bound to a specific minion.
  * Bound souls cannot be used for other purposes until unbound.
+ * If the soul is held by a SoulManager, the manager is updated too.
  *
  * @param soul Pointer to soul
  * @param minion_id ID of minion to bind to
@@ -115,6 +146,7 @@ bool soul_bind(Soul* soul, uint32_t minion_id);
  * @brief Unbind a soul from its minion
  *
  * Marks the soul as unbound and available for other uses.
+ * If the soul is held by a SoulManager, the manager is updated too.
  *
  * @param soul Pointer to soul
  * @return true on success, false if soul is NULL or not bound
@@ -124,8 +156,9 @@ bool soul_unbind(Soul* soul);
 /**
  * @brief Generate random memories for a soul
  *
- * Creates flavor text based on soul type and quality.
- * Memories are stored in the soul's memories field.
+ * Picks flavor text based on soul type and quality. Only a reference
+ * into the shared text table is stored on the soul; use
+ * soul_get_memories() to render it.
  *
  * @param soul Pointer to soul
  * @param type Soul type (influences memory content)
@@ -133,6 +166,40 @@ bool soul_unbind(Soul* soul);
  */
 void soul_generate_memories(Soul* soul, SoulType type, SoulQuality quality);
 
+/**
+ * @brief Get the text of a shared memory template
+ *
+ * @param template_index Index into the memory table
+ * @return Template text, or "" if the index is out of range
+ */
+const char* soul_memory_template_text(uint8_t template_index);
+
+/**
+ * @brief Render a soul's memories into a buffer
+ *
+ * Applies the soul's degradation (truncation marked with "...") to its
+ * memory template.
+ *
+ * @param soul Pointer to soul
+ * @param buffer Buffer to write memories into
+ * @param buffer_size Size of buffer
+ * @return Length of the full rendered text (excluding null terminator)
+ */
+size_t soul_get_memories(const Soul* soul, char* buffer, size_t buffer_size);
+
+/**
+ * @brief Find the template reference for rendered memory text
+ *
+ * Used to convert saves that stored the memory text itself.
+ *
+ * @param text Rendered memory text
+ * @param template_out Output template index
+ * @param degradation_out Output degradation value
+ * @return true if text matches a template (intact or degraded)
+ */
+bool soul_memory_from_text(const char* text, uint8_t* template_out,
+                           uint8_t* degradation_out);
+
 /**
  * @brief Get a formatted description of the soul
  *
@@ -0,0 +1,62 @@
+#include "soul_harvest.h"
+#include <string.h>
+
+/* Built-in soul type weights per location type, in SoulType order */
+static const uint32_t DEFAULT_WEIGHTS[LOCATION_TYPE_COUNT][SOUL_TYPE_COUNT] = {
+    /*                          Common Warrior Mage Innocent Corrupted Ancient */
+    [LOCATION_TYPE_GRAVEYARD]   = {70,    0,      0,   20,      0,        10},
+    [LOCATION_TYPE_BATTLEFIELD] = {25,    60,     0,   0,       15,       0},
+    [LOCATION_TYPE_VILLAGE]     = {20,    0,      0,   80,      0,        0},
+    [LOCATION_TYPE_CRYPT]       = {0,     30,     30,  0,       0,        40},
+    [LOCATION_TYPE_RITUAL_SITE] = {0,     0,      30,  0,       50,       20}
+};
+
+void soul_harvest_table_init_defaults(SoulHarvestTable* table) {
+    if (!table) return;
+
+    memset(table, 0, sizeof(SoulHarvestTable));
+    for (int loc = 0; loc < LOCATION_TYPE_COUNT; loc++) {
+        alias_table_build(&table->soul_types[loc], DEFAULT_WEIGHTS[loc], SOUL_TYPE_COUNT);
+        table->quality_spread[loc] = SOUL_HARVEST_DEFAULT_SPREAD;
+    }
+}
+
+bool soul_harvest_table_set(SoulHarvestTable* table, LocationType location_type,
+                            const uint32_t* type_weights, uint8_t quality_spread) {
+    if (!table || !type_weights || (unsigned)location_type >= LOCATION_TYPE_COUNT) {
+        return false;
+    }
+
+    AliasTable built;
+    if (!alias_table_build(&built, type_weights, SOUL_TYPE_COUNT)) {
+        return false;
+    }
+
+    table->soul_types[location_type] = built;
+    table->quality_spread[location_type] = quality_spread > 100 ? 100 : quality_spread;
+    return true;
+}
+
+size_t soul_harvest_roll(const SoulHarvestTable* table, LocationType location_type,
+                         uint8_t quality_avg, Rng* rng, size_t count,
+                         SoulType* types_out, SoulQuality* qualities_out) {
+    if (!table || !rng || !types_out || !qualities_out ||
+        (unsigned)location_type >= LOCATION_TYPE_COUNT) {
+        return 0;
+    }
+
+    const AliasTable* types = &table->soul_types[location_type];
+    int spread = table->quality_spread[location_type];
+    uint32_t span = (uint32_t)(2 * spread + 1);
+
+    for (size_t i = 0; i < count; i++) {
+        types_out[i] = (SoulType)alias_table_sample(types, rng);
+
+        int quality = (int)quality_avg + (int)rng_range(rng, span) - spread;
+        if (quality < 0) quality = 0;
+        if (quality > 100) quality = 100;
+        qualities_out[i] = (SoulQuality)quality;
+    }
+
+    return count;
+}
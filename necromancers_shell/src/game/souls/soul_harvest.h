@@ -0,0 +1,73 @@
+#ifndef SOUL_HARVEST_H
+#define SOUL_HARVEST_H
+
+#include "soul.h"
+#include "../world/location.h"
+#include "../../utils/rng.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file soul_harvest.h
+ * @brief Soul type and quality distributions for corpse harvesting
+ *
+ * Each location type has a weighted distribution of soul types, stored as
+ * an alias table so a type is drawn in constant time, and a quality
+ * spread around the location's average quality. The defaults match the
+ * original hardcoded harvest odds; data/harvest.dat can override them
+ * (see harvest_data.h).
+ */
+
+/**
+ * @brief Default quality spread (+/- around the location average)
+ */
+#define SOUL_HARVEST_DEFAULT_SPREAD 20
+
+/**
+ * @brief Per-location-type harvest distributions
+ */
+typedef struct {
+    AliasTable soul_types[LOCATION_TYPE_COUNT];   /**< Soul type distribution */
+    uint8_t quality_spread[LOCATION_TYPE_COUNT];  /**< Quality +/- spread */
+} SoulHarvestTable;
+
+/**
+ * @brief Fill a harvest table with the built-in distributions
+ *
+ * @param table Table to initialize
+ */
+void soul_harvest_table_init_defaults(SoulHarvestTable* table);
+
+/**
+ * @brief Replace the distribution for one location type
+ *
+ * @param table Harvest table
+ * @param location_type Location type to update
+ * @param type_weights One weight per SoulType (SOUL_TYPE_COUNT entries)
+ * @param quality_spread Quality +/- spread (capped at 100)
+ * @return true on success, false if the location type is invalid or all
+ *         weights are zero (the previous distribution is kept)
+ */
+bool soul_harvest_table_set(SoulHarvestTable* table, LocationType location_type,
+                            const uint32_t* type_weights, uint8_t quality_spread);
+
+/**
+ * @brief Roll soul types and qualities for a batch of corpses
+ *
+ * Quality is uniform within quality_avg +/- spread, clamped to 0-100.
+ *
+ * @param table Harvest table
+ * @param location_type Location being harvested
+ * @param quality_avg Location's average soul quality
+ * @param rng Random generator
+ * @param count Number of souls to roll
+ * @param types_out Output array of count soul types
+ * @param qualities_out Output array of count qualities
+ * @return Number of souls rolled (count, or 0 on invalid input)
+ */
+size_t soul_harvest_roll(const SoulHarvestTable* table, LocationType location_type,
+                         uint8_t quality_avg, Rng* rng, size_t count,
+                         SoulType* types_out, SoulQuality* qualities_out);
+
+#endif /* SOUL_HARVEST_H */
@@ -1,4 +1,6 @@
 #include "soul_manager.h"
+#include "soul_simd.h"
+#include "../../utils/id_map.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -12,15 +14,214 @@
  */
 #define GROWTH_FACTOR 2
 
+/**
+ * @brief Index of the lowest set bit (word must be non-zero)
+ */
+static inline unsigned lowest_bit(uint64_t word) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctzll(word);
+#else
+    unsigned bit = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/**
+ * @brief Number of distinct quality values tracked by the histogram
+ */
+#define QUALITY_LEVELS 256
+
 /**
  * @brief Internal soul manager structure
+ *
+ * souls[] owns the Soul objects. The remaining arrays mirror the hot
+ * fields of souls[i] at index i so scans never touch the Soul structs.
+ *
+ * Aggregates and the bitmap indexes are updated on add, remove,
+ * bind/unbind, sort and clear, so totals and counts never scan.
  */
 struct SoulManager {
     Soul** souls;       /**< Dynamic array of soul pointers */
     size_t count;       /**< Current number of souls */
-    size_t capacity;    /**< Capacity of souls array */
+    size_t capacity;    /**< Capacity of all arrays */
+    IdMap* index;       /**< Soul ID -> position in souls array */
+
+    /* Columnar copies of the hot Soul fields */
+    uint32_t* ids;              /**< Soul IDs */
+    uint8_t* types;             /**< SoulType, one byte per soul */
+    uint8_t* qualities;         /**< Quality (0-100) */
+    uint8_t* bound;             /**< 1 if bound, 0 otherwise */
+    uint32_t* energies;         /**< Energy values */
+    uint32_t* bound_minion_ids; /**< Bound minion IDs (0 if unbound) */
+
+    /* Secondary indexes: bit i set when souls[i] has the property */
+    uint64_t* type_index[SOUL_TYPE_COUNT]; /**< One bitmap per soul type */
+    uint64_t* bound_index;                 /**< Bound souls */
+
+    /* Running aggregates */
+    uint64_t total_energy;                 /**< Sum of all energies */
+    uint64_t unbound_energy;               /**< Sum of unbound energies */
+    size_t type_counts[SOUL_TYPE_COUNT];   /**< Souls per type */
+    size_t quality_counts[SOUL_TYPE_COUNT][2][QUALITY_LEVELS]; /**< [type][bound][quality] */
 };
 
+/* Bitmap helpers */
+
+static inline void bitmap_set(uint64_t* bits, size_t pos) {
+    bits[pos / 64] |= (uint64_t)1 << (pos % 64);
+}
+
+static inline void bitmap_clear(uint64_t* bits, size_t pos) {
+    bits[pos / 64] &= ~((uint64_t)1 << (pos % 64));
+}
+
+/**
+ * @brief Copy bit from into bit to, then clear bit from
+ */
+static void bitmap_move(uint64_t* bits, size_t from, size_t to) {
+    if ((bits[from / 64] >> (from % 64)) & 1) {
+        bitmap_set(bits, to);
+    } else {
+        bitmap_clear(bits, to);
+    }
+    bitmap_clear(bits, from);
+}
+
+/**
+ * @brief Add (sign = 1) or remove (sign = -1) soul i from the aggregates
+ */
+static void account_soul(SoulManager* manager, size_t i, int sign) {
+    uint8_t type = manager->types[i];
+    uint8_t bound = manager->bound[i];
+    uint32_t energy = manager->energies[i];
+
+    if (sign > 0) {
+        manager->total_energy += energy;
+        if (!bound) manager->unbound_energy += energy;
+        manager->type_counts[type]++;
+        manager->quality_counts[type][bound][manager->qualities[i]]++;
+    } else {
+        manager->total_energy -= energy;
+        if (!bound) manager->unbound_energy -= energy;
+        manager->type_counts[type]--;
+        manager->quality_counts[type][bound][manager->qualities[i]]--;
+    }
+}
+
+/**
+ * @brief Copy a soul's hot fields into column slot i and index it
+ */
+static void store_columns(SoulManager* manager, size_t i, const Soul* soul) {
+    manager->ids[i] = soul->id;
+    manager->types[i] = (uint8_t)soul->type;
+    manager->qualities[i] = soul->quality;
+    manager->bound[i] = soul->bound ? 1 : 0;
+    manager->energies[i] = soul->energy;
+    manager->bound_minion_ids[i] = soul->bound_minion_id;
+
+    bitmap_set(manager->type_index[soul->type], i);
+    if (soul->bound) {
+        bitmap_set(manager->bound_index, i);
+    }
+}
+
+static void clear_indexes(SoulManager* manager) {
+    size_t bytes = SOUL_MASK_WORDS(manager->capacity) * sizeof(uint64_t);
+    for (int t = 0; t < SOUL_TYPE_COUNT; t++) {
+        memset(manager->type_index[t], 0, bytes);
+    }
+    memset(manager->bound_index, 0, bytes);
+}
+
+/**
+ * @brief Rebuild ID index, columns and bitmaps after souls[] was reordered
+ *
+ * Aggregates are order-independent and stay as they are.
+ */
+static void rebuild_index(SoulManager* manager) {
+    id_map_clear(manager->index);
+    clear_indexes(manager);
+    for (size_t i = 0; i < manager->count; i++) {
+        id_map_put_index(manager->index, manager->souls[i]->id, i);
+        store_columns(manager, i, manager->souls[i]);
+    }
+}
+
+/**
+ * @brief Resize a bitmap, zeroing any new words
+ */
+static bool resize_bitmap(uint64_t** bits, size_t old_words, size_t new_words) {
+    uint64_t* resized = realloc(*bits, new_words * sizeof(uint64_t));
+    if (!resized) return false;
+    if (new_words > old_words) {
+        memset(resized + old_words, 0, (new_words - old_words) * sizeof(uint64_t));
+    }
+    *bits = resized;
+    return true;
+}
+
+/**
+ * @brief Resize the soul array, every column and bitmap to new_capacity
+ */
+static bool resize_storage(SoulManager* manager, size_t new_capacity) {
+    Soul** souls = realloc(manager->souls, new_capacity * sizeof(Soul*));
+    if (!souls) return false;
+    manager->souls = souls;
+
+    uint32_t* ids = realloc(manager->ids, new_capacity * sizeof(uint32_t));
+    if (!ids) return false;
+    manager->ids = ids;
+
+    uint8_t* types = realloc(manager->types, new_capacity);
+    if (!types) return false;
+    manager->types = types;
+
+    uint8_t* qualities = realloc(manager->qualities, new_capacity);
+    if (!qualities) return false;
+    manager->qualities = qualities;
+
+    uint8_t* bound = realloc(manager->bound, new_capacity);
+    if (!bound) return false;
+    manager->bound = bound;
+
+    uint32_t* energies = realloc(manager->energies, new_capacity * sizeof(uint32_t));
+    if (!energies) return false;
+    manager->energies = energies;
+
+    uint32_t* minion_ids = realloc(manager->bound_minion_ids, new_capacity * sizeof(uint32_t));
+    if (!minion_ids) return false;
+    manager->bound_minion_ids = minion_ids;
+
+    size_t old_words = SOUL_MASK_WORDS(manager->capacity);
+    size_t new_words = SOUL_MASK_WORDS(new_capacity);
+    for (int t = 0; t < SOUL_TYPE_COUNT; t++) {
+        if (!resize_bitmap(&manager->type_index[t], old_words, new_words)) return false;
+    }
+    if (!resize_bitmap(&manager->bound_index, old_words, new_words)) return false;
+
+    manager->capacity = new_capacity;
+    return true;
+}
+
+static void free_storage(SoulManager* manager) {
+    free(manager->souls);
+    free(manager->ids);
+    free(manager->types);
+    free(manager->qualities);
+    free(manager->bound);
+    free(manager->energies);
+    free(manager->bound_minion_ids);
+    for (int t = 0; t < SOUL_TYPE_COUNT; t++) {
+        free(manager->type_index[t]);
+    }
+    free(manager->bound_index);
+    id_map_destroy(manager->index);
+}
+
 /* Forward declarations for sort comparators */
 static int compare_by_id(const void* a, const void* b);
 static int compare_by_type(const void* a, const void* b);
@@ -30,19 +231,19 @@ static int compare_by_energy(const void* a, const void* b);
 static int compare_by_energy_desc(const void* a, const void* b);
 
 SoulManager* soul_manager_create(void) {
-    SoulManager* manager = (SoulManager*)malloc(sizeof(SoulManager));
+    SoulManager* manager = (SoulManager*)calloc(1, sizeof(SoulManager));
     if (!manager) {
         return NULL;
     }
 
-    manager->souls = (Soul**)malloc(INITIAL_CAPACITY * sizeof(Soul*));
-    if (!manager->souls) {
+    manager->index = id_map_create(INITIAL_CAPACITY);
+    if (!manager->index || !resize_storage(manager, INITIAL_CAPACITY)) {
+        free_storage(manager);
         free(manager);
         return NULL;
     }
 
     manager->count = 0;
-    manager->capacity = INITIAL_CAPACITY;
 
     return manager;
 }
@@ -57,7 +258,7 @@ void soul_manager_destroy(SoulManager* manager) {
         soul_destroy(manager->souls[i]);
     }
 
-    free(manager->souls);
+    free_storage(manager);
     free(manager);
 }
 
@@ -66,44 +267,96 @@ bool soul_manager_add(SoulManager* manager, Soul* soul) {
         return false;
     }
 
-    /* Grow array if needed */
+    /* Type indexes the per-type bitmaps and counters */
+    if ((unsigned)soul->type >= SOUL_TYPE_COUNT) {
+        return false;
+    }
+
+    /* Grow arrays if needed */
     if (manager->count >= manager->capacity) {
-        size_t new_capacity = manager->capacity * GROWTH_FACTOR;
-        Soul** new_souls = (Soul**)realloc(manager->souls, new_capacity * sizeof(Soul*));
-        if (!new_souls) {
+        if (!resize_storage(manager, manager->capacity * GROWTH_FACTOR)) {
             return false;
         }
-        manager->souls = new_souls;
-        manager->capacity = new_capacity;
+    }
+
+    if (!id_map_put_index(manager->index, soul->id, manager->count)) {
+        return false;
     }
 
     /* Add soul to array */
+    soul->owner = manager;
+    store_columns(manager, manager->count, soul);
+    account_soul(manager, manager->count, 1);
     manager->souls[manager->count++] = soul;
     return true;
 }
 
+bool soul_manager_reserve(SoulManager* manager, size_t count) {
+    if (!manager) {
+        return false;
+    }
+
+    size_t needed = manager->count + count;
+    if (needed > manager->capacity) {
+        size_t new_capacity = manager->capacity;
+        while (new_capacity < needed) {
+            new_capacity *= GROWTH_FACTOR;
+        }
+        if (!resize_storage(manager, new_capacity)) {
+            return false;
+        }
+    }
+
+    return id_map_reserve(manager->index, needed);
+}
+
+size_t soul_manager_add_batch(SoulManager* manager, Soul** souls, size_t count) {
+    if (!manager || !souls || !soul_manager_reserve(manager, count)) {
+        return 0;
+    }
+
+    size_t added = 0;
+    while (added < count && soul_manager_add(manager, souls[added])) {
+        added++;
+    }
+    return added;
+}
+
 bool soul_manager_remove(SoulManager* manager, uint32_t soul_id) {
     if (!manager) {
         return false;
     }
 
     /* Find soul by ID */
-    for (size_t i = 0; i < manager->count; i++) {
-        if (manager->souls[i]->id == soul_id) {
-            /* Destroy the soul */
-            soul_destroy(manager->souls[i]);
+    size_t i;
+    if (!id_map_get_index(manager->index, soul_id, &i)) {
+        return false;
+    }
 
-            /* Shift remaining souls down */
-            for (size_t j = i; j < manager->count - 1; j++) {
-                manager->souls[j] = manager->souls[j + 1];
-            }
+    /* Destroy the soul */
+    account_soul(manager, i, -1);
+    soul_destroy(manager->souls[i]);
+    id_map_remove(manager->index, soul_id);
 
-            manager->count--;
-            return true;
-        }
+    /* Move the last soul into the hole; only its index entry changes */
+    size_t last = --manager->count;
+    for (int t = 0; t < SOUL_TYPE_COUNT; t++) {
+        bitmap_move(manager->type_index[t], last, i);
+    }
+    bitmap_move(manager->bound_index, last, i);
+
+    if (i != last) {
+        manager->souls[i] = manager->souls[last];
+        manager->ids[i] = manager->ids[last];
+        manager->types[i] = manager->types[last];
+        manager->qualities[i] = manager->qualities[last];
+        manager->bound[i] = manager->bound[last];
+        manager->energies[i] = manager->energies[last];
+        manager->bound_minion_ids[i] = manager->bound_minion_ids[last];
+        id_map_put_index(manager->index, manager->ids[i], i);
     }
 
-    return false;
+    return true;
 }
 
 Soul* soul_manager_get(SoulManager* manager, uint32_t soul_id) {
@@ -111,82 +364,86 @@ Soul* soul_manager_get(SoulManager* manager, uint32_t soul_id) {
         return NULL;
     }
 
-    /* Linear search for soul by ID */
-    for (size_t i = 0; i < manager->count; i++) {
-        if (manager->souls[i]->id == soul_id) {
-            return manager->souls[i];
-        }
+    size_t i;
+    if (!id_map_get_index(manager->index, soul_id, &i)) {
+        return NULL;
     }
 
-    return NULL;
+    return manager->souls[i];
 }
 
-Soul** soul_manager_get_filtered(SoulManager* manager, const SoulFilter* filter, size_t* count_out) {
-    if (!manager || !count_out) {
-        return NULL;
+void soul_manager_sync_binding(SoulManager* manager, const Soul* soul) {
+    if (!manager || !soul) {
+        return;
     }
 
-    *count_out = 0;
-
-    /* Defensive: Ensure count doesn't exceed capacity */
-    if (manager->count > manager->capacity) {
-        /* Data corruption detected */
-        return NULL;
+    size_t i;
+    if (!id_map_get_index(manager->index, soul->id, &i) || manager->souls[i] != soul) {
+        return;
     }
 
-    /* If no filter, return all souls */
-    if (!filter) {
-        if (manager->count == 0) {
-            return NULL;
-        }
+    uint8_t bound = soul->bound ? 1 : 0;
+    if (manager->bound[i] != bound) {
+        account_soul(manager, i, -1);
+        manager->bound[i] = bound;
+        account_soul(manager, i, 1);
 
-        Soul** result = (Soul**)malloc(manager->count * sizeof(Soul*));
-        if (!result) {
-            return NULL;
+        if (bound) {
+            bitmap_set(manager->bound_index, i);
+        } else {
+            bitmap_clear(manager->bound_index, i);
         }
-
-        memcpy(result, manager->souls, manager->count * sizeof(Soul*));
-        *count_out = manager->count;
-        return result;
     }
+    manager->bound_minion_ids[i] = soul->bound_minion_id;
+}
 
-    /* Count matching souls first */
-    size_t match_count = 0;
-    for (size_t i = 0; i < manager->count; i++) {
-        /* Defensive bounds check */
-        if (i >= manager->capacity) {
-            break;
-        }
+size_t soul_manager_count_filtered(SoulManager* manager, const SoulFilter* filter) {
+    if (!manager) {
+        return 0;
+    }
+    if (!filter) {
+        return manager->count;
+    }
 
-        Soul* soul = manager->souls[i];
-        if (!soul) {
-            continue;  /* Skip NULL souls */
+    int type_first = 0;
+    int type_last = SOUL_TYPE_COUNT - 1;
+    if (filter->type != -1) {
+        if (filter->type < 0 || filter->type >= SOUL_TYPE_COUNT) {
+            return 0;
         }
+        type_first = type_last = filter->type;
+    }
 
-        bool matches = true;
+    int bound_first = filter->bound_filter == 1 ? 1 : 0;
+    int bound_last = filter->bound_filter == 0 ? 0 : 1;
 
-        /* Check type filter */
-        if (filter->type != -1 && soul->type != (SoulType)filter->type) {
-            matches = false;
+    size_t total = 0;
+    for (int t = type_first; t <= type_last; t++) {
+        for (int b = bound_first; b <= bound_last; b++) {
+            for (int q = filter->quality_min; q <= filter->quality_max; q++) {
+                total += manager->quality_counts[t][b][q];
+            }
         }
+    }
 
-        /* Check quality filter */
-        if (soul->quality < filter->quality_min || soul->quality > filter->quality_max) {
-            matches = false;
-        }
+    return total;
+}
 
-        /* Check bound filter */
-        if (filter->bound_filter == 0 && soul->bound) {
-            matches = false;
-        } else if (filter->bound_filter == 1 && !soul->bound) {
-            matches = false;
-        }
+Soul** soul_manager_get_filtered(SoulManager* manager, const SoulFilter* filter, size_t* count_out) {
+    if (!manager || !count_out) {
+        return NULL;
+    }
 
-        if (matches) {
-            match_count++;
-        }
+    *count_out = 0;
+
+    /* Defensive: Ensure count doesn't exceed capacity */
+    if (manager->count > manager->capacity) {
+        /* Data corruption detected */
+        return NULL;
     }
 
+    /* Exact result size comes from the histogram, without a scan */
+    size_t match_count = soul_manager_count_filtered(manager, filter);
     if (match_count == 0) {
         return NULL;
     }
@@ -197,44 +454,63 @@ Soul** soul_manager_get_filtered(SoulManager* manager, const SoulFilter* filter,
         return NULL;
     }
 
-    /* Fill result array with matching souls */
-    size_t result_index = 0;
-    for (size_t i = 0; i < manager->count; i++) {
-        /* Defensive bounds check */
-        if (i >= manager->capacity) {
-            break;
-        }
+    /* Everything matches (includes the NULL filter) */
+    if (match_count == manager->count) {
+        memcpy(result, manager->souls, manager->count * sizeof(Soul*));
+        *count_out = manager->count;
+        return result;
+    }
 
-        Soul* soul = manager->souls[i];
-        if (!soul) {
-            continue;  /* Skip NULL souls */
-        }
+    size_t words = SOUL_MASK_WORDS(manager->count);
+    size_t result_index = 0;
 
-        bool matches = true;
+    if (filter->type != -1) {
+        /* Walk the type bitmap, narrowed by the bound bitmap */
+        const uint64_t* type_bits = manager->type_index[filter->type];
+        bool full_quality = filter->quality_min == 0 && filter->quality_max >= 100;
+
+        for (size_t w = 0; w < words && result_index < match_count; w++) {
+            uint64_t word = type_bits[w];
+            if (filter->bound_filter == 1) {
+                word &= manager->bound_index[w];
+            } else if (filter->bound_filter == 0) {
+                word &= ~manager->bound_index[w];
+            }
 
-        /* Check type filter */
-        if (filter->type != -1 && soul->type != (SoulType)filter->type) {
-            matches = false;
+            while (word) {
+                size_t pos = w * 64 + lowest_bit(word);
+                word &= word - 1;
+                if (full_quality ||
+                    (manager->qualities[pos] >= filter->quality_min &&
+                     manager->qualities[pos] <= filter->quality_max)) {
+                    result[result_index++] = manager->souls[pos];
+                }
+            }
         }
-
-        /* Check quality filter */
-        if (soul->quality < filter->quality_min || soul->quality > filter->quality_max) {
-            matches = false;
+    } else {
+        /* Quality/bound only: vectorised scan of the columns */
+        uint64_t* mask = (uint64_t*)malloc(words * sizeof(uint64_t));
+        if (!mask) {
+            free(result);
+            return NULL;
         }
 
-        /* Check bound filter */
-        if (filter->bound_filter == 0 && soul->bound) {
-            matches = false;
-        } else if (filter->bound_filter == 1 && !soul->bound) {
-            matches = false;
-        }
+        soul_simd_filter_mask(manager->types, manager->qualities, manager->bound,
+                              manager->count, filter->type, filter->quality_min,
+                              filter->quality_max, filter->bound_filter, mask);
 
-        if (matches) {
-            result[result_index++] = soul;
+        for (size_t w = 0; w < words; w++) {
+            uint64_t word = mask[w];
+            while (word && result_index < match_count) {
+                result[result_index++] = manager->souls[w * 64 + lowest_bit(word)];
+                word &= word - 1;
+            }
         }
+
+        free(mask);
     }
 
-    *count_out = match_count;
+    *count_out = result_index;
     return result;
 }
 
@@ -271,6 +547,7 @@ void soul_manager_sort(SoulManager* manager, SoulSortCriteria criteria) {
 
     /* Sort using qsort */
     qsort(manager->souls, manager->count, sizeof(Soul*), comparator);
+    rebuild_index(manager);
 }
 
 size_t soul_manager_count(SoulManager* manager) {
@@ -285,42 +562,27 @@ size_t soul_manager_count_by_type(SoulManager* manager, SoulType type) {
         return 0;
     }
 
-    size_t count = 0;
-    for (size_t i = 0; i < manager->count; i++) {
-        if (manager->souls[i]->type == type) {
-            count++;
-        }
+    if ((unsigned)type >= SOUL_TYPE_COUNT) {
+        return 0;
     }
 
-    return count;
+    return manager->type_counts[type];
 }
 
-uint32_t soul_manager_total_energy(SoulManager* manager) {
+uint64_t soul_manager_total_energy(SoulManager* manager) {
     if (!manager) {
         return 0;
     }
 
-    uint32_t total = 0;
-    for (size_t i = 0; i < manager->count; i++) {
-        total += manager->souls[i]->energy;
-    }
-
-    return total;
+    return manager->total_energy;
 }
 
-uint32_t soul_manager_total_unbound_energy(SoulManager* manager) {
+uint64_t soul_manager_total_unbound_energy(SoulManager* manager) {
     if (!manager) {
         return 0;
     }
 
-    uint32_t total = 0;
-    for (size_t i = 0; i < manager->count; i++) {
-        if (!manager->souls[i]->bound) {
-            total += manager->souls[i]->energy;
-        }
-    }
-
-    return total;
+    return manager->unbound_energy;
 }
 
 void soul_manager_clear(SoulManager* manager) {
@@ -334,6 +596,12 @@ void soul_manager_clear(SoulManager* manager) {
     }
 
     manager->count = 0;
+    id_map_clear(manager->index);
+    clear_indexes(manager);
+    manager->total_energy = 0;
+    manager->unbound_energy = 0;
+    memset(manager->type_counts, 0, sizeof(manager->type_counts));
+    memset(manager->quality_counts, 0, sizeof(manager->quality_counts));
 }
 
 SoulFilter soul_filter_default(void) {
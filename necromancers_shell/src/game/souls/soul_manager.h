@@ -10,6 +10,15 @@
  * @brief Soul collection management system
  *
  * Manages a collection of souls with filtering, sorting, and querying capabilities.
+ *
+ * Besides the Soul objects themselves the manager keeps the hot fields
+ * (id, type, quality, energy, bound state) in parallel columns, so
+ * filters scan a few contiguous bytes per soul instead of chasing
+ * pointers, using SSE2/AVX2 intrinsics on x86 and a scalar loop
+ * elsewhere (see soul_simd.h). Energy totals, per-type counts and
+ * a per-type/bound/quality histogram are maintained incrementally, and
+ * per-type and bound bitmaps index array positions, so totals, counts
+ * and type-filtered queries never scan the whole collection.
  */
 
 /**
@@ -67,14 +76,42 @@ void soul_manager_destroy(SoulManager* manager);
  *
  * @param manager Pointer to soul manager
  * @param soul Pointer to soul to add
- * @return true on success, false on failure
+ * @return true on success, false on failure (including an invalid soul type)
  */
 bool soul_manager_add(SoulManager* manager, Soul* soul);
 
+/**
+ * @brief Make room for additional souls
+ *
+ * Grows the columns and ID index once so the next count additions do
+ * not reallocate.
+ *
+ * @param manager Pointer to soul manager
+ * @param count Number of souls about to be added
+ * @return true on success, false on allocation failure
+ */
+bool soul_manager_reserve(SoulManager* manager, size_t count);
+
+/**
+ * @brief Add several souls to the manager
+ *
+ * Reserves capacity once, then adds each soul as soul_manager_add()
+ * would, stopping at the first soul it cannot add (invalid type or
+ * allocation failure). The manager takes ownership of the souls it
+ * added; the rest remain owned by the caller.
+ *
+ * @param manager Pointer to soul manager
+ * @param souls Array of souls to add
+ * @param count Number of souls
+ * @return Number of souls added (the first n of the array)
+ */
+size_t soul_manager_add_batch(SoulManager* manager, Soul** souls, size_t count);
+
 /**
  * @brief Remove a soul from the manager by ID
  *
- * The soul is destroyed after removal.
+ * The soul is destroyed after removal. The last soul takes its place,
+ * so manager order is not preserved.
  *
  * @param manager Pointer to soul manager
  * @param soul_id ID of soul to remove
@@ -94,10 +131,34 @@ bool soul_manager_remove(SoulManager* manager, uint32_t soul_id);
  */
 Soul* soul_manager_get(SoulManager* manager, uint32_t soul_id);
 
+/**
+ * @brief Refresh a managed soul's bound state in the manager's columns
+ *
+ * Called by soul_bind() and soul_unbind() for souls that have an owner;
+ * other code does not normally need to call it.
+ *
+ * @param manager Pointer to soul manager
+ * @param soul Soul whose bound/bound_minion_id fields changed
+ */
+void soul_manager_sync_binding(SoulManager* manager, const Soul* soul);
+
+/**
+ * @brief Count souls matching a filter without scanning
+ *
+ * Answered from the maintained histogram in time independent of the
+ * number of souls.
+ *
+ * @param manager Pointer to soul manager
+ * @param filter Pointer to filter criteria (NULL counts all souls)
+ * @return Number of matching souls
+ */
+size_t soul_manager_count_filtered(SoulManager* manager, const SoulFilter* filter);
+
 /**
  * @brief Get filtered list of souls
  *
- * Returns an array of pointers to souls matching the filter.
+ * Returns an array of pointers to souls matching the filter, in manager
+ * order (which removals reshuffle; sort by ID for stable listings).
  * The caller must free the returned array (but not the souls themselves).
  *
  * @param manager Pointer to soul manager
@@ -140,7 +201,7 @@ size_t soul_manager_count_by_type(SoulManager* manager, SoulType type);
  * @param manager Pointer to soul manager
  * @return Sum of energy from all souls
  */
-uint32_t soul_manager_total_energy(SoulManager* manager);
+uint64_t soul_manager_total_energy(SoulManager* manager);
 
 /**
  * @brief Calculate total energy of unbound souls
@@ -148,7 +209,7 @@ uint32_t soul_manager_total_energy(SoulManager* manager);
  * @param manager Pointer to soul manager
  * @return Sum of energy from unbound souls
  */
-uint32_t soul_manager_total_unbound_energy(SoulManager* manager);
+uint64_t soul_manager_total_unbound_energy(SoulManager* manager);
 
 /**
  * @brief Clear all souls from the manager
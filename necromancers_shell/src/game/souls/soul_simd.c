@@ -0,0 +1,132 @@
+#include "soul_simd.h"
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SOUL_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SOUL_SIMD_SSE2 1
+#endif
+
+static inline unsigned popcount64(uint64_t x) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (unsigned)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+static inline bool soul_matches(uint8_t type, uint8_t quality, uint8_t bound,
+                                int want_type, uint8_t quality_min,
+                                uint8_t quality_max, int bound_filter) {
+    if (want_type != -1 && type != (uint8_t)want_type) return false;
+    if (quality < quality_min || quality > quality_max) return false;
+    if (bound_filter == 0 && bound) return false;
+    if (bound_filter == 1 && !bound) return false;
+    return true;
+}
+
+#if defined(SOUL_SIMD_AVX2)
+/* Match bits for 32 souls starting at i */
+static inline uint32_t filter_lanes(const uint8_t* types, const uint8_t* qualities,
+                                    const uint8_t* bound, size_t i,
+                                    int type, uint8_t quality_min,
+                                    uint8_t quality_max, int bound_filter) {
+    __m256i m = _mm256_set1_epi8(-1);
+
+    if (type != -1) {
+        __m256i t = _mm256_loadu_si256((const __m256i*)(types + i));
+        m = _mm256_and_si256(m, _mm256_cmpeq_epi8(t, _mm256_set1_epi8((char)type)));
+    }
+
+    /* Unsigned range test: q >= min <=> max(q, min) == q */
+    __m256i q = _mm256_loadu_si256((const __m256i*)(qualities + i));
+    __m256i ge = _mm256_cmpeq_epi8(_mm256_max_epu8(q, _mm256_set1_epi8((char)quality_min)), q);
+    __m256i le = _mm256_cmpeq_epi8(_mm256_min_epu8(q, _mm256_set1_epi8((char)quality_max)), q);
+    m = _mm256_and_si256(m, _mm256_and_si256(ge, le));
+
+    if (bound_filter != -1) {
+        __m256i b = _mm256_loadu_si256((const __m256i*)(bound + i));
+        __m256i unbound = _mm256_cmpeq_epi8(b, _mm256_setzero_si256());
+        m = bound_filter == 0 ? _mm256_and_si256(m, unbound)
+                              : _mm256_andnot_si256(unbound, m);
+    }
+
+    return (uint32_t)_mm256_movemask_epi8(m);
+}
+#define FILTER_LANES 32
+#elif defined(SOUL_SIMD_SSE2)
+/* Match bits for 16 souls starting at i */
+static inline uint32_t filter_lanes(const uint8_t* types, const uint8_t* qualities,
+                                    const uint8_t* bound, size_t i,
+                                    int type, uint8_t quality_min,
+                                    uint8_t quality_max, int bound_filter) {
+    __m128i m = _mm_set1_epi8(-1);
+
+    if (type != -1) {
+        __m128i t = _mm_loadu_si128((const __m128i*)(types + i));
+        m = _mm_and_si128(m, _mm_cmpeq_epi8(t, _mm_set1_epi8((char)type)));
+    }
+
+    /* Unsigned range test: q >= min <=> max(q, min) == q */
+    __m128i q = _mm_loadu_si128((const __m128i*)(qualities + i));
+    __m128i ge = _mm_cmpeq_epi8(_mm_max_epu8(q, _mm_set1_epi8((char)quality_min)), q);
+    __m128i le = _mm_cmpeq_epi8(_mm_min_epu8(q, _mm_set1_epi8((char)quality_max)), q);
+    m = _mm_and_si128(m, _mm_and_si128(ge, le));
+
+    if (bound_filter != -1) {
+        __m128i b = _mm_loadu_si128((const __m128i*)(bound + i));
+        __m128i unbound = _mm_cmpeq_epi8(b, _mm_setzero_si128());
+        m = bound_filter == 0 ? _mm_and_si128(m, unbound)
+                              : _mm_andnot_si128(unbound, m);
+    }
+
+    return (uint32_t)_mm_movemask_epi8(m);
+}
+#define FILTER_LANES 16
+#endif
+
+size_t soul_simd_filter_mask(const uint8_t* types, const uint8_t* qualities,
+                             const uint8_t* bound, size_t count,
+                             int type, uint8_t quality_min, uint8_t quality_max,
+                             int bound_filter, uint64_t* mask_out) {
+    size_t words = SOUL_MASK_WORDS(count);
+    if (!mask_out || words == 0) return 0;
+
+    memset(mask_out, 0, words * sizeof(uint64_t));
+
+    /* No soul can have a type outside the byte range */
+    if (type < -1 || type > 255) return 0;
+    if (bound_filter != 0 && bound_filter != 1) bound_filter = -1;
+
+    size_t matches = 0;
+    size_t i = 0;
+
+#if defined(FILTER_LANES)
+    for (; i + 64 <= count; i += 64) {
+        uint64_t word = 0;
+        for (unsigned lane = 0; lane < 64; lane += FILTER_LANES) {
+            uint64_t bits = filter_lanes(types, qualities, bound, i + lane, type,
+                                         quality_min, quality_max, bound_filter);
+            word |= bits << lane;
+        }
+        mask_out[i / 64] = word;
+        matches += popcount64(word);
+    }
+#endif
+
+    for (; i < count; i++) {
+        if (soul_matches(types[i], qualities[i], bound[i], type,
+                         quality_min, quality_max, bound_filter)) {
+            mask_out[i / 64] |= (uint64_t)1 << (i % 64);
+            matches++;
+        }
+    }
+
+    return matches;
+}
@@ -0,0 +1,46 @@
+#ifndef SOUL_SIMD_H
+#define SOUL_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file soul_simd.h
+ * @brief Vectorised filter kernel over SoulManager's columnar soul data
+ *
+ * The soul manager keeps the hot soul fields in parallel arrays (one
+ * byte per soul for type, quality and bound flag). The filter scans
+ * those columns 32 souls at a time with AVX2, 16 at a time with SSE2,
+ * and fall back to plain loops elsewhere.
+ * The instruction set is picked at compile time (-mavx2 enables AVX2;
+ * SSE2 is always available on x86-64).
+ */
+
+/**
+ * @brief Number of 64-bit words needed for a mask over count souls
+ */
+#define SOUL_MASK_WORDS(count) (((count) + 63) / 64)
+
+/**
+ * @brief Build a match bitmask for a soul filter
+ *
+ * Bit i of the mask is set when soul i has the requested type, a quality
+ * in [quality_min, quality_max] and the requested bound state.
+ *
+ * @param types Type column
+ * @param qualities Quality column
+ * @param bound Bound flag column (0 or 1)
+ * @param count Number of souls
+ * @param type Required type (-1 for any)
+ * @param quality_min Minimum quality (inclusive)
+ * @param quality_max Maximum quality (inclusive)
+ * @param bound_filter -1 any, 0 unbound only, 1 bound only
+ * @param mask_out Output mask of SOUL_MASK_WORDS(count) words
+ * @return Number of matching souls
+ */
+size_t soul_simd_filter_mask(const uint8_t* types, const uint8_t* qualities,
+                             const uint8_t* bound, size_t count,
+                             int type, uint8_t quality_min, uint8_t quality_max,
+                             int bound_filter, uint64_t* mask_out);
+
+#endif /* SOUL_SIMD_H */
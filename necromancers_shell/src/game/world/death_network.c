@@ -5,12 +5,17 @@
 
 #include "death_network.h"
 #include "../../utils/logger.h"
+#include "../../utils/rng.h"
+#include "../../utils/id_map.h"
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+#include <math.h>
 
-/* Maximum nodes in network */
-#define MAX_DEATH_NODES 256
+/* Initial node capacity (grows by doubling) */
+#define INITIAL_NODE_CAPACITY 16
+
+/* Number of corpse quality tiers */
+#define QUALITY_TIERS 5
 
 /* Death signature thresholds */
 #define SIGNATURE_DORMANT 20
@@ -21,20 +26,146 @@
 /* Signature decay rate per hour (reduces by 1 every N hours) */
 #define SIGNATURE_DECAY_HOURS 24
 
+/* Chance of at least one random event per node per day */
+#define RANDOM_EVENT_CHANCE_PER_DAY 0.05
+
+/* Updates at least this long take the analytic fast-forward path */
+#define FAST_FORWARD_MIN_HOURS (24 * 30)
+
+/*
+ * A fast-forward replays only the events in this final stretch one by
+ * one. A signature rises at most to 100 and falls one point a day, and
+ * events average well under a point a day, so the effect of older events
+ * on the final signature is negligible.
+ */
+#define FAST_FORWARD_TAIL_HOURS (24 * 256)
+
+/* Events replayed per node per fast-forward, far above the tail's mean */
+#define FAST_FORWARD_MAX_TAIL_EVENTS 128
+
+/* Beyond this many events, a node's death total is drawn from its normal approximation */
+#define EXACT_DEATH_SUM_EVENTS 64
+
 /**
  * @brief Death Network structure
+ *
+ * Nodes are stored as a struct of arrays indexed by slot, so the hourly
+ * update sweeps a few dense columns instead of striding over whole
+ * nodes. Columns touched by every update come first. DeathNode is only
+ * assembled on request, in views.
  */
 struct DeathNetwork {
-    DeathNode nodes[MAX_DEATH_NODES];  /**< Array of death nodes */
-    size_t node_count;                  /**< Number of active nodes */
+    /* Swept by every update */
+    uint32_t* available_corpses;        /**< Current corpses available */
+    uint32_t* max_corpses;              /**< Maximum corpse capacity */
+    uint32_t* total_deaths;             /**< Total deaths since game start */
+    uint32_t* hours_since_harvest;      /**< Hours since last harvest */
+    uint32_t* hours_since_event;        /**< Hours since last major event */
+    uint8_t* signature;                 /**< Current death energy (0-100) */
+    uint8_t* base_signature;            /**< Signature decays toward this */
+    uint8_t* hours_per_corpse;          /**< 24 / regen_rate, 0 = no regeneration */
+
+    /* Read on lookups, events and harvests */
+    uint32_t* location_id;              /**< Associated location ID */
+    uint8_t* regen_rate;                /**< Corpses regenerated per day */
+    uint8_t (*quality)[QUALITY_TIERS];  /**< Quality distribution (%) */
+    DeathEventType* last_event_type;    /**< Most recent death event */
+    uint8_t* flow_strength;             /**< Energy flow to connected nodes */
+    bool* is_active;                    /**< Whether node is generating */
+
+    DeathNode* views;                   /**< Snapshots for death_network_get_node */
+
+    /* Max-heap of slots by signature, for hotspot queries */
+    size_t* heap;                       /**< Heap position -> slot */
+    size_t* heap_pos;                   /**< Slot -> heap position */
+    size_t* frontier;                   /**< Scratch heap of positions for queries */
+
+    IdMap* index;                       /**< Key: location_id, Value: slot */
+    size_t node_count;                  /**< Number of nodes */
+    size_t capacity;                    /**< Allocated slots per column */
     uint32_t current_time_hours;        /**< Current game time in hours */
     uint32_t total_deaths_tracked;      /**< Total deaths across network */
 };
 
+/**
+ * @brief Deaths per random event: min + [0, span)
+ */
+typedef struct {
+    uint32_t min;
+    uint32_t span;
+} DeathRange;
+
+static const DeathRange EVENT_DEATHS[DEATH_EVENT_COUNT] = {
+    [DEATH_EVENT_NATURAL]   = {1, 3},
+    [DEATH_EVENT_BATTLE]    = {5, 15},
+    [DEATH_EVENT_PLAGUE]    = {10, 20},
+    [DEATH_EVENT_EXECUTION] = {1, 5},
+    [DEATH_EVENT_SACRIFICE] = {1, 5},
+    [DEATH_EVENT_ACCIDENT]  = {1, 5},
+    [DEATH_EVENT_MURDER]    = {1, 5}
+};
+
 /* ========================================================================
  * Creation and Destruction
  * ======================================================================== */
 
+#define GROW_COLUMN(network, column, count) \
+    do { \
+        void* grown = realloc((network)->column, sizeof(*(network)->column) * (count)); \
+        if (!grown) return false; \
+        (network)->column = grown; \
+    } while (0)
+
+/**
+ * @brief Grow every column to hold capacity nodes
+ *
+ * Columns that grew before a failure keep their larger size; the
+ * recorded capacity only changes once all of them have grown.
+ */
+static bool reserve_nodes(DeathNetwork* network, size_t capacity) {
+    GROW_COLUMN(network, available_corpses, capacity);
+    GROW_COLUMN(network, max_corpses, capacity);
+    GROW_COLUMN(network, total_deaths, capacity);
+    GROW_COLUMN(network, hours_since_harvest, capacity);
+    GROW_COLUMN(network, hours_since_event, capacity);
+    GROW_COLUMN(network, signature, capacity);
+    GROW_COLUMN(network, base_signature, capacity);
+    GROW_COLUMN(network, hours_per_corpse, capacity);
+    GROW_COLUMN(network, location_id, capacity);
+    GROW_COLUMN(network, regen_rate, capacity);
+    GROW_COLUMN(network, quality, capacity);
+    GROW_COLUMN(network, last_event_type, capacity);
+    GROW_COLUMN(network, flow_strength, capacity);
+    GROW_COLUMN(network, is_active, capacity);
+    GROW_COLUMN(network, views, capacity);
+    GROW_COLUMN(network, heap, capacity);
+    GROW_COLUMN(network, heap_pos, capacity);
+    GROW_COLUMN(network, frontier, capacity);
+    network->capacity = capacity;
+    return true;
+}
+
+static void free_nodes(DeathNetwork* network) {
+    free(network->available_corpses);
+    free(network->max_corpses);
+    free(network->total_deaths);
+    free(network->hours_since_harvest);
+    free(network->hours_since_event);
+    free(network->signature);
+    free(network->base_signature);
+    free(network->hours_per_corpse);
+    free(network->location_id);
+    free(network->regen_rate);
+    free(network->quality);
+    free(network->last_event_type);
+    free(network->flow_strength);
+    free(network->is_active);
+    free(network->views);
+    free(network->heap);
+    free(network->heap_pos);
+    free(network->frontier);
+}
+
 DeathNetwork* death_network_create(void) {
     DeathNetwork* network = calloc(1, sizeof(DeathNetwork));
     if (!network) {
@@ -42,8 +173,14 @@ DeathNetwork* death_network_create(void) {
         return NULL;
     }
 
-    /* Initialize with current time seed for random events */
-    srand((unsigned int)time(NULL));
+    network->index = id_map_create(INITIAL_NODE_CAPACITY);
+    if (!network->index || !reserve_nodes(network, INITIAL_NODE_CAPACITY)) {
+        LOG_ERROR("Failed to allocate death network nodes");
+        free_nodes(network);
+        id_map_destroy(network->index);
+        free(network);
+        return NULL;
+    }
 
     LOG_DEBUG("Death network created");
     return network;
@@ -54,13 +191,161 @@ void death_network_destroy(DeathNetwork* network) {
 
     LOG_DEBUG("Destroying death network (tracked %u deaths)",
               network->total_deaths_tracked);
+    free_nodes(network);
+    id_map_destroy(network->index);
     free(network);
 }
 
+/* ========================================================================
+ * Signature Heap
+ * ======================================================================== */
+
+/*
+ * Slots are kept in a binary max-heap keyed by signature, ties broken by
+ * insertion order. Single signature changes repair it in O(log n); sweeps
+ * that touch every node rebuild it in O(n).
+ */
+
+/* Whether slot a ranks above slot b */
+static inline bool ranks_above(const DeathNetwork* network, size_t a, size_t b) {
+    if (network->signature[a] != network->signature[b]) {
+        return network->signature[a] > network->signature[b];
+    }
+    return a < b;
+}
+
+static inline void heap_place(DeathNetwork* network, size_t pos, size_t slot) {
+    network->heap[pos] = slot;
+    network->heap_pos[slot] = pos;
+}
+
+static void heap_sift_up(DeathNetwork* network, size_t pos) {
+    size_t slot = network->heap[pos];
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (!ranks_above(network, slot, network->heap[parent])) break;
+        heap_place(network, pos, network->heap[parent]);
+        pos = parent;
+    }
+    heap_place(network, pos, slot);
+}
+
+static void heap_sift_down(DeathNetwork* network, size_t pos) {
+    size_t n = network->node_count;
+    size_t slot = network->heap[pos];
+    for (;;) {
+        size_t child = pos * 2 + 1;
+        if (child >= n) break;
+        if (child + 1 < n && ranks_above(network, network->heap[child + 1], network->heap[child])) {
+            child++;
+        }
+        if (!ranks_above(network, network->heap[child], slot)) break;
+        heap_place(network, pos, network->heap[child]);
+        pos = child;
+    }
+    heap_place(network, pos, slot);
+}
+
+/**
+ * @brief Restore heap order after the signature of one slot changed
+ */
+static void heap_update(DeathNetwork* network, size_t slot) {
+    size_t pos = network->heap_pos[slot];
+    heap_sift_up(network, pos);
+    heap_sift_down(network, network->heap_pos[slot]);
+}
+
+/**
+ * @brief Restore heap order after signatures changed across the network
+ */
+static void heap_rebuild(DeathNetwork* network) {
+    for (size_t pos = network->node_count / 2; pos-- > 0;) {
+        heap_sift_down(network, pos);
+    }
+}
+
+/* Whether heap position a ranks above heap position b */
+static inline bool position_above(const DeathNetwork* network, size_t a, size_t b) {
+    return ranks_above(network, network->heap[a], network->heap[b]);
+}
+
+static void frontier_push(const DeathNetwork* network, size_t* frontier,
+                          size_t* count, size_t pos) {
+    size_t at = (*count)++;
+    while (at > 0) {
+        size_t parent = (at - 1) / 2;
+        if (!position_above(network, pos, frontier[parent])) break;
+        frontier[at] = frontier[parent];
+        at = parent;
+    }
+    frontier[at] = pos;
+}
+
+static size_t frontier_pop(const DeathNetwork* network, size_t* frontier, size_t* count) {
+    size_t top = frontier[0];
+    size_t last = frontier[--(*count)];
+    size_t at = 0;
+    for (;;) {
+        size_t child = at * 2 + 1;
+        if (child >= *count) break;
+        if (child + 1 < *count && position_above(network, frontier[child + 1], frontier[child])) {
+            child++;
+        }
+        if (!position_above(network, frontier[child], last)) break;
+        frontier[at] = frontier[child];
+        at = child;
+    }
+    frontier[at] = last;
+    return top;
+}
+
+/**
+ * @brief List locations by descending signature
+ *
+ * Walks the heap best-first with a second heap of candidate positions,
+ * which holds at most one more entry than has been popped. Costs
+ * O(k log k) for k results and allocates nothing.
+ *
+ * @param min_signature Stop at the first node below this
+ * @param has_skip Whether to leave out skip_id
+ * @param skip_id Location to leave out
+ */
+static size_t top_signatures(const DeathNetwork* network, DeathSignature min_signature,
+                             bool has_skip, uint32_t skip_id,
+                             uint32_t* results, size_t max_results) {
+    size_t n = network->node_count;
+    if (n == 0) return 0;
+
+    /* The scratch heap is query state only, like the node views */
+    size_t* frontier = ((DeathNetwork*)network)->frontier;
+    size_t frontier_count = 0;
+    frontier_push(network, frontier, &frontier_count, 0);
+
+    size_t count = 0;
+    while (frontier_count > 0 && count < max_results) {
+        size_t pos = frontier_pop(network, frontier, &frontier_count);
+        size_t slot = network->heap[pos];
+        if (network->signature[slot] < min_signature) break;
+        if (!has_skip || network->location_id[slot] != skip_id) {
+            results[count++] = network->location_id[slot];
+        }
+
+        size_t child = pos * 2 + 1;
+        if (child < n) frontier_push(network, frontier, &frontier_count, child);
+        if (child + 1 < n) frontier_push(network, frontier, &frontier_count, child + 1);
+    }
+
+    return count;
+}
+
 /* ========================================================================
  * Node Management
  * ======================================================================== */
 
+static bool find_slot(const DeathNetwork* network, uint32_t location_id, size_t* slot) {
+    return id_map_get_index(network->index, location_id, slot);
+}
+
 bool death_network_add_location(DeathNetwork* network,
                                  uint32_t location_id,
                                  DeathSignature base_signature,
@@ -68,41 +353,55 @@ bool death_network_add_location(DeathNetwork* network,
                                  uint8_t regen_rate) {
     if (!network) return false;
 
-    if (network->node_count >= MAX_DEATH_NODES) {
-        LOG_ERROR("Death network is full (max %d nodes)", MAX_DEATH_NODES);
+    /* Check for duplicate */
+    if (id_map_contains(network->index, location_id)) {
+        LOG_WARN("Location %u already in death network", location_id);
         return false;
     }
 
-    /* Check for duplicate */
-    for (size_t i = 0; i < network->node_count; i++) {
-        if (network->nodes[i].location_id == location_id) {
-            LOG_WARN("Location %u already in death network", location_id);
-            return false;
-        }
+    if (network->node_count >= network->capacity &&
+        !reserve_nodes(network, network->capacity * 2)) {
+        LOG_ERROR("Failed to grow death network beyond %zu nodes", network->capacity);
+        return false;
     }
 
-    /* Initialize new node */
-    DeathNode* node = &network->nodes[network->node_count];
-    memset(node, 0, sizeof(DeathNode));
+    size_t i = network->node_count;
+    if (!id_map_put_index(network->index, location_id, i)) {
+        LOG_ERROR("Failed to index death node for location %u", location_id);
+        return false;
+    }
 
-    node->location_id = location_id;
-    node->signature = base_signature;
-    node->base_signature = base_signature;
-    node->max_corpses = max_corpses;
-    node->regen_rate = regen_rate;
-    node->is_active = true;
+    /* Initialize new node */
+    network->location_id[i] = location_id;
+    network->signature[i] = base_signature;
+    network->base_signature[i] = base_signature;
+    network->max_corpses[i] = max_corpses;
+    network->regen_rate[i] = regen_rate;
+    network->is_active[i] = true;
+    network->total_deaths[i] = 0;
+    network->hours_since_harvest[i] = 0;
+    network->hours_since_event[i] = 0;
+    network->last_event_type[i] = DEATH_EVENT_NATURAL;
+    network->flow_strength[i] = 0;
+
+    /* More than 24 a day still means at least one corpse per hour */
+    uint32_t hours_per_corpse = regen_rate > 0 ? 24 / regen_rate : 0;
+    if (regen_rate > 0 && hours_per_corpse == 0) hours_per_corpse = 1;
+    network->hours_per_corpse[i] = (uint8_t)hours_per_corpse;
 
     /* Start with 50% of max corpses */
-    node->available_corpses = max_corpses / 2;
+    network->available_corpses[i] = max_corpses / 2;
 
     /* Default quality distribution (adjust per location type) */
-    node->quality_poor = 50;
-    node->quality_average = 30;
-    node->quality_good = 15;
-    node->quality_excellent = 4;
-    node->quality_legendary = 1;
+    network->quality[i][DEATH_QUALITY_POOR] = 50;
+    network->quality[i][DEATH_QUALITY_AVERAGE] = 30;
+    network->quality[i][DEATH_QUALITY_GOOD] = 15;
+    network->quality[i][DEATH_QUALITY_EXCELLENT] = 4;
+    network->quality[i][DEATH_QUALITY_LEGENDARY] = 1;
 
     network->node_count++;
+    heap_place(network, i, i);
+    heap_sift_up(network, i);
 
     LOG_DEBUG("Added location %u to death network (signature: %u, max corpses: %u)",
               location_id, base_signature, max_corpses);
@@ -114,13 +413,29 @@ const DeathNode* death_network_get_node(const DeathNetwork* network,
                                          uint32_t location_id) {
     if (!network) return NULL;
 
-    for (size_t i = 0; i < network->node_count; i++) {
-        if (network->nodes[i].location_id == location_id) {
-            return &network->nodes[i];
-        }
-    }
-
-    return NULL;
+    size_t i;
+    if (!find_slot(network, location_id, &i)) return NULL;
+
+    /* Views are a cache of the columns, like the graph's compiled adjacency */
+    DeathNode* node = &((DeathNetwork*)network)->views[i];
+    node->location_id = network->location_id[i];
+    node->signature = network->signature[i];
+    node->base_signature = network->base_signature[i];
+    node->available_corpses = network->available_corpses[i];
+    node->max_corpses = network->max_corpses[i];
+    node->total_deaths = network->total_deaths[i];
+    node->quality_poor = network->quality[i][DEATH_QUALITY_POOR];
+    node->quality_average = network->quality[i][DEATH_QUALITY_AVERAGE];
+    node->quality_good = network->quality[i][DEATH_QUALITY_GOOD];
+    node->quality_excellent = network->quality[i][DEATH_QUALITY_EXCELLENT];
+    node->quality_legendary = network->quality[i][DEATH_QUALITY_LEGENDARY];
+    node->hours_since_harvest = network->hours_since_harvest[i];
+    node->regen_rate = network->regen_rate[i];
+    node->last_event_type = network->last_event_type[i];
+    node->hours_since_event = network->hours_since_event[i];
+    node->is_active = network->is_active[i];
+    node->flow_strength = network->flow_strength[i];
+    return node;
 }
 
 /* ========================================================================
@@ -128,166 +443,359 @@ const DeathNode* death_network_get_node(const DeathNetwork* network,
  * ======================================================================== */
 
 /**
- * @brief Regenerate corpses for a node based on time passage
+ * @brief Regenerate corpses on every node over (from, from + hours]
+ *
+ * Each node gains a corpse at every multiple of hours_per_corpse on the
+ * network clock, so splitting an interval into steps never loses the
+ * remainder hours. The interval is the same for every node, so the count
+ * for each possible divisor is computed once and the sweep itself has no
+ * division or branches.
  */
-static void regenerate_corpses(DeathNode* node, uint32_t hours) {
-    if (!node->is_active) return;
+static void regenerate_corpses(DeathNetwork* network, uint32_t from, uint32_t hours) {
+    uint32_t to = from + hours;
+    uint32_t gained_for[25];
+    gained_for[0] = 0;
+    for (uint32_t per = 1; per <= 24; per++) {
+        gained_for[per] = to / per - from / per;
+    }
 
-    /* Calculate corpses to add based on regen rate and time */
-    /* regen_rate = corpses per 24 hours */
-    if (node->regen_rate == 0) return;
+    size_t n = network->node_count;
+    uint32_t* restrict available = network->available_corpses;
+    uint32_t* restrict total = network->total_deaths;
+    const uint32_t* restrict max = network->max_corpses;
+    const uint8_t* restrict per = network->hours_per_corpse;
+    const bool* restrict active = network->is_active;
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t gained = active[i] ? gained_for[per[i]] : 0;
+        uint32_t capped = available[i] + gained;
+        if (capped > max[i] && gained > 0) capped = max[i];
+        available[i] = capped;
+        total[i] += gained;
+    }
+}
 
-    uint32_t hours_per_corpse = 24 / node->regen_rate;
-    uint32_t corpses_to_add = hours / hours_per_corpse;
+/* Move a signature toward its base by up to amount points */
+static inline uint8_t relax_signature(uint8_t signature, uint8_t base, uint32_t amount) {
+    int32_t step = amount > UINT8_MAX ? UINT8_MAX : (int32_t)amount;
+    int32_t diff = (int32_t)base - (int32_t)signature;
+    int32_t distance = diff < 0 ? -diff : diff;
+    int32_t move = distance < step ? distance : step;
+    return (uint8_t)(signature + (diff < 0 ? -move : move));
+}
 
-    if (corpses_to_add > 0) {
-        node->available_corpses += corpses_to_add;
-        if (node->available_corpses > node->max_corpses) {
-            node->available_corpses = node->max_corpses;
-        }
-        node->total_deaths += corpses_to_add;
+/* Signature decay points between two times on the network clock */
+static inline uint32_t decay_between(uint32_t from, uint32_t to) {
+    return to / SIGNATURE_DECAY_HOURS - from / SIGNATURE_DECAY_HOURS;
+}
+
+/**
+ * @brief Move every signature toward its base by one at each multiple of
+ * SIGNATURE_DECAY_HOURS in (from, from + hours]
+ */
+static void decay_signatures(DeathNetwork* network, uint32_t from, uint32_t hours) {
+    uint32_t decay_amount = decay_between(from, from + hours);
+    if (decay_amount == 0) return;
+
+    size_t n = network->node_count;
+    uint8_t* restrict signature = network->signature;
+    const uint8_t* restrict base = network->base_signature;
+
+    for (size_t i = 0; i < n; i++) {
+        signature[i] = relax_signature(signature[i], base[i], decay_amount);
     }
+    heap_rebuild(network);
+}
+
+/* Signature gained from an event's deaths */
+static uint32_t signature_gain(uint32_t death_count) {
+    uint32_t gain = death_count / 2;
+    return gain > 30 ? 30 : gain;  /* Cap at +30 */
 }
 
 /**
- * @brief Decay death signature over time
+ * @brief Apply a death event to the node in slot i
  */
-static void decay_signature(DeathNode* node, uint32_t hours) {
-    /* Signature decays back toward base over time */
-    uint32_t decay_amount = hours / SIGNATURE_DECAY_HOURS;
-
-    if (node->signature > node->base_signature) {
-        /* Decay down */
-        uint32_t diff = (uint32_t)(node->signature - node->base_signature);
-        if (decay_amount > diff) {
-            node->signature = node->base_signature;
-        } else {
-            node->signature -= (DeathSignature)decay_amount;
-        }
-    } else if (node->signature < node->base_signature) {
-        /* Grow back up */
-        uint32_t diff = (uint32_t)(node->base_signature - node->signature);
-        if (decay_amount > diff) {
-            node->signature = node->base_signature;
-        } else {
-            node->signature += (DeathSignature)decay_amount;
-        }
+static void apply_event(DeathNetwork* network, size_t i, const DeathEvent* event) {
+    /* Increase death signature based on event magnitude */
+    uint32_t signature = network->signature[i] + signature_gain(event->death_count);
+    network->signature[i] = (DeathSignature)(signature > 100 ? 100 : signature);
+    heap_update(network, i);
+
+    /* Add corpses */
+    network->available_corpses[i] += event->death_count;
+    if (network->available_corpses[i] > network->max_corpses[i]) {
+        network->available_corpses[i] = network->max_corpses[i];
     }
+
+    /* Update tracking */
+    network->total_deaths[i] += event->death_count;
+    network->last_event_type[i] = event->type;
+    network->hours_since_event[i] = 0;
+
+    network->total_deaths_tracked += event->death_count;
+}
+
+/* Draw a random event's type and death count */
+static DeathEventType roll_event(Rng* rng, uint32_t* death_count) {
+    DeathEventType type = (DeathEventType)rng_range(rng, DEATH_EVENT_COUNT);
+    *death_count = EVENT_DEATHS[type].min + rng_range(rng, EVENT_DEATHS[type].span);
+    return type;
 }
 
 /**
- * @brief Randomly trigger a death event (5% chance per day)
+ * @brief Roll and apply a random death event at slot i
  */
-static bool trigger_random_event(DeathNetwork* network, DeathNode* node, uint32_t hours) {
-    /* 5% chance per 24 hours */
-    if ((rand() % 100) < (int)(hours * 5 / 24)) {
-        /* Random event type */
-        DeathEventType event_type = (DeathEventType)(rand() % DEATH_EVENT_COUNT);
+static void random_event(DeathNetwork* network, size_t i, Rng* rng) {
+    uint32_t death_count;
+    DeathEventType event_type = roll_event(rng, &death_count);
+
+    DeathEvent event = {
+        .location_id = network->location_id[i],
+        .type = event_type,
+        .death_count = death_count,
+        .avg_quality = (DeathQuality)rng_range(rng, DEATH_QUALITY_LEGENDARY),
+        .timestamp_hours = network->current_time_hours
+    };
+
+    apply_event(network, i, &event);
+}
 
-        /* Random death count based on event type */
-        uint32_t death_count;
-        switch (event_type) {
-            case DEATH_EVENT_PLAGUE:
-                death_count = 10 + (rand() % 20);  /* 10-30 deaths */
-                break;
-            case DEATH_EVENT_BATTLE:
-                death_count = 5 + (rand() % 15);   /* 5-20 deaths */
-                break;
-            case DEATH_EVENT_NATURAL:
-                death_count = 1 + (rand() % 3);    /* 1-3 deaths */
-                break;
-            default:
-                death_count = 1 + (rand() % 5);    /* 1-5 deaths */
-                break;
-        }
+/* Expected random events per node per hour */
+static double event_rate_per_hour(void) {
+    /* Poisson rate giving RANDOM_EVENT_CHANCE_PER_DAY of at least one a day */
+    return -log1p(-RANDOM_EVENT_CHANCE_PER_DAY) / 24.0;
+}
 
-        DeathEvent event = {
-            .location_id = node->location_id,
-            .type = event_type,
-            .death_count = death_count,
-            .avg_quality = (DeathQuality)(rand() % DEATH_QUALITY_LEGENDARY),
-            .timestamp_hours = network->current_time_hours
-        };
+/**
+ * @brief Roll random death events for all nodes over a short update
+ *
+ * Each node has events as a Poisson process. The network-wide count is
+ * drawn once and each event lands on a uniformly chosen node, which is
+ * the same distribution as independent per-node processes, at one draw
+ * per event instead of one per node.
+ */
+static uint64_t trigger_random_events(DeathNetwork* network, uint32_t hours, Rng* rng) {
+    size_t n = network->node_count;
+    if (n == 0) return 0;
 
-        death_network_trigger_event(network, &event);
-        return true;
+    uint64_t events = rng_poisson(rng, event_rate_per_hour() * (double)hours * (double)n);
+    for (uint64_t e = 0; e < events; e++) {
+        random_event(network, rng_range(rng, (uint32_t)n), rng);
     }
+    return events;
+}
 
-    return false;
+/**
+ * @brief Draw the total deaths of a number of random events
+ *
+ * Small counts are summed exactly; larger ones use the normal
+ * approximation of the sum with the exact per-event mean and variance.
+ */
+static uint64_t sample_event_deaths(Rng* rng, uint64_t events) {
+    if (events <= EXACT_DEATH_SUM_EVENTS) {
+        uint64_t total = 0;
+        for (uint64_t e = 0; e < events; e++) {
+            uint32_t death_count;
+            roll_event(rng, &death_count);
+            total += death_count;
+        }
+        return total;
+    }
+
+    /* Moments of the mixture of uniform ranges */
+    double mean = 0.0, second = 0.0;
+    for (int t = 0; t < DEATH_EVENT_COUNT; t++) {
+        double span = EVENT_DEATHS[t].span;
+        double m = EVENT_DEATHS[t].min + (span - 1.0) / 2.0;
+        mean += m / DEATH_EVENT_COUNT;
+        second += ((span * span - 1.0) / 12.0 + m * m) / DEATH_EVENT_COUNT;
+    }
+    double variance = second - mean * mean;
+
+    double n = (double)events;
+    double total = floor(n * mean + sqrt(n * variance) * rng_normal(rng) + 0.5);
+    /* Every event has at least one death */
+    return total < n ? events : (uint64_t)total;
 }
 
-void death_network_update(DeathNetwork* network, uint32_t hours_passed) {
-    if (!network || hours_passed == 0) return;
+/* Ascending sort of event times within the tail */
+static int compare_hours(const void* a, const void* b) {
+    uint32_t ha = *(const uint32_t*)a;
+    uint32_t hb = *(const uint32_t*)b;
+    return (ha > hb) - (ha < hb);
+}
 
-    network->current_time_hours += hours_passed;
+/**
+ * @brief Fast-forward one node's events over an interval
+ *
+ * Events before the tail only add deaths. Events in the tail are replayed
+ * in time order against the decaying signature. Corpses only ever grow
+ * during a skip, so capping once at the end equals capping after every
+ * addition.
+ *
+ * @param head Hours before the tail (signature already decayed over them)
+ * @param tail Hours in the tail
+ * @param tail_start Network clock at the start of the tail
+ * @return Number of events
+ */
+static uint64_t fast_forward_events(DeathNetwork* network, size_t i, Rng* rng,
+                                    uint32_t head, uint32_t tail, uint32_t tail_start) {
+    double rate = event_rate_per_hour();
+    uint64_t head_events = rng_poisson(rng, rate * head);
+    uint64_t tail_events = rng_poisson(rng, rate * tail);
+    if (tail_events > FAST_FORWARD_MAX_TAIL_EVENTS) {
+        tail_events = FAST_FORWARD_MAX_TAIL_EVENTS;
+    }
+    if (head_events + tail_events == 0) {
+        network->signature[i] = relax_signature(network->signature[i],
+                                                network->base_signature[i],
+                                                decay_between(tail_start, tail_start + tail));
+        return 0;
+    }
 
-    for (size_t i = 0; i < network->node_count; i++) {
-        DeathNode* node = &network->nodes[i];
+    uint64_t deaths = sample_event_deaths(rng, head_events);
+    DeathEventType last_type = DEATH_EVENT_NATURAL;
+    uint32_t since_last = 0;
 
-        /* Update time trackers */
-        node->hours_since_harvest += hours_passed;
-        node->hours_since_event += hours_passed;
+    if (head_events > 0) {
+        /* The latest of n uniform times is head * u^(1/n) */
+        double latest = head * pow(rng_double(rng), 1.0 / (double)head_events);
+        last_type = (DeathEventType)rng_range(rng, DEATH_EVENT_COUNT);
+        since_last = tail + (head - (uint32_t)latest);
+    }
 
-        /* Regenerate corpses */
-        regenerate_corpses(node, hours_passed);
+    uint32_t times[FAST_FORWARD_MAX_TAIL_EVENTS];
+    for (uint64_t e = 0; e < tail_events; e++) {
+        times[e] = rng_range(rng, tail);
+    }
+    qsort(times, (size_t)tail_events, sizeof(uint32_t), compare_hours);
 
-        /* Decay signature */
-        decay_signature(node, hours_passed);
+    uint8_t signature = network->signature[i];
+    uint8_t base = network->base_signature[i];
+    uint32_t previous = 0;
+    for (uint64_t e = 0; e < tail_events; e++) {
+        signature = relax_signature(signature, base,
+                                    decay_between(tail_start + previous, tail_start + times[e]));
+        previous = times[e];
 
-        /* Random death events */
-        trigger_random_event(network, node, hours_passed);
+        uint32_t death_count;
+        last_type = roll_event(rng, &death_count);
+        uint32_t raised = signature + signature_gain(death_count);
+        signature = (uint8_t)(raised > 100 ? 100 : raised);
+        deaths += death_count;
+        since_last = tail - times[e];
     }
+    network->signature[i] = relax_signature(signature, base,
+                                            decay_between(tail_start + previous,
+                                                          tail_start + tail));
+
+    uint32_t added = deaths > UINT32_MAX ? UINT32_MAX : (uint32_t)deaths;
+    uint64_t corpses = (uint64_t)network->available_corpses[i] + added;
+    network->available_corpses[i] = corpses > network->max_corpses[i]
+                                    ? network->max_corpses[i] : (uint32_t)corpses;
+    network->total_deaths[i] += added;
+    network->total_deaths_tracked += added;
+    network->last_event_type[i] = last_type;
+    network->hours_since_event[i] = since_last;
+    return head_events + tail_events;
+}
 
-    LOG_TRACE("Death network updated (+%u hours)", hours_passed);
+/* Advance the per-node time trackers */
+static void advance_trackers(DeathNetwork* network, uint32_t hours) {
+    size_t n = network->node_count;
+    uint32_t* restrict since_harvest = network->hours_since_harvest;
+    uint32_t* restrict since_event = network->hours_since_event;
+    for (size_t i = 0; i < n; i++) {
+        since_harvest[i] += hours;
+        since_event[i] += hours;
+    }
 }
 
-/* ========================================================================
- * Death Events
- * ======================================================================== */
+/**
+ * @brief Skip a long interval, drawing from rng (no logging)
+ *
+ * @return Number of random death events
+ */
+static uint64_t fast_forward(DeathNetwork* network, uint32_t hours, Rng* rng) {
+    uint32_t from = network->current_time_hours;
+    network->current_time_hours += hours;
 
-bool death_network_trigger_event(DeathNetwork* network, const DeathEvent* event) {
-    if (!network || !event) return false;
+    /* Regeneration and trackers are exact in closed form */
+    advance_trackers(network, hours);
+    regenerate_corpses(network, from, hours);
+
+    /* Decay over the head in one step; the tail is replayed per node */
+    uint32_t tail = hours < FAST_FORWARD_TAIL_HOURS ? hours : FAST_FORWARD_TAIL_HOURS;
+    uint32_t head = hours - tail;
+    decay_signatures(network, from, head);
 
-    /* Find node */
-    DeathNode* node = NULL;
+    uint64_t events = 0;
     for (size_t i = 0; i < network->node_count; i++) {
-        if (network->nodes[i].location_id == event->location_id) {
-            node = &network->nodes[i];
-            break;
-        }
+        events += fast_forward_events(network, i, rng, head, tail, from + head);
     }
+    heap_rebuild(network);
+    return events;
+}
 
-    if (!node) {
-        LOG_WARN("Death event for unknown location %u", event->location_id);
-        return false;
+uint64_t death_network_step(DeathNetwork* network, uint32_t hours_passed, Rng* rng) {
+    if (!network || !rng || hours_passed == 0) return 0;
+
+    if (hours_passed >= FAST_FORWARD_MIN_HOURS) {
+        return fast_forward(network, hours_passed, rng);
     }
 
-    /* Increase death signature based on event magnitude */
-    uint32_t signature_increase = event->death_count / 2;
-    if (signature_increase > 30) signature_increase = 30;  /* Cap at +30 */
+    uint32_t from = network->current_time_hours;
+    network->current_time_hours += hours_passed;
 
-    node->signature += (DeathSignature)signature_increase;
-    if (node->signature > 100) node->signature = 100;
+    advance_trackers(network, hours_passed);
+    regenerate_corpses(network, from, hours_passed);
+    decay_signatures(network, from, hours_passed);
+    return trigger_random_events(network, hours_passed, rng);
+}
 
-    /* Add corpses */
-    node->available_corpses += event->death_count;
-    if (node->available_corpses > node->max_corpses) {
-        node->available_corpses = node->max_corpses;
-    }
+void death_network_update(DeathNetwork* network, uint32_t hours_passed) {
+    if (!network || hours_passed == 0) return;
 
-    /* Update tracking */
-    node->total_deaths += event->death_count;
-    node->last_event_type = event->type;
-    node->hours_since_event = 0;
+    uint32_t deaths_before = network->total_deaths_tracked;
+    uint64_t events = death_network_step(network, hours_passed,
+                                         rng_stream(RNG_STREAM_DEATH_NETWORK));
 
-    network->total_deaths_tracked += event->death_count;
+    LOG_TRACE("Death network updated (+%u hours, %llu events, %u deaths)",
+              hours_passed, (unsigned long long)events,
+              network->total_deaths_tracked - deaths_before);
+}
 
+void death_network_fast_forward(DeathNetwork* network, uint32_t hours) {
+    if (!network || hours == 0) return;
+
+    uint32_t deaths_before = network->total_deaths_tracked;
+    uint64_t events = fast_forward(network, hours, rng_stream(RNG_STREAM_DEATH_NETWORK));
+
+    LOG_INFO("Death network fast-forwarded %u hours (%llu events, %u deaths)",
+             hours, (unsigned long long)events,
+             network->total_deaths_tracked - deaths_before);
+}
+
+/* ========================================================================
+ * Death Events
+ * ======================================================================== */
+
+bool death_network_trigger_event(DeathNetwork* network, const DeathEvent* event) {
+    if (!network || !event) return false;
+
+    size_t i;
+    if (!find_slot(network, event->location_id, &i)) {
+        LOG_WARN("Death event for unknown location %u", event->location_id);
+        return false;
+    }
+
+    apply_event(network, i, event);
     LOG_INFO("Death event at location %u: %s (%u deaths, signature: %u)",
              event->location_id,
              death_event_type_name(event->type),
              event->death_count,
-             node->signature);
-
+             network->signature[i]);
     return true;
 }
 
@@ -295,26 +803,30 @@ bool death_network_trigger_event(DeathNetwork* network, const DeathEvent* event)
  * Corpse Harvesting
  * ======================================================================== */
 
-DeathQuality death_network_roll_quality(const DeathNode* node) {
-    if (!node) return DEATH_QUALITY_POOR;
-
+static DeathQuality roll_quality(const uint8_t quality[QUALITY_TIERS]) {
     /* Roll 1-100 */
-    int roll = (rand() % 100) + 1;
+    int roll = (int)rng_range(rng_stream(RNG_STREAM_DEATH_NETWORK), 100) + 1;
     int threshold = 0;
 
-    threshold += node->quality_poor;
-    if (roll <= threshold) return DEATH_QUALITY_POOR;
-
-    threshold += node->quality_average;
-    if (roll <= threshold) return DEATH_QUALITY_AVERAGE;
+    for (int tier = DEATH_QUALITY_POOR; tier < DEATH_QUALITY_LEGENDARY; tier++) {
+        threshold += quality[tier];
+        if (roll <= threshold) return (DeathQuality)tier;
+    }
 
-    threshold += node->quality_good;
-    if (roll <= threshold) return DEATH_QUALITY_GOOD;
+    return DEATH_QUALITY_LEGENDARY;
+}
 
-    threshold += node->quality_excellent;
-    if (roll <= threshold) return DEATH_QUALITY_EXCELLENT;
+DeathQuality death_network_roll_quality(const DeathNode* node) {
+    if (!node) return DEATH_QUALITY_POOR;
 
-    return DEATH_QUALITY_LEGENDARY;
+    uint8_t quality[QUALITY_TIERS] = {
+        node->quality_poor,
+        node->quality_average,
+        node->quality_good,
+        node->quality_excellent,
+        node->quality_legendary
+    };
+    return roll_quality(quality);
 }
 
 uint32_t death_network_harvest_corpses(DeathNetwork* network,
@@ -323,46 +835,39 @@ uint32_t death_network_harvest_corpses(DeathNetwork* network,
                                         DeathQuality* qualities) {
     if (!network) return 0;
 
-    /* Find node */
-    DeathNode* node = NULL;
-    for (size_t i = 0; i < network->node_count; i++) {
-        if (network->nodes[i].location_id == location_id) {
-            node = &network->nodes[i];
-            break;
-        }
-    }
-
-    if (!node) {
+    size_t i;
+    if (!find_slot(network, location_id, &i)) {
         LOG_WARN("Attempted to harvest from unknown location %u", location_id);
         return 0;
     }
 
     /* Cap at available corpses */
     uint32_t harvested = count;
-    if (harvested > node->available_corpses) {
-        harvested = node->available_corpses;
+    if (harvested > network->available_corpses[i]) {
+        harvested = network->available_corpses[i];
     }
 
     /* Roll qualities */
     if (qualities) {
-        for (uint32_t i = 0; i < harvested; i++) {
-            qualities[i] = death_network_roll_quality(node);
+        for (uint32_t q = 0; q < harvested; q++) {
+            qualities[q] = roll_quality(network->quality[i]);
         }
     }
 
     /* Remove corpses */
-    node->available_corpses -= harvested;
-    node->hours_since_harvest = 0;
+    network->available_corpses[i] -= harvested;
+    network->hours_since_harvest[i] = 0;
 
     /* Reduce signature slightly from harvesting */
-    if (node->signature > 5) {
-        node->signature -= 5;
+    if (network->signature[i] > 5) {
+        network->signature[i] -= 5;
     } else {
-        node->signature = 0;
+        network->signature[i] = 0;
     }
+    heap_update(network, i);
 
     LOG_DEBUG("Harvested %u corpses from location %u (%u remaining)",
-              harvested, location_id, node->available_corpses);
+              harvested, location_id, network->available_corpses[i]);
 
     return harvested;
 }
@@ -371,19 +876,6 @@ uint32_t death_network_harvest_corpses(DeathNetwork* network,
  * Network Scanning
  * ======================================================================== */
 
-/**
- * @brief Comparison function for sorting locations by signature
- */
-static int compare_nodes_by_signature(const void* a, const void* b) {
-    const DeathNode* node_a = (const DeathNode*)a;
-    const DeathNode* node_b = (const DeathNode*)b;
-
-    /* Sort descending (highest signature first) */
-    if (node_b->signature > node_a->signature) return 1;
-    if (node_b->signature < node_a->signature) return -1;
-    return 0;
-}
-
 size_t death_network_scan(const DeathNetwork* network,
                           uint32_t center_location_id,
                           uint32_t* results,
@@ -393,26 +885,7 @@ size_t death_network_scan(const DeathNetwork* network,
     /* For now, return all locations except center */
     /* TODO: Implement range-based scanning using location_graph */
 
-    size_t count = 0;
-    DeathNode sorted[MAX_DEATH_NODES];
-    size_t sorted_count = 0;
-
-    /* Copy all nodes except center */
-    for (size_t i = 0; i < network->node_count; i++) {
-        if (network->nodes[i].location_id != center_location_id) {
-            sorted[sorted_count++] = network->nodes[i];
-        }
-    }
-
-    /* Sort by signature */
-    qsort(sorted, sorted_count, sizeof(DeathNode), compare_nodes_by_signature);
-
-    /* Return top results */
-    for (size_t i = 0; i < sorted_count && count < max_results; i++) {
-        results[count++] = sorted[i].location_id;
-    }
-
-    return count;
+    return top_signatures(network, 0, true, center_location_id, results, max_results);
 }
 
 size_t death_network_get_hotspots(const DeathNetwork* network,
@@ -420,22 +893,8 @@ size_t death_network_get_hotspots(const DeathNetwork* network,
                                    size_t max_results) {
     if (!network || !results || max_results == 0) return 0;
 
-    /* Copy all nodes */
-    DeathNode sorted[MAX_DEATH_NODES];
-    memcpy(sorted, network->nodes, network->node_count * sizeof(DeathNode));
-
-    /* Sort by signature */
-    qsort(sorted, network->node_count, sizeof(DeathNode), compare_nodes_by_signature);
-
     /* Return top results with signature > 50 */
-    size_t count = 0;
-    for (size_t i = 0; i < network->node_count && count < max_results; i++) {
-        if (sorted[i].signature >= SIGNATURE_MODERATE) {
-            results[count++] = sorted[i].location_id;
-        }
-    }
-
-    return count;
+    return top_signatures(network, SIGNATURE_MODERATE, false, 0, results, max_results);
 }
 
 /* ========================================================================
@@ -469,16 +928,14 @@ bool death_network_set_quality_distribution(DeathNetwork* network,
         return false;
     }
 
-    /* Find node */
-    for (size_t i = 0; i < network->node_count; i++) {
-        if (network->nodes[i].location_id == location_id) {
-            network->nodes[i].quality_poor = poor;
-            network->nodes[i].quality_average = average;
-            network->nodes[i].quality_good = good;
-            network->nodes[i].quality_excellent = excellent;
-            network->nodes[i].quality_legendary = legendary;
-            return true;
-        }
+    size_t i;
+    if (find_slot(network, location_id, &i)) {
+        network->quality[i][DEATH_QUALITY_POOR] = poor;
+        network->quality[i][DEATH_QUALITY_AVERAGE] = average;
+        network->quality[i][DEATH_QUALITY_GOOD] = good;
+        network->quality[i][DEATH_QUALITY_EXCELLENT] = excellent;
+        network->quality[i][DEATH_QUALITY_LEGENDARY] = legendary;
+        return true;
     }
 
     LOG_WARN("Cannot set quality distribution for unknown location %u", location_id);
@@ -490,7 +947,7 @@ DeathSignature death_network_get_activity_level(const DeathNetwork* network) {
 
     uint32_t total = 0;
     for (size_t i = 0; i < network->node_count; i++) {
-        total += network->nodes[i].signature;
+        total += network->signature[i];
     }
 
     return (DeathSignature)(total / network->node_count);
@@ -501,12 +958,16 @@ uint32_t death_network_get_total_corpses(const DeathNetwork* network) {
 
     uint32_t total = 0;
     for (size_t i = 0; i < network->node_count; i++) {
-        total += network->nodes[i].available_corpses;
+        total += network->available_corpses[i];
     }
 
     return total;
 }
 
+size_t death_network_get_location_count(const DeathNetwork* network) {
+    return network ? network->node_count : 0;
+}
+
 void death_network_get_stats(const DeathNetwork* network,
                              size_t* total_locations,
                              uint32_t* total_corpses,
@@ -18,6 +18,7 @@
 #ifndef NECROMANCER_DEATH_NETWORK_H
 #define NECROMANCER_DEATH_NETWORK_H
 
+#include "../../utils/rng.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -144,9 +145,13 @@ bool death_network_add_location(DeathNetwork* network,
 /**
  * @brief Get death node for a location
  *
+ * Nodes are stored column by column, so this returns a snapshot taken at
+ * the time of the call. It is not updated by later changes; call again to
+ * refresh it. The pointer stays valid until a location is added.
+ *
  * @param network Death network
  * @param location_id Location ID
- * @return Pointer to death node, or NULL if not found
+ * @return Pointer to death node snapshot, or NULL if not found
  */
 const DeathNode* death_network_get_node(const DeathNetwork* network,
                                          uint32_t location_id);
@@ -154,17 +159,55 @@ const DeathNode* death_network_get_node(const DeathNetwork* network,
 /**
  * @brief Update death network (called each game hour)
  *
+ * Regeneration and decay are branch-free sweeps over the node columns.
+ * Random events form a Poisson process per node (5% chance of at least
+ * one per day) and are drawn in one batch, at one draw per event.
+ * Updates of 30 days or more go through death_network_fast_forward().
+ *
  * Processes:
  * - Corpse regeneration based on time passage
  * - Death signature decay
  * - Network flow between connected locations
  * - Random death events
  *
+ * Corpses regenerate and signatures decay at fixed hour boundaries of
+ * the network's clock, so splitting time into more, shorter updates
+ * gives the same regeneration and decay.
+ *
  * @param network Death network
  * @param hours_passed Number of game hours passed
  */
 void death_network_update(DeathNetwork* network, uint32_t hours_passed);
 
+/**
+ * @brief Update the network with a caller-owned generator, without logging
+ *
+ * Same simulation as death_network_update(), but every draw comes from
+ * rng and nothing is logged, so it may run on a worker thread while no
+ * other thread touches the network. Equal generators give equal results.
+ *
+ * @param network Death network
+ * @param hours_passed Number of game hours passed
+ * @param rng Generator to draw from (advanced)
+ * @return Number of random death events
+ */
+uint64_t death_network_step(DeathNetwork* network, uint32_t hours_passed, Rng* rng);
+
+/**
+ * @brief Skip a long interval in O(nodes)
+ *
+ * Regeneration and decay are applied in closed form. Each node's number
+ * of random events is drawn from its Poisson distribution. Only the
+ * events in the last 256 days are replayed one by one against the
+ * decaying signature; older ones just add their deaths, which are
+ * summed exactly or, for large counts, drawn from the normal
+ * approximation of the sum. Nothing is logged per event.
+ *
+ * @param network Death network
+ * @param hours Number of game hours to skip
+ */
+void death_network_fast_forward(DeathNetwork* network, uint32_t hours);
+
 /**
  * @brief Trigger a death event at a location
  *
@@ -198,6 +241,8 @@ uint32_t death_network_harvest_corpses(DeathNetwork* network,
  *
  * Returns all locations within network range sorted by death signature.
  * Used for the 'scan' command to find corpse-rich locations.
+ * Nodes are kept in a heap by signature, so this costs O(k log k) for
+ * k results and allocates nothing.
  *
  * @param network Death network
  * @param center_location_id Location to scan from
@@ -213,6 +258,9 @@ size_t death_network_scan(const DeathNetwork* network,
 /**
  * @brief Get locations with highest death signatures
  *
+ * Lists locations with signature 60 or above, highest first, in
+ * O(k log k) for k results without allocating.
+ *
  * @param network Death network
  * @param results Output array of location IDs (caller allocates)
  * @param max_results Maximum number of results
@@ -305,6 +353,14 @@ DeathSignature death_network_get_activity_level(const DeathNetwork* network);
  */
 uint32_t death_network_get_total_corpses(const DeathNetwork* network);
 
+/**
+ * @brief Get number of locations in network
+ *
+ * @param network Death network
+ * @return Location count, or 0 if network is NULL
+ */
+size_t death_network_get_location_count(const DeathNetwork* network);
+
 /**
  * @brief Get statistics for death network
  *
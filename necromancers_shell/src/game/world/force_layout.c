@@ -0,0 +1,303 @@
+/**
+ * @file force_layout.c
+ * @brief Implementation of force-directed layout
+ *
+ * Fruchterman-Reingold forces: repulsion k^2/d between every pair of
+ * nodes, attraction d^2/L along each edge (L = the edge's ideal length,
+ * k = the mean of those), plus a weak pull toward the origin so
+ * disconnected pieces stay in view.
+ */
+
+#include "force_layout.h"
+#include "../../utils/logger.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Deeper cells only hold coincident or nearly coincident nodes */
+#define QUAD_MAX_DEPTH 16
+#define GRAVITY 0.02f
+
+/**
+ * @brief Barnes-Hut quadtree cell
+ *
+ * Cells own a contiguous run of the order array, so leaves can list
+ * their nodes without per-cell allocations.
+ */
+typedef struct {
+    float x0, y0, size;         /**< Square bounds */
+    float cx, cy;               /**< Center of mass */
+    uint32_t first;             /**< First entry in order[] */
+    uint32_t count;             /**< Nodes in this cell (its mass) */
+    int32_t child[4];           /**< Child cells, -1 = empty/leaf */
+} QuadCell;
+
+typedef struct {
+    QuadCell* cells;
+    size_t cell_count;
+    size_t cell_capacity;
+    uint32_t* order;            /**< Node indices grouped by cell */
+    const float* x;
+    const float* y;
+} QuadTree;
+
+static int32_t quad_new_cell(QuadTree* tree) {
+    if (tree->cell_count >= tree->cell_capacity) {
+        size_t capacity = tree->cell_capacity ? tree->cell_capacity * 2 : 64;
+        QuadCell* cells = realloc(tree->cells, sizeof(QuadCell) * capacity);
+        if (!cells) return -1;
+        tree->cells = cells;
+        tree->cell_capacity = capacity;
+    }
+    return (int32_t)tree->cell_count++;
+}
+
+/* Move order[first..first+count) entries with coord < split to the front */
+static uint32_t partition(uint32_t* order, uint32_t first, uint32_t count,
+                          const float* coord, float split) {
+    uint32_t lo = first;
+    uint32_t hi = first + count;
+    while (lo < hi) {
+        if (coord[order[lo]] < split) {
+            lo++;
+        } else {
+            uint32_t tmp = order[lo];
+            order[lo] = order[--hi];
+            order[hi] = tmp;
+        }
+    }
+    return lo - first;
+}
+
+/**
+ * @brief Build the cell for order[first..first+count) and its subtree
+ *
+ * @return Cell index, or -1 on allocation failure
+ */
+static int32_t quad_build(QuadTree* tree, uint32_t first, uint32_t count,
+                          float x0, float y0, float size, int depth) {
+    int32_t index = quad_new_cell(tree);
+    if (index < 0) return -1;
+
+    float cx = 0.0f, cy = 0.0f;
+    for (uint32_t i = first; i < first + count; i++) {
+        cx += tree->x[tree->order[i]];
+        cy += tree->y[tree->order[i]];
+    }
+
+    QuadCell* cell = &tree->cells[index];
+    cell->x0 = x0;
+    cell->y0 = y0;
+    cell->size = size;
+    cell->cx = cx / (float)count;
+    cell->cy = cy / (float)count;
+    cell->first = first;
+    cell->count = count;
+    for (int q = 0; q < 4; q++) {
+        cell->child[q] = -1;
+    }
+
+    if (count == 1 || depth >= QUAD_MAX_DEPTH) {
+        return index;
+    }
+
+    /* Split top/bottom, then each half left/right: quadrants 0..3 */
+    float half = size * 0.5f;
+    uint32_t top = partition(tree->order, first, count, tree->y, y0 + half);
+    uint32_t top_left = partition(tree->order, first, top, tree->x, x0 + half);
+    uint32_t bottom_left = partition(tree->order, first + top, count - top,
+                                     tree->x, x0 + half);
+
+    uint32_t starts[4] = {first, first + top_left, first + top, first + top + bottom_left};
+    uint32_t counts[4] = {top_left, top - top_left, bottom_left, count - top - bottom_left};
+
+    for (int q = 0; q < 4; q++) {
+        if (counts[q] == 0) continue;
+        float qx = x0 + ((q & 1) ? half : 0.0f);
+        float qy = y0 + ((q & 2) ? half : 0.0f);
+        int32_t child = quad_build(tree, starts[q], counts[q], qx, qy, half, depth + 1);
+        if (child < 0) return -1;
+        /* cells may have moved during growth */
+        tree->cells[index].child[q] = child;
+    }
+    return index;
+}
+
+/* Push apart two nodes at (nearly) the same spot in a stable direction */
+static void jitter(uint32_t a, uint32_t b, float* dx, float* dy) {
+    float angle = (float)((a * 2654435761u) ^ (b * 40503u)) * 1.4629180792e-9f;
+    *dx = cosf(angle) * 0.01f;
+    *dy = sinf(angle) * 0.01f;
+}
+
+/**
+ * @brief Accumulate repulsion on node i from everything in the tree
+ */
+static void quad_repulse(const QuadTree* tree, uint32_t i, float k2, float theta2,
+                         float* fx, float* fy) {
+    int32_t stack[4 * QUAD_MAX_DEPTH + 4];
+    size_t top = 0;
+    stack[top++] = 0;
+
+    float xi = tree->x[i];
+    float yi = tree->y[i];
+
+    while (top > 0) {
+        const QuadCell* cell = &tree->cells[stack[--top]];
+        bool leaf = cell->child[0] < 0 && cell->child[1] < 0 &&
+                    cell->child[2] < 0 && cell->child[3] < 0;
+
+        if (leaf) {
+            for (uint32_t n = cell->first; n < cell->first + cell->count; n++) {
+                uint32_t j = tree->order[n];
+                if (j == i) continue;
+
+                float dx = xi - tree->x[j];
+                float dy = yi - tree->y[j];
+                float d2 = dx * dx + dy * dy;
+                if (d2 < 1e-6f) {
+                    jitter(i, j, &dx, &dy);
+                    d2 = dx * dx + dy * dy;
+                }
+                /* k^2 / d along the unit vector: k^2 * delta / d^2 */
+                *fx += k2 * dx / d2;
+                *fy += k2 * dy / d2;
+            }
+            continue;
+        }
+
+        float dx = xi - cell->cx;
+        float dy = yi - cell->cy;
+        float d2 = dx * dx + dy * dy;
+        bool inside = xi >= cell->x0 && xi < cell->x0 + cell->size &&
+                      yi >= cell->y0 && yi < cell->y0 + cell->size;
+
+        if (!inside && cell->size * cell->size < theta2 * d2) {
+            /* Far enough: the whole cell acts as one mass at its center */
+            float mass = (float)cell->count;
+            *fx += mass * k2 * dx / d2;
+            *fy += mass * k2 * dy / d2;
+            continue;
+        }
+
+        for (int q = 0; q < 4; q++) {
+            if (cell->child[q] >= 0) {
+                stack[top++] = cell->child[q];
+            }
+        }
+    }
+}
+
+bool force_layout_run(const ForceLayoutProblem* problem, uint32_t iterations, float theta) {
+    if (!problem || !problem->x || !problem->y ||
+        (problem->edge_count > 0 && (!problem->edge_from || !problem->edge_to))) {
+        LOG_ERROR("force_layout_run: Invalid problem");
+        return false;
+    }
+
+    size_t n = problem->node_count;
+    if (n == 0 || iterations == 0) return true;
+
+    float* x = problem->x;
+    float* y = problem->y;
+
+    /* k: mean ideal edge length */
+    float k = 1.0f;
+    if (problem->edge_count > 0 && problem->edge_length) {
+        double sum = 0.0;
+        for (size_t e = 0; e < problem->edge_count; e++) {
+            sum += problem->edge_length[e];
+        }
+        k = (float)(sum / (double)problem->edge_count);
+        if (k <= 0.0f) k = 1.0f;
+    }
+    float k2 = k * k;
+    float theta2 = theta * theta;
+
+    float* fx = malloc(sizeof(float) * n);
+    float* fy = malloc(sizeof(float) * n);
+    QuadTree tree = {0};
+    tree.order = malloc(sizeof(uint32_t) * n);
+    tree.x = x;
+    tree.y = y;
+    if (!fx || !fy || !tree.order) {
+        free(fx);
+        free(fy);
+        free(tree.order);
+        LOG_ERROR("force_layout_run: Failed to allocate work arrays");
+        return false;
+    }
+
+    /* Start hot enough to untangle a layout the size of the graph */
+    float start_temperature = k * sqrtf((float)n);
+    bool ok = true;
+
+    for (uint32_t iter = 0; iter < iterations && ok; iter++) {
+        float temperature = start_temperature * (1.0f - (float)iter / (float)iterations) +
+                            k * 0.01f;
+
+        /* Square bounds around every node */
+        float min_x = x[0], max_x = x[0], min_y = y[0], max_y = y[0];
+        for (size_t i = 1; i < n; i++) {
+            if (x[i] < min_x) min_x = x[i];
+            if (x[i] > max_x) max_x = x[i];
+            if (y[i] < min_y) min_y = y[i];
+            if (y[i] > max_y) max_y = y[i];
+        }
+        float size = fmaxf(max_x - min_x, max_y - min_y) * 1.001f + 1e-3f;
+
+        for (size_t i = 0; i < n; i++) {
+            tree.order[i] = (uint32_t)i;
+        }
+        tree.cell_count = 0;
+        if (quad_build(&tree, 0, (uint32_t)n, min_x, min_y, size, 0) < 0) {
+            LOG_ERROR("force_layout_run: Failed to allocate quadtree");
+            ok = false;
+            break;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            fx[i] = -GRAVITY * x[i];
+            fy[i] = -GRAVITY * y[i];
+            if (!problem->fixed || !problem->fixed[i]) {
+                quad_repulse(&tree, (uint32_t)i, k2, theta2, &fx[i], &fy[i]);
+            }
+        }
+
+        for (size_t e = 0; e < problem->edge_count; e++) {
+            uint32_t a = problem->edge_from[e];
+            uint32_t b = problem->edge_to[e];
+            if (a >= n || b >= n || a == b) continue;
+
+            float length = problem->edge_length ? problem->edge_length[e] : 1.0f;
+            if (length <= 0.0f) length = k;
+
+            /* d^2 / L along the unit vector: d * delta / L */
+            float dx = x[b] - x[a];
+            float dy = y[b] - y[a];
+            float d = sqrtf(dx * dx + dy * dy);
+            float scale = d / length;
+            fx[a] += dx * scale;
+            fy[a] += dy * scale;
+            fx[b] -= dx * scale;
+            fy[b] -= dy * scale;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (problem->fixed && problem->fixed[i]) continue;
+
+            float magnitude = sqrtf(fx[i] * fx[i] + fy[i] * fy[i]);
+            if (magnitude <= 0.0f) continue;
+
+            float step = magnitude < temperature ? magnitude : temperature;
+            x[i] += fx[i] / magnitude * step;
+            y[i] += fy[i] / magnitude * step;
+        }
+    }
+
+    free(fx);
+    free(fy);
+    free(tree.order);
+    free(tree.cells);
+    return ok;
+}
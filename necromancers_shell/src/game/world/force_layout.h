@@ -0,0 +1,54 @@
+/**
+ * @file force_layout.h
+ * @brief Force-directed graph layout with Barnes-Hut repulsion
+ *
+ * Positions nodes so connected nodes sit near their ideal edge length and
+ * unconnected ones spread apart. Repulsion between all pairs is
+ * approximated with a Barnes-Hut quadtree, so one iteration costs
+ * O(n log n) rather than O(n^2).
+ *
+ * Works on plain arrays and touches no global state, so it can run on a
+ * worker thread against a snapshot of the world.
+ */
+
+#ifndef NECROMANCER_FORCE_LAYOUT_H
+#define NECROMANCER_FORCE_LAYOUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Default Barnes-Hut opening angle (cell size / distance) */
+#define FORCE_LAYOUT_DEFAULT_THETA 0.7f
+
+/**
+ * @brief Layout input and output
+ *
+ * x/y hold the starting positions and receive the result.
+ */
+typedef struct {
+    size_t node_count;          /**< Number of nodes */
+    float* x;                   /**< Node X positions (in/out) */
+    float* y;                   /**< Node Y positions (in/out) */
+    const bool* fixed;          /**< Nodes that must not move (NULL = none) */
+
+    size_t edge_count;          /**< Number of edges */
+    const uint32_t* edge_from;  /**< Edge source node index */
+    const uint32_t* edge_to;    /**< Edge destination node index */
+    const float* edge_length;   /**< Ideal length per edge (NULL = all 1) */
+} ForceLayoutProblem;
+
+/**
+ * @brief Run a force-directed layout
+ *
+ * Movement per iteration is capped by a temperature that cools linearly,
+ * so the result settles even with few iterations.
+ *
+ * @param problem Nodes, edges and positions
+ * @param iterations Number of iterations
+ * @param theta Barnes-Hut opening angle (0 = exact, larger = faster)
+ * @return true on success, false on invalid input or allocation failure
+ */
+bool force_layout_run(const ForceLayoutProblem* problem, uint32_t iterations, float theta);
+
+#endif /* NECROMANCER_FORCE_LAYOUT_H */
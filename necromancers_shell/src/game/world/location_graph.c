@@ -5,185 +5,769 @@
 
 #include "location_graph.h"
 #include "../../utils/logger.h"
+#include "../../utils/id_map.h"
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
-
-#define MAX_CONNECTIONS 1000
-#define MAX_LOCATIONS 200
+#include <math.h>
 
 /**
- * @brief Adjacency list node
+ * @brief Unlock data for one connection
+ *
+ * Kept apart from the hot edge arrays; only unlock queries read it.
  */
-typedef struct AdjListNode {
-    uint32_t to_location_id;
-    uint8_t travel_time_hours;
-    uint8_t danger_level;
+typedef struct {
     bool requires_unlock;
     char unlock_requirement[64];
-    struct AdjListNode* next;
-} AdjListNode;
+} EdgeUnlock;
 
 /**
  * @brief Location graph structure
+ *
+ * Connections are appended to an edge list in insertion order. Queries
+ * run on a compiled CSR (compressed sparse row) copy of it: row i of
+ * csr_targets/csr_times/csr_dangers, from csr_offsets[i] to
+ * csr_offsets[i + 1], holds the outgoing edges of location index i,
+ * newest first. A reverse CSR of incoming edges serves bidirectional
+ * search. Both are rebuilt lazily after the edge list changes.
+ *
+ * The graph-owned queries (find_path, is_reachable, get_travel_time)
+ * also keep an all-pairs table of times and first hops, stamped with the
+ * graph version and rebuilt lazily once a version sees repeated queries.
  */
 struct LocationGraph {
-    AdjListNode** adjacency_lists;  /**< Array of adjacency lists */
     uint32_t* location_ids;         /**< Array of unique location IDs */
     size_t location_count;          /**< Number of unique locations */
     size_t location_capacity;       /**< Capacity of location_ids array */
+    IdMap* index_by_id;             /**< Location ID -> index in location_ids */
+
+    /* Edge list (insertion order) */
+    uint32_t* edge_from;            /**< Source location index */
+    uint32_t* edge_to;              /**< Destination location index */
+    uint8_t* edge_times;            /**< Travel time in hours */
+    uint8_t* edge_dangers;          /**< Danger level */
+    EdgeUnlock* edge_unlocks;       /**< Cold unlock data */
     size_t connection_count;        /**< Total number of connections */
+    size_t edge_capacity;           /**< Capacity of edge arrays */
+
+    /* Compiled CSR adjacency */
+    uint32_t* csr_offsets;          /**< Row starts (location_count + 1) */
+    uint32_t* csr_targets;          /**< Destination location index */
+    uint8_t* csr_times;             /**< Travel time in hours */
+    uint8_t* csr_dangers;           /**< Danger level */
+    uint32_t* csr_edges;            /**< Edge list index (for unlock data) */
+    uint32_t* rcsr_offsets;         /**< Reverse rows: incoming edges */
+    uint32_t* rcsr_sources;         /**< Source location index */
+    uint32_t* rcsr_forward;         /**< Forward CSR position of the edge */
+    size_t csr_row_capacity;        /**< Capacity of csr_offsets */
+    size_t csr_edge_capacity;       /**< Capacity of per-edge CSR arrays */
+    bool csr_dirty;                 /**< Edge list changed since compile */
+
+    /* A* heuristic */
+    float* pos_x;                   /**< Map X per location index */
+    float* pos_y;                   /**< Map Y per location index */
+    bool* has_position;             /**< Whether pos_x/pos_y are set */
+    size_t positioned_count;        /**< Locations with a position */
+    float heuristic_scale;          /**< Hours per map unit lower bound */
+    bool heuristic_dirty;           /**< Positions or edges changed */
+
+    /* All-pairs travel table */
+    uint32_t version;               /**< Bumped whenever connections change */
+    uint16_t* table_times;          /**< [from * n + to] hours, or UNREACHABLE */
+    uint32_t* table_hops;           /**< [from * n + to] CSR position of first edge */
+    size_t table_size;              /**< n the table was built for */
+    size_t table_capacity;          /**< Cells allocated */
+    uint32_t table_version;         /**< Version table_valid/requests refer to */
+    uint8_t table_requests;         /**< Queries seen at table_version */
+    bool table_valid;               /**< Table matches table_version */
+
+    PathfindingMode mode;           /**< Mode used by location_graph_find_path */
+    PathWorkspace* workspace;       /**< Workspace for location_graph_find_path */
 };
 
 /**
- * @brief Priority queue node for Dijkstra's algorithm
+ * @brief Priority queue entry for Dijkstra's algorithm
  */
-typedef struct PQNode {
-    uint32_t location_id;
+typedef struct {
     uint32_t cost;
-} PQNode;
+    uint32_t node;
+} HeapEntry;
 
 /**
- * @brief Simple min-heap priority queue
+ * @brief One direction of a search
+ *
+ * Per-node arrays are only valid where stamp[i] == generation, so a new
+ * query just bumps the generation instead of clearing them.
  */
 typedef struct {
-    PQNode* nodes;
-    size_t size;
-    size_t capacity;
-} PriorityQueue;
-
-/* Priority queue helper functions */
-static PriorityQueue* pq_create(size_t capacity) {
-    PriorityQueue* pq = malloc(sizeof(PriorityQueue));
-    if (!pq) return NULL;
-
-    pq->nodes = malloc(sizeof(PQNode) * capacity);
-    if (!pq->nodes) {
-        free(pq);
-        return NULL;
-    }
+    uint32_t* dist;                 /**< Best known cost per node */
+    uint32_t* pred;                 /**< Previous (forward) or next (backward) node */
+    uint32_t* pred_edge;            /**< Forward CSR position of that edge */
+    uint32_t* stamp;                /**< Generation dist/pred were set in */
+    uint32_t* settled;              /**< Generation node was finalized in */
+    HeapEntry* heap;                /**< Binary min-heap (lazy deletion) */
+    size_t heap_size;
+    size_t heap_capacity;
+} SearchSide;
 
-    pq->size = 0;
-    pq->capacity = capacity;
-    return pq;
+/**
+ * @brief Reusable pathfinding scratch memory
+ */
+struct PathWorkspace {
+    SearchSide forward;             /**< Search from the start */
+    SearchSide backward;            /**< Search from the target (bidirectional) */
+    size_t node_capacity;           /**< Nodes forward arrays are sized for */
+    size_t backward_capacity;       /**< Nodes backward arrays are sized for */
+    uint32_t* path;                 /**< Last path found, as location IDs */
+    uint32_t generation;
+};
+
+/* Priority queue helpers */
+static void heap_push(SearchSide* side, uint32_t node, uint32_t cost) {
+    /* Capacity covers one entry per edge relaxation plus the start */
+    size_t index = side->heap_size++;
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (side->heap[parent].cost <= cost) break;
+        side->heap[index] = side->heap[parent];
+        index = parent;
+    }
+    side->heap[index].cost = cost;
+    side->heap[index].node = node;
 }
 
-static void pq_destroy(PriorityQueue* pq) {
-    if (!pq) return;
-    free(pq->nodes);
-    free(pq);
+static HeapEntry heap_pop(SearchSide* side) {
+    HeapEntry top = side->heap[0];
+    HeapEntry last = side->heap[--side->heap_size];
+    size_t size = side->heap_size;
+    size_t index = 0;
+
+    while (2 * index + 1 < size) {
+        size_t child = 2 * index + 1;
+        if (child + 1 < size && side->heap[child + 1].cost < side->heap[child].cost) {
+            child++;
+        }
+        if (last.cost <= side->heap[child].cost) break;
+        side->heap[index] = side->heap[child];
+        index = child;
+    }
+    if (size > 0) {
+        side->heap[index] = last;
+    }
+    return top;
 }
 
-static void pq_swap(PQNode* a, PQNode* b) {
-    PQNode temp = *a;
-    *a = *b;
-    *b = temp;
+/* Graph helper functions */
+static int find_location_index(const LocationGraph* graph, uint32_t location_id) {
+    size_t index;
+    if (!id_map_get_index(graph->index_by_id, location_id, &index)) {
+        return -1;
+    }
+    return (int)index;
 }
 
-static void pq_heapify_up(PriorityQueue* pq, size_t index) {
-    while (index > 0) {
-        size_t parent = (index - 1) / 2;
-        if (pq->nodes[index].cost >= pq->nodes[parent].cost) break;
-        pq_swap(&pq->nodes[index], &pq->nodes[parent]);
-        index = parent;
+static bool add_location_id(LocationGraph* graph, uint32_t location_id) {
+    if (find_location_index(graph, location_id) >= 0) {
+        return true; /* Already exists */
+    }
+
+    if (graph->location_count >= graph->location_capacity) {
+        /* Grow capacity */
+        size_t new_capacity = graph->location_capacity * 2;
+        uint32_t* new_ids = realloc(graph->location_ids,
+                                     sizeof(uint32_t) * new_capacity);
+        if (!new_ids) return false;
+        graph->location_ids = new_ids;
+
+        float* new_x = realloc(graph->pos_x, sizeof(float) * new_capacity);
+        if (!new_x) return false;
+        graph->pos_x = new_x;
+
+        float* new_y = realloc(graph->pos_y, sizeof(float) * new_capacity);
+        if (!new_y) return false;
+        graph->pos_y = new_y;
+
+        bool* new_has = realloc(graph->has_position, sizeof(bool) * new_capacity);
+        if (!new_has) return false;
+        graph->has_position = new_has;
+
+        graph->location_capacity = new_capacity;
+    }
+
+    if (!id_map_put_index(graph->index_by_id, location_id, graph->location_count)) {
+        return false;
     }
+
+    graph->location_ids[graph->location_count] = location_id;
+    graph->has_position[graph->location_count] = false;
+    graph->location_count++;
+    graph->csr_dirty = true;
+    graph->heuristic_dirty = true;
+    return true;
 }
 
-static void pq_heapify_down(PriorityQueue* pq, size_t index) {
-    while (index < pq->size) {
-        size_t left = 2 * index + 1;
-        size_t right = 2 * index + 2;
-        size_t smallest = index;
+static bool grow_edges(LocationGraph* graph) {
+    size_t new_capacity = graph->edge_capacity ? graph->edge_capacity * 2 : 64;
+
+    uint32_t* from = realloc(graph->edge_from, sizeof(uint32_t) * new_capacity);
+    if (!from) return false;
+    graph->edge_from = from;
+
+    uint32_t* to = realloc(graph->edge_to, sizeof(uint32_t) * new_capacity);
+    if (!to) return false;
+    graph->edge_to = to;
+
+    uint8_t* times = realloc(graph->edge_times, new_capacity);
+    if (!times) return false;
+    graph->edge_times = times;
+
+    uint8_t* dangers = realloc(graph->edge_dangers, new_capacity);
+    if (!dangers) return false;
+    graph->edge_dangers = dangers;
+
+    EdgeUnlock* unlocks = realloc(graph->edge_unlocks, sizeof(EdgeUnlock) * new_capacity);
+    if (!unlocks) return false;
+    graph->edge_unlocks = unlocks;
+
+    graph->edge_capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Rebuild the CSR arrays from the edge list
+ */
+static bool compile_csr(LocationGraph* graph) {
+    size_t rows = graph->location_count + 1;
+    size_t edges = graph->connection_count;
+
+    if (rows > graph->csr_row_capacity) {
+        uint32_t* offsets = realloc(graph->csr_offsets, sizeof(uint32_t) * rows);
+        if (!offsets) return false;
+        graph->csr_offsets = offsets;
+
+        uint32_t* reverse_offsets = realloc(graph->rcsr_offsets, sizeof(uint32_t) * rows);
+        if (!reverse_offsets) return false;
+        graph->rcsr_offsets = reverse_offsets;
+
+        graph->csr_row_capacity = rows;
+    }
+
+    if (edges > graph->csr_edge_capacity) {
+        size_t capacity = graph->edge_capacity;
 
-        if (left < pq->size && pq->nodes[left].cost < pq->nodes[smallest].cost) {
-            smallest = left;
+        uint32_t* targets = realloc(graph->csr_targets, sizeof(uint32_t) * capacity);
+        if (!targets) return false;
+        graph->csr_targets = targets;
+
+        uint8_t* times = realloc(graph->csr_times, capacity);
+        if (!times) return false;
+        graph->csr_times = times;
+
+        uint8_t* dangers = realloc(graph->csr_dangers, capacity);
+        if (!dangers) return false;
+        graph->csr_dangers = dangers;
+
+        uint32_t* edge_ids = realloc(graph->csr_edges, sizeof(uint32_t) * capacity);
+        if (!edge_ids) return false;
+        graph->csr_edges = edge_ids;
+
+        uint32_t* sources = realloc(graph->rcsr_sources, sizeof(uint32_t) * capacity);
+        if (!sources) return false;
+        graph->rcsr_sources = sources;
+
+        uint32_t* forward = realloc(graph->rcsr_forward, sizeof(uint32_t) * capacity);
+        if (!forward) return false;
+        graph->rcsr_forward = forward;
+
+        graph->csr_edge_capacity = capacity;
+    }
+
+    /* Count out-degrees, then prefix-sum into row ends */
+    uint32_t* offsets = graph->csr_offsets;
+    memset(offsets, 0, sizeof(uint32_t) * rows);
+    for (size_t e = 0; e < edges; e++) {
+        offsets[graph->edge_from[e]]++;
+    }
+    for (size_t i = 1; i < rows; i++) {
+        offsets[i] += offsets[i - 1];
+    }
+
+    /*
+     * Walk edges oldest first, placing each just before its row's end
+     * cursor. Rows end up newest first (the order the old linked lists
+     * used) and each cursor ends at its row start.
+     */
+    for (size_t e = 0; e < edges; e++) {
+        uint32_t pos = --offsets[graph->edge_from[e]];
+        graph->csr_targets[pos] = graph->edge_to[e];
+        graph->csr_times[pos] = graph->edge_times[e];
+        graph->csr_dangers[pos] = graph->edge_dangers[e];
+        graph->csr_edges[pos] = (uint32_t)e;
+    }
+
+    /* Reverse rows the same way, from the forward rows */
+    uint32_t* reverse = graph->rcsr_offsets;
+    memset(reverse, 0, sizeof(uint32_t) * rows);
+    for (size_t pos = 0; pos < edges; pos++) {
+        reverse[graph->csr_targets[pos]]++;
+    }
+    for (size_t i = 1; i < rows; i++) {
+        reverse[i] += reverse[i - 1];
+    }
+    for (size_t from = 0; from + 1 < rows; from++) {
+        for (uint32_t pos = offsets[from]; pos < offsets[from + 1]; pos++) {
+            uint32_t slot = --reverse[graph->csr_targets[pos]];
+            graph->rcsr_sources[slot] = (uint32_t)from;
+            graph->rcsr_forward[slot] = pos;
         }
-        if (right < pq->size && pq->nodes[right].cost < pq->nodes[smallest].cost) {
-            smallest = right;
+    }
+
+    graph->csr_dirty = false;
+    return true;
+}
+
+/**
+ * @brief Recompute the A* heuristic scale
+ *
+ * The heuristic is scale * straight-line distance to the target. The
+ * scale is the smallest travel time per map unit over all edges, so the
+ * estimate never exceeds the true remaining time (admissible) and never
+ * drops by more than an edge's cost along it (consistent). Without a
+ * position for every location the scale is 0 and A* degrades to
+ * Dijkstra.
+ */
+static void compile_heuristic(LocationGraph* graph) {
+    graph->heuristic_dirty = false;
+    graph->heuristic_scale = 0.0f;
+
+    if (graph->location_count == 0 || graph->positioned_count < graph->location_count) {
+        return;
+    }
+
+    float scale = -1.0f;
+    for (size_t e = 0; e < graph->connection_count; e++) {
+        uint32_t a = graph->edge_from[e];
+        uint32_t b = graph->edge_to[e];
+        float dx = graph->pos_x[a] - graph->pos_x[b];
+        float dy = graph->pos_y[a] - graph->pos_y[b];
+        float length = sqrtf(dx * dx + dy * dy);
+        if (length <= 0.0f) continue;
+
+        float per_unit = (float)graph->edge_times[e] / length;
+        if (scale < 0.0f || per_unit < scale) {
+            scale = per_unit;
         }
+    }
 
-        if (smallest == index) break;
+    /* Shave a little off so float rounding cannot overestimate */
+    graph->heuristic_scale = scale > 0.0f ? scale * 0.999f : 0.0f;
+}
 
-        pq_swap(&pq->nodes[index], &pq->nodes[smallest]);
-        index = smallest;
+/**
+ * @brief Compile the CSR if the edge list changed
+ *
+ * Queries take a const graph; the compiled adjacency is a cache, so it
+ * is refreshed through a cast. Call location_graph_compile() before
+ * sharing a graph between threads.
+ */
+static bool ensure_compiled(const LocationGraph* graph) {
+    if (graph->csr_dirty && !compile_csr((LocationGraph*)graph)) {
+        LOG_ERROR("location_graph: Failed to compile adjacency");
+        return false;
     }
+    if (graph->heuristic_dirty) {
+        compile_heuristic((LocationGraph*)graph);
+    }
+    return true;
 }
 
-static bool pq_push(PriorityQueue* pq, uint32_t location_id, uint32_t cost) {
-    if (pq->size >= pq->capacity) return false;
+/**
+ * @brief CSR position of the newest from_index -> to_id edge, or -1
+ */
+static long find_edge(const LocationGraph* graph, int from_index, uint32_t to_id) {
+    int to_index = find_location_index(graph, to_id);
+    if (to_index < 0) return -1;
+
+    for (uint32_t pos = graph->csr_offsets[from_index];
+         pos < graph->csr_offsets[from_index + 1]; pos++) {
+        if (graph->csr_targets[pos] == (uint32_t)to_index) {
+            return (long)pos;
+        }
+    }
+    return -1;
+}
 
-    pq->nodes[pq->size].location_id = location_id;
-    pq->nodes[pq->size].cost = cost;
-    pq_heapify_up(pq, pq->size);
-    pq->size++;
+/* Workspace helpers */
+static bool grow_array(uint32_t** array, size_t count) {
+    uint32_t* resized = realloc(*array, sizeof(uint32_t) * count);
+    if (!resized) return false;
+    *array = resized;
     return true;
 }
 
-static bool pq_pop(PriorityQueue* pq, PQNode* node) {
-    if (pq->size == 0) return false;
+/**
+ * @brief Size one search direction for nodes and heap_needed entries
+ */
+static bool side_prepare(SearchSide* side, size_t old_nodes, size_t nodes,
+                         size_t heap_needed) {
+    if (nodes > old_nodes) {
+        if (!grow_array(&side->dist, nodes) || !grow_array(&side->pred, nodes) ||
+            !grow_array(&side->pred_edge, nodes) || !grow_array(&side->stamp, nodes) ||
+            !grow_array(&side->settled, nodes)) {
+            return false;
+        }
+        /* New slots must not look valid for the current generation */
+        memset(side->stamp + old_nodes, 0, sizeof(uint32_t) * (nodes - old_nodes));
+        memset(side->settled + old_nodes, 0, sizeof(uint32_t) * (nodes - old_nodes));
+    }
 
-    *node = pq->nodes[0];
-    pq->nodes[0] = pq->nodes[pq->size - 1];
-    pq->size--;
-    if (pq->size > 0) {
-        pq_heapify_down(pq, 0);
+    if (heap_needed > side->heap_capacity) {
+        HeapEntry* heap = realloc(side->heap, sizeof(HeapEntry) * heap_needed);
+        if (!heap) return false;
+        side->heap = heap;
+        side->heap_capacity = heap_needed;
     }
+
+    side->heap_size = 0;
     return true;
 }
 
-static bool pq_is_empty(const PriorityQueue* pq) {
-    return pq->size == 0;
+static void side_free(SearchSide* side) {
+    free(side->dist);
+    free(side->pred);
+    free(side->pred_edge);
+    free(side->stamp);
+    free(side->settled);
+    free(side->heap);
 }
 
-/* Graph helper functions */
-static int find_location_index(const LocationGraph* graph, uint32_t location_id) {
-    for (size_t i = 0; i < graph->location_count; i++) {
-        if (graph->location_ids[i] == location_id) {
-            return (int)i;
+/**
+ * @brief Size a workspace for the graph and start a new query generation
+ *
+ * The backward side is only sized when a bidirectional query needs it.
+ */
+static bool workspace_prepare(PathWorkspace* ws, const LocationGraph* graph,
+                              bool backward) {
+    size_t nodes = graph->location_count;
+    /* Lazy deletion pushes at most once per edge, plus the start node */
+    size_t heap_needed = graph->connection_count + 1;
+
+    if (!side_prepare(&ws->forward, ws->node_capacity, nodes, heap_needed)) {
+        return false;
+    }
+    if (nodes > ws->node_capacity) {
+        if (!grow_array(&ws->path, nodes)) return false;
+        ws->node_capacity = nodes;
+    }
+
+    if (backward) {
+        if (!side_prepare(&ws->backward, ws->backward_capacity, nodes, heap_needed)) {
+            return false;
+        }
+        if (nodes > ws->backward_capacity) {
+            ws->backward_capacity = nodes;
         }
     }
-    return -1;
+
+    if (++ws->generation == 0) {
+        /* Wrapped: old stamps could collide with the new generation */
+        memset(ws->forward.stamp, 0, sizeof(uint32_t) * ws->node_capacity);
+        memset(ws->forward.settled, 0, sizeof(uint32_t) * ws->node_capacity);
+        if (ws->backward_capacity > 0) {
+            memset(ws->backward.stamp, 0, sizeof(uint32_t) * ws->backward_capacity);
+            memset(ws->backward.settled, 0, sizeof(uint32_t) * ws->backward_capacity);
+        }
+        ws->generation = 1;
+    }
+    return true;
 }
 
-static bool add_location_id(LocationGraph* graph, uint32_t location_id) {
-    if (find_location_index(graph, location_id) >= 0) {
-        return true; /* Already exists */
+/**
+ * @brief A* estimate of the remaining hours from node to target
+ */
+static uint32_t heuristic(const LocationGraph* graph, uint32_t node, uint32_t target) {
+    float dx = graph->pos_x[node] - graph->pos_x[target];
+    float dy = graph->pos_y[node] - graph->pos_y[target];
+    return (uint32_t)(graph->heuristic_scale * sqrtf(dx * dx + dy * dy));
+}
+
+static void side_start(SearchSide* side, uint32_t node, uint32_t gen) {
+    side->dist[node] = 0;
+    side->pred[node] = UINT32_MAX;
+    side->stamp[node] = gen;
+    heap_push(side, node, 0);
+}
+
+/**
+ * @brief Dijkstra (or A* when use_heuristic) from start until target is settled
+ *
+ * Pass UINT32_MAX as target to settle everything reachable; the
+ * heuristic needs a target and is ignored then.
+ *
+ * @return true if target was reached
+ */
+static bool run_dijkstra(const LocationGraph* graph, PathWorkspace* ws,
+                         uint32_t start, uint32_t target, bool use_heuristic,
+                         uint32_t* nodes_settled) {
+    SearchSide* side = &ws->forward;
+    uint32_t gen = ws->generation;
+    uint32_t settled_count = 0;
+    bool reached = false;
+
+    if (target == UINT32_MAX || graph->heuristic_scale <= 0.0f) {
+        use_heuristic = false;
     }
 
-    if (graph->location_count >= graph->location_capacity) {
-        /* Grow capacity */
-        size_t new_capacity = graph->location_capacity * 2;
-        uint32_t* new_ids = realloc(graph->location_ids,
-                                     sizeof(uint32_t) * new_capacity);
-        if (!new_ids) return false;
+    side_start(side, start, gen);
 
-        AdjListNode** new_lists = realloc(graph->adjacency_lists,
-                                          sizeof(AdjListNode*) * new_capacity);
-        if (!new_lists) {
-            free(new_ids);
-            return false;
+    while (side->heap_size > 0) {
+        uint32_t node = heap_pop(side).node;
+
+        if (side->settled[node] == gen) continue;
+        side->settled[node] = gen;
+        settled_count++;
+
+        if (node == target) {
+            reached = true;
+            break;
         }
 
-        /* Initialize new adjacency lists to NULL */
-        for (size_t i = graph->location_capacity; i < new_capacity; i++) {
-            new_lists[i] = NULL;
+        /* Locked connections are not filtered: player unlocks are not tracked yet */
+        for (uint32_t pos = graph->csr_offsets[node];
+             pos < graph->csr_offsets[node + 1]; pos++) {
+            uint32_t next = graph->csr_targets[pos];
+            if (side->settled[next] == gen) continue;
+
+            uint32_t new_dist = side->dist[node] + graph->csr_times[pos];
+            if (side->stamp[next] != gen || new_dist < side->dist[next]) {
+                side->dist[next] = new_dist;
+                side->pred[next] = node;
+                side->pred_edge[next] = pos;
+                side->stamp[next] = gen;
+
+                uint32_t key = new_dist;
+                if (use_heuristic) {
+                    key += heuristic(graph, next, target);
+                }
+                heap_push(side, next, key);
+            }
         }
+    }
 
-        graph->location_ids = new_ids;
-        graph->adjacency_lists = new_lists;
-        graph->location_capacity = new_capacity;
+    *nodes_settled = settled_count;
+    return reached || target == UINT32_MAX;
+}
+
+/**
+ * @brief Settle one node on one side of a search
+ *
+ * In a bidirectional search, every label set where the other side
+ * already has one is a candidate meeting point; the cheapest is kept in
+ * best/meet. Pass other as NULL for a one-sided search.
+ */
+static bool search_step(const LocationGraph* graph, SearchSide* side,
+                        const SearchSide* other, bool backward, uint32_t gen,
+                        uint32_t* best, uint32_t* meet) {
+    uint32_t node = heap_pop(side).node;
+    if (side->settled[node] == gen) return false;
+    side->settled[node] = gen;
+
+    const uint32_t* offsets = backward ? graph->rcsr_offsets : graph->csr_offsets;
+    for (uint32_t slot = offsets[node]; slot < offsets[node + 1]; slot++) {
+        uint32_t pos = backward ? graph->rcsr_forward[slot] : slot;
+        uint32_t next = backward ? graph->rcsr_sources[slot] : graph->csr_targets[pos];
+        if (side->settled[next] == gen) continue;
+
+        uint32_t new_dist = side->dist[node] + graph->csr_times[pos];
+        if (side->stamp[next] == gen && new_dist >= side->dist[next]) continue;
+
+        side->dist[next] = new_dist;
+        side->pred[next] = node;
+        side->pred_edge[next] = pos;
+        side->stamp[next] = gen;
+        heap_push(side, next, new_dist);
+
+        if (other && other->stamp[next] == gen && new_dist + other->dist[next] < *best) {
+            *best = new_dist + other->dist[next];
+            *meet = next;
+        }
     }
+    return true;
+}
 
-    graph->location_ids[graph->location_count] = location_id;
-    graph->adjacency_lists[graph->location_count] = NULL;
-    graph->location_count++;
+/**
+ * @brief Bidirectional Dijkstra between start and target
+ *
+ * Grows a forward search from start and a backward search (over incoming
+ * edges) from target, always expanding the side with the cheaper
+ * frontier. Once the two frontiers together cost at least the best
+ * meeting found, no shorter path can remain.
+ *
+ * @return Meeting node on the shortest path, or UINT32_MAX if unreachable
+ */
+static uint32_t run_bidirectional(const LocationGraph* graph, PathWorkspace* ws,
+                                  uint32_t start, uint32_t target,
+                                  uint32_t* nodes_settled) {
+    SearchSide* forward = &ws->forward;
+    SearchSide* backward = &ws->backward;
+    uint32_t gen = ws->generation;
+    uint32_t best = UINT32_MAX;
+    uint32_t meet = UINT32_MAX;
+    uint32_t settled_count = 0;
+
+    side_start(forward, start, gen);
+    side_start(backward, target, gen);
+    if (start == target) {
+        best = 0;
+        meet = start;
+    }
+
+    /* When either side runs dry every path through it has been seen */
+    while (forward->heap_size > 0 && backward->heap_size > 0) {
+        uint32_t top_forward = forward->heap[0].cost;
+        uint32_t top_backward = backward->heap[0].cost;
+        if (best != UINT32_MAX && top_forward + top_backward >= best) break;
+
+        if (top_forward <= top_backward) {
+            settled_count += search_step(graph, forward, backward, false,
+                                         gen, &best, &meet);
+        } else {
+            settled_count += search_step(graph, backward, forward, true,
+                                         gen, &best, &meet);
+        }
+    }
+
+    *nodes_settled = settled_count;
+    return meet;
+}
+
+/**
+ * @brief Fill the all-pairs travel table for the current graph
+ *
+ * Column t comes from one backward Dijkstra from t over incoming edges:
+ * its distances are every location's time to t, and each settled
+ * location's backward predecessor edge is its first hop toward t.
+ *
+ * @return false on allocation failure or a time too long for uint16
+ */
+static bool build_table(LocationGraph* graph) {
+    size_t n = graph->location_count;
+    size_t cells = n * n;
+
+    if (cells > graph->table_capacity) {
+        uint16_t* times = realloc(graph->table_times, sizeof(uint16_t) * cells);
+        if (!times) return false;
+        graph->table_times = times;
+
+        uint32_t* hops = realloc(graph->table_hops, sizeof(uint32_t) * cells);
+        if (!hops) return false;
+        graph->table_hops = hops;
+
+        graph->table_capacity = cells;
+    }
+    graph->table_size = n;
+
+    PathWorkspace* ws = graph->workspace;
+    for (size_t t = 0; t < n; t++) {
+        if (!workspace_prepare(ws, graph, true)) return false;
+
+        SearchSide* side = &ws->backward;
+        uint32_t gen = ws->generation;
+        uint32_t best = UINT32_MAX;
+        uint32_t meet = UINT32_MAX;
+        side_start(side, (uint32_t)t, gen);
+        while (side->heap_size > 0) {
+            search_step(graph, side, NULL, true, gen, &best, &meet);
+        }
+
+        for (size_t s = 0; s < n; s++) {
+            size_t cell = s * n + t;
+            if (side->settled[s] != gen) {
+                graph->table_times[cell] = LOCATION_GRAPH_UNREACHABLE;
+                graph->table_hops[cell] = UINT32_MAX;
+                continue;
+            }
+            if (side->dist[s] >= LOCATION_GRAPH_UNREACHABLE) {
+                LOG_WARN("location_graph: Travel time %u too long for the travel table",
+                         side->dist[s]);
+                return false;
+            }
+            graph->table_times[cell] = (uint16_t)side->dist[s];
+            graph->table_hops[cell] = s == t ? UINT32_MAX : side->pred_edge[s];
+        }
+    }
+
+    LOG_DEBUG("location_graph: Built %zux%zu travel table", n, n);
+    return true;
+}
+
+/**
+ * @brief Whether the travel table can answer queries for this version
+ *
+ * After an edit the first query searches; the second pays for a rebuild,
+ * so a run of edits interleaved with single queries never rebuilds.
+ * A failed build is not retried until the graph changes again.
+ */
+static bool table_ready(const LocationGraph* graph) {
+    LocationGraph* g = (LocationGraph*)graph;
+
+    if (g->table_version != g->version) {
+        g->table_version = g->version;
+        g->table_valid = false;
+        g->table_requests = 0;
+    }
+    if (g->table_valid) return true;
+    if (g->table_requests >= 2 || g->location_count > LOCATION_GRAPH_TABLE_MAX_LOCATIONS) {
+        return false;
+    }
+    if (++g->table_requests < 2 || !ensure_compiled(g)) return false;
+
+    g->table_valid = build_table(g);
+    return g->table_valid;
+}
+
+/**
+ * @brief Answer a path query by following table next-hops
+ *
+ * @return false on allocation failure
+ */
+static bool table_find_path(const LocationGraph* graph, uint32_t start, uint32_t target,
+                            bool want_path, PathfindingResult* result) {
+    size_t n = graph->table_size;
+    uint16_t time = graph->table_times[start * n + target];
+    if (time == LOCATION_GRAPH_UNREACHABLE) return true;
+
+    size_t path_length = 1;
+    for (uint32_t node = start; node != target;
+         node = graph->csr_targets[graph->table_hops[node * n + target]]) {
+        result->total_danger += graph->csr_dangers[graph->table_hops[node * n + target]];
+        path_length++;
+    }
+
+    if (want_path) {
+        uint32_t* path = malloc(sizeof(uint32_t) * path_length);
+        if (!path) return false;
+
+        size_t i = 0;
+        uint32_t node = start;
+        path[i++] = graph->location_ids[node];
+        while (node != target) {
+            node = graph->csr_targets[graph->table_hops[node * n + target]];
+            path[i++] = graph->location_ids[node];
+        }
+        result->path = path;
+    }
+
+    result->path_length = path_length;
+    result->total_travel_time = time;
+    result->path_found = true;
     return true;
 }
 
 /* Public API Implementation */
 
 LocationGraph* location_graph_create(void) {
-    LocationGraph* graph = malloc(sizeof(LocationGraph));
+    LocationGraph* graph = calloc(1, sizeof(LocationGraph));
     if (!graph) {
         LOG_ERROR("location_graph_create: Failed to allocate graph");
         return NULL;
@@ -191,26 +775,26 @@ LocationGraph* location_graph_create(void) {
 
     graph->location_capacity = 50; /* Initial capacity */
     graph->location_ids = malloc(sizeof(uint32_t) * graph->location_capacity);
-    if (!graph->location_ids) {
-        free(graph);
+    graph->pos_x = malloc(sizeof(float) * graph->location_capacity);
+    graph->pos_y = malloc(sizeof(float) * graph->location_capacity);
+    graph->has_position = malloc(sizeof(bool) * graph->location_capacity);
+    if (!graph->location_ids || !graph->pos_x || !graph->pos_y || !graph->has_position) {
+        location_graph_destroy(graph);
         LOG_ERROR("location_graph_create: Failed to allocate location_ids");
         return NULL;
     }
 
-    graph->adjacency_lists = malloc(sizeof(AdjListNode*) * graph->location_capacity);
-    if (!graph->adjacency_lists) {
-        free(graph->location_ids);
-        free(graph);
-        LOG_ERROR("location_graph_create: Failed to allocate adjacency_lists");
+    graph->index_by_id = id_map_create(graph->location_capacity);
+    graph->workspace = path_workspace_create();
+    if (!graph->index_by_id || !graph->workspace) {
+        location_graph_destroy(graph);
+        LOG_ERROR("location_graph_create: Failed to allocate location index or workspace");
         return NULL;
     }
 
-    for (size_t i = 0; i < graph->location_capacity; i++) {
-        graph->adjacency_lists[i] = NULL;
-    }
-
-    graph->location_count = 0;
-    graph->connection_count = 0;
+    /* An empty graph still needs its single row offset */
+    graph->csr_dirty = true;
+    graph->version = 1;
 
     LOG_DEBUG("location_graph_create: Created graph with capacity %zu",
                graph->location_capacity);
@@ -220,23 +804,57 @@ LocationGraph* location_graph_create(void) {
 void location_graph_destroy(LocationGraph* graph) {
     if (!graph) return;
 
-    /* Free all adjacency list nodes */
-    for (size_t i = 0; i < graph->location_count; i++) {
-        AdjListNode* node = graph->adjacency_lists[i];
-        while (node) {
-            AdjListNode* next = node->next;
-            free(node);
-            node = next;
-        }
-    }
-
-    free(graph->adjacency_lists);
     free(graph->location_ids);
+    free(graph->pos_x);
+    free(graph->pos_y);
+    free(graph->has_position);
+    id_map_destroy(graph->index_by_id);
+
+    free(graph->edge_from);
+    free(graph->edge_to);
+    free(graph->edge_times);
+    free(graph->edge_dangers);
+    free(graph->edge_unlocks);
+
+    free(graph->csr_offsets);
+    free(graph->csr_targets);
+    free(graph->csr_times);
+    free(graph->csr_dangers);
+    free(graph->csr_edges);
+    free(graph->rcsr_offsets);
+    free(graph->rcsr_sources);
+    free(graph->rcsr_forward);
+    free(graph->table_times);
+    free(graph->table_hops);
+
+    path_workspace_destroy(graph->workspace);
     free(graph);
 
     LOG_DEBUG( "location_graph_destroy: Graph destroyed");
 }
 
+bool location_graph_compile(LocationGraph* graph) {
+    if (!graph) return false;
+    return ensure_compiled(graph);
+}
+
+PathWorkspace* path_workspace_create(void) {
+    PathWorkspace* ws = calloc(1, sizeof(PathWorkspace));
+    if (!ws) {
+        LOG_ERROR("path_workspace_create: Failed to allocate workspace");
+    }
+    return ws;
+}
+
+void path_workspace_destroy(PathWorkspace* ws) {
+    if (!ws) return;
+
+    side_free(&ws->forward);
+    side_free(&ws->backward);
+    free(ws->path);
+    free(ws);
+}
+
 bool location_graph_add_connection(LocationGraph* graph,
                                     uint32_t from_id,
                                     uint32_t to_id,
@@ -258,30 +876,23 @@ bool location_graph_add_connection(LocationGraph* graph,
         return false;
     }
 
-    int from_index = find_location_index(graph, from_id);
-    if (from_index < 0) {
-        LOG_ERROR( "location_graph_add_connection: Invalid from_id %u", from_id);
+    if (graph->connection_count >= graph->edge_capacity && !grow_edges(graph)) {
+        LOG_ERROR( "location_graph_add_connection: Failed to allocate edge");
         return false;
     }
 
-    /* Create new adjacency list node */
-    AdjListNode* new_node = malloc(sizeof(AdjListNode));
-    if (!new_node) {
-        LOG_ERROR( "location_graph_add_connection: Failed to allocate node");
-        return false;
-    }
-
-    new_node->to_location_id = to_id;
-    new_node->travel_time_hours = travel_time;
-    new_node->danger_level = danger_level;
-    new_node->requires_unlock = false;
-    new_node->unlock_requirement[0] = '\0';
-
-    /* Insert at head of adjacency list */
-    new_node->next = graph->adjacency_lists[from_index];
-    graph->adjacency_lists[from_index] = new_node;
+    size_t e = graph->connection_count;
+    graph->edge_from[e] = (uint32_t)find_location_index(graph, from_id);
+    graph->edge_to[e] = (uint32_t)find_location_index(graph, to_id);
+    graph->edge_times[e] = travel_time;
+    graph->edge_dangers[e] = danger_level;
+    graph->edge_unlocks[e].requires_unlock = false;
+    graph->edge_unlocks[e].unlock_requirement[0] = '\0';
 
     graph->connection_count++;
+    graph->csr_dirty = true;
+    graph->heuristic_dirty = true;
+    graph->version++;
 
     LOG_DEBUG( "location_graph_add_connection: Added %u -> %u (time=%u, danger=%u)",
                from_id, to_id, travel_time, danger_level);
@@ -322,26 +933,27 @@ bool location_graph_set_unlock_requirement(LocationGraph* graph,
         return false;
     }
 
+    if (!ensure_compiled(graph)) return false;
+
     /* Find the connection */
-    AdjListNode* node = graph->adjacency_lists[from_index];
-    while (node) {
-        if (node->to_location_id == to_id) {
-            node->requires_unlock = true;
-            strncpy(node->unlock_requirement, requirement,
-                    sizeof(node->unlock_requirement) - 1);
-            node->unlock_requirement[sizeof(node->unlock_requirement) - 1] = '\0';
-
-            LOG_DEBUG(
-                       "location_graph_set_unlock_requirement: Set %u -> %u requires '%s'",
-                       from_id, to_id, requirement);
-            return true;
-        }
-        node = node->next;
+    long pos = find_edge(graph, from_index, to_id);
+    if (pos < 0) {
+        LOG_WARN( "location_graph_set_unlock_requirement: Connection %u -> %u not found",
+                   from_id, to_id);
+        return false;
     }
 
-    LOG_WARN( "location_graph_set_unlock_requirement: Connection %u -> %u not found",
-               from_id, to_id);
-    return false;
+    EdgeUnlock* unlock = &graph->edge_unlocks[graph->csr_edges[pos]];
+    unlock->requires_unlock = true;
+    strncpy(unlock->unlock_requirement, requirement,
+            sizeof(unlock->unlock_requirement) - 1);
+    unlock->unlock_requirement[sizeof(unlock->unlock_requirement) - 1] = '\0';
+    graph->version++;
+
+    LOG_DEBUG(
+               "location_graph_set_unlock_requirement: Set %u -> %u requires '%s'",
+               from_id, to_id, requirement);
+    return true;
 }
 
 bool location_graph_has_connection(const LocationGraph* graph,
@@ -350,17 +962,9 @@ bool location_graph_has_connection(const LocationGraph* graph,
     if (!graph) return false;
 
     int from_index = find_location_index(graph, from_id);
-    if (from_index < 0) return false;
-
-    AdjListNode* node = graph->adjacency_lists[from_index];
-    while (node) {
-        if (node->to_location_id == to_id) {
-            return true;
-        }
-        node = node->next;
-    }
+    if (from_index < 0 || !ensure_compiled(graph)) return false;
 
-    return false;
+    return find_edge(graph, from_index, to_id) >= 0;
 }
 
 size_t location_graph_get_neighbors(const LocationGraph* graph,
@@ -370,13 +974,12 @@ size_t location_graph_get_neighbors(const LocationGraph* graph,
     if (!graph || !neighbors) return 0;
 
     int index = find_location_index(graph, location_id);
-    if (index < 0) return 0;
+    if (index < 0 || !ensure_compiled(graph)) return 0;
 
     size_t count = 0;
-    AdjListNode* node = graph->adjacency_lists[index];
-    while (node && count < max_neighbors) {
-        neighbors[count++] = node->to_location_id;
-        node = node->next;
+    for (uint32_t pos = graph->csr_offsets[index];
+         pos < graph->csr_offsets[index + 1] && count < max_neighbors; pos++) {
+        neighbors[count++] = graph->location_ids[graph->csr_targets[pos]];
     }
 
     return count;
@@ -389,34 +992,31 @@ bool location_graph_get_connection(const LocationGraph* graph,
     if (!graph) return false;
 
     int from_index = find_location_index(graph, from_id);
-    if (from_index < 0) return false;
-
-    AdjListNode* node = graph->adjacency_lists[from_index];
-    while (node) {
-        if (node->to_location_id == to_id) {
-            if (connection) {
-                connection->from_location_id = from_id;
-                connection->to_location_id = to_id;
-                connection->travel_time_hours = node->travel_time_hours;
-                connection->danger_level = node->danger_level;
-                connection->requires_unlock = node->requires_unlock;
-                strncpy(connection->unlock_requirement, node->unlock_requirement,
-                        sizeof(connection->unlock_requirement) - 1);
-                connection->unlock_requirement[sizeof(connection->unlock_requirement) - 1] = '\0';
-            }
-            return true;
-        }
-        node = node->next;
+    if (from_index < 0 || !ensure_compiled(graph)) return false;
+
+    long pos = find_edge(graph, from_index, to_id);
+    if (pos < 0) return false;
+
+    if (connection) {
+        const EdgeUnlock* unlock = &graph->edge_unlocks[graph->csr_edges[pos]];
+        connection->from_location_id = from_id;
+        connection->to_location_id = to_id;
+        connection->travel_time_hours = graph->csr_times[pos];
+        connection->danger_level = graph->csr_dangers[pos];
+        connection->requires_unlock = unlock->requires_unlock;
+        memcpy(connection->unlock_requirement, unlock->unlock_requirement,
+               sizeof(connection->unlock_requirement));
     }
-
-    return false;
+    return true;
 }
 
-bool location_graph_find_path(const LocationGraph* graph,
-                               uint32_t from_id,
-                               uint32_t to_id,
-                               PathfindingResult* result) {
-    if (!graph || !result) {
+bool location_graph_find_path_with_workspace(const LocationGraph* graph,
+                                              PathWorkspace* workspace,
+                                              PathfindingMode mode,
+                                              uint32_t from_id,
+                                              uint32_t to_id,
+                                              PathfindingResult* result) {
+    if (!graph || !workspace || !result) {
         LOG_ERROR( "location_graph_find_path: NULL parameter");
         return false;
     }
@@ -426,150 +1026,135 @@ bool location_graph_find_path(const LocationGraph* graph,
     result->path_length = 0;
     result->total_travel_time = 0;
     result->total_danger = 0;
+    result->nodes_settled = 0;
     result->path_found = false;
 
     /* Check if locations exist */
-    if (find_location_index(graph, from_id) < 0 ||
-        find_location_index(graph, to_id) < 0) {
+    int start_index = find_location_index(graph, from_id);
+    int target_index = find_location_index(graph, to_id);
+    if (start_index < 0 || target_index < 0) {
         LOG_WARN( "location_graph_find_path: Invalid location ID");
         return true; /* Not an error, just no path */
     }
 
-    /* Same location */
-    if (from_id == to_id) {
-        result->path = malloc(sizeof(uint32_t));
-        if (!result->path) return false;
-        result->path[0] = from_id;
-        result->path_length = 1;
-        result->path_found = true;
-        return true;
-    }
-
-    /* Dijkstra's algorithm */
-    PriorityQueue* pq = pq_create(graph->location_count);
-    if (!pq) {
-        LOG_ERROR( "location_graph_find_path: Failed to create priority queue");
-        return false;
-    }
-
-    uint32_t* distances = malloc(sizeof(uint32_t) * graph->location_count);
-    uint32_t* predecessors = malloc(sizeof(uint32_t) * graph->location_count);
-    bool* visited = calloc(graph->location_count, sizeof(bool));
-
-    if (!distances || !predecessors || !visited) {
+    bool bidirectional = mode == PATHFINDING_BIDIRECTIONAL;
+    if (!ensure_compiled(graph) || !workspace_prepare(workspace, graph, bidirectional)) {
         LOG_ERROR( "location_graph_find_path: Memory allocation failed");
-        free(distances);
-        free(predecessors);
-        free(visited);
-        pq_destroy(pq);
         return false;
     }
 
-    /* Initialize distances to infinity */
-    for (size_t i = 0; i < graph->location_count; i++) {
-        distances[i] = UINT32_MAX;
-        predecessors[i] = UINT32_MAX;
+    uint32_t start = (uint32_t)start_index;
+    uint32_t target = (uint32_t)target_index;
+    uint32_t meet = target;
+    if (bidirectional) {
+        meet = run_bidirectional(graph, workspace, start, target, &result->nodes_settled);
+        if (meet == UINT32_MAX) return true;
+    } else if (!run_dijkstra(graph, workspace, start, target,
+                             mode == PATHFINDING_ASTAR, &result->nodes_settled)) {
+        return true;
     }
 
-    int start_index = find_location_index(graph, from_id);
-    distances[start_index] = 0;
-    pq_push(pq, from_id, 0);
-
-    bool found = false;
-    while (!pq_is_empty(pq)) {
-        PQNode current;
-        pq_pop(pq, &current);
+    const SearchSide* forward = &workspace->forward;
+    const SearchSide* backward = &workspace->backward;
 
-        int current_index = find_location_index(graph, current.location_id);
-        if (current_index < 0) continue;
-
-        if (visited[current_index]) continue;
-        visited[current_index] = true;
-
-        if (current.location_id == to_id) {
-            found = true;
-            break;
+    /* Forward half: start .. meet; backward half (bidirectional): meet .. target */
+    size_t forward_length = 1;
+    for (uint32_t node = meet; node != start; node = forward->pred[node]) {
+        forward_length++;
+    }
+    size_t path_length = forward_length;
+    if (bidirectional) {
+        for (uint32_t node = meet; node != target; node = backward->pred[node]) {
+            path_length++;
         }
+    }
 
-        /* Explore neighbors */
-        AdjListNode* node = graph->adjacency_lists[current_index];
-        while (node) {
-            int neighbor_index = find_location_index(graph, node->to_location_id);
-            if (neighbor_index < 0) {
-                node = node->next;
-                continue;
-            }
+    /* Walk predecessors back from meet, filling the front of the path */
+    size_t i = forward_length;
+    for (uint32_t node = meet; ; node = forward->pred[node]) {
+        workspace->path[--i] = graph->location_ids[node];
+        if (node == start) break;
+        result->total_danger += graph->csr_dangers[forward->pred_edge[node]];
+    }
 
-            if (visited[neighbor_index]) {
-                node = node->next;
-                continue;
-            }
+    /* Walk successors on to the target, filling the rest */
+    i = forward_length;
+    if (bidirectional) {
+        for (uint32_t node = meet; node != target; node = backward->pred[node]) {
+            result->total_danger += graph->csr_dangers[backward->pred_edge[node]];
+            workspace->path[i++] = graph->location_ids[backward->pred[node]];
+        }
+    }
 
-            /* Skip locked connections (for now, we ignore unlock requirements) */
-            /* In a full implementation, this would check player's unlocks */
+    result->path = workspace->path;
+    result->path_length = path_length;
+    result->total_travel_time = forward->dist[meet] +
+                                (bidirectional ? backward->dist[meet] : 0);
+    result->path_found = true;
+    return true;
+}
 
-            uint32_t new_dist = distances[current_index] + node->travel_time_hours;
-            if (new_dist < distances[neighbor_index]) {
-                distances[neighbor_index] = new_dist;
-                predecessors[neighbor_index] = current_index;
-                pq_push(pq, node->to_location_id, new_dist);
-            }
+bool location_graph_find_path(const LocationGraph* graph,
+                               uint32_t from_id,
+                               uint32_t to_id,
+                               PathfindingResult* result) {
+    if (!graph || !result) {
+        LOG_ERROR( "location_graph_find_path: NULL parameter");
+        return false;
+    }
 
-            node = node->next;
-        }
+    /* Warm table: O(path length), no search */
+    int start_index = find_location_index(graph, from_id);
+    int target_index = find_location_index(graph, to_id);
+    if (start_index >= 0 && target_index >= 0 && table_ready(graph)) {
+        memset(result, 0, sizeof(PathfindingResult));
+        return table_find_path(graph, (uint32_t)start_index, (uint32_t)target_index,
+                               true, result);
     }
 
-    if (found) {
-        /* Reconstruct path */
-        int target_index = find_location_index(graph, to_id);
+    if (!location_graph_find_path_with_workspace(graph, graph->workspace, graph->mode,
+                                                  from_id, to_id, result)) {
+        return false;
+    }
 
-        /* Count path length */
-        size_t path_length = 0;
-        int index = target_index;
-        while (index != start_index && predecessors[index] != UINT32_MAX) {
-            path_length++;
-            index = predecessors[index];
-        }
-        path_length++; /* Include starting location */
-
-        /* Allocate and fill path array */
-        result->path = malloc(sizeof(uint32_t) * path_length);
-        if (!result->path) {
-            free(distances);
-            free(predecessors);
-            free(visited);
-            pq_destroy(pq);
+    if (result->path_found) {
+        /* Hand the caller its own copy of the workspace path */
+        uint32_t* path = malloc(sizeof(uint32_t) * result->path_length);
+        if (!path) {
+            result->path = NULL;
+            result->path_found = false;
             return false;
         }
+        memcpy(path, result->path, sizeof(uint32_t) * result->path_length);
+        result->path = path;
+    }
 
-        /* Fill path in reverse */
-        index = target_index;
-        for (int i = (int)path_length - 1; i >= 0; i--) {
-            result->path[i] = graph->location_ids[index];
-            if (i > 0) {
-                index = predecessors[index];
-            }
-        }
+    return true;
+}
 
-        result->path_length = path_length;
-        result->total_travel_time = distances[target_index];
-        result->path_found = true;
+void location_graph_set_pathfinding_mode(LocationGraph* graph, PathfindingMode mode) {
+    if (!graph) return;
+    graph->mode = mode;
+}
 
-        /* Calculate total danger */
-        for (size_t i = 0; i < path_length - 1; i++) {
-            LocationConnection conn;
-            if (location_graph_get_connection(graph, result->path[i],
-                                               result->path[i + 1], &conn)) {
-                result->total_danger += conn.danger_level;
-            }
-        }
-    }
+PathfindingMode location_graph_get_pathfinding_mode(const LocationGraph* graph) {
+    return graph ? graph->mode : PATHFINDING_DIJKSTRA;
+}
 
-    free(distances);
-    free(predecessors);
-    free(visited);
-    pq_destroy(pq);
+bool location_graph_set_position(LocationGraph* graph, uint32_t location_id,
+                                 float x, float y) {
+    if (!graph) return false;
 
+    int index = find_location_index(graph, location_id);
+    if (index < 0) return false;
+
+    if (!graph->has_position[index]) {
+        graph->has_position[index] = true;
+        graph->positioned_count++;
+    }
+    graph->pos_x[index] = x;
+    graph->pos_y[index] = y;
+    graph->heuristic_dirty = true;
     return true;
 }
 
@@ -585,21 +1170,79 @@ bool location_graph_is_reachable(const LocationGraph* graph,
                                   uint32_t to_id) {
     if (!graph) return false;
 
-    /* Use pathfinding to check reachability */
+    int start_index = find_location_index(graph, from_id);
+    int target_index = find_location_index(graph, to_id);
+    if (start_index >= 0 && target_index >= 0 && table_ready(graph)) {
+        size_t cell = (size_t)start_index * graph->table_size + (size_t)target_index;
+        return graph->table_times[cell] != LOCATION_GRAPH_UNREACHABLE;
+    }
+
+    /* Reuse the graph's workspace; the path itself is not needed */
     PathfindingResult result;
-    if (!location_graph_find_path(graph, from_id, to_id, &result)) {
+    if (!location_graph_find_path_with_workspace(graph, graph->workspace, graph->mode,
+                                                  from_id, to_id, &result)) {
         return false;
     }
 
-    bool reachable = result.path_found;
-    pathfinding_result_free(&result);
-    return reachable;
+    return result.path_found;
+}
+
+bool location_graph_get_travel_time(const LocationGraph* graph,
+                                     uint32_t from_id,
+                                     uint32_t to_id,
+                                     uint32_t* hours) {
+    if (!graph) return false;
+
+    int start_index = find_location_index(graph, from_id);
+    int target_index = find_location_index(graph, to_id);
+    if (start_index < 0 || target_index < 0) return false;
+
+    if (table_ready(graph)) {
+        size_t cell = (size_t)start_index * graph->table_size + (size_t)target_index;
+        uint16_t time = graph->table_times[cell];
+        if (time == LOCATION_GRAPH_UNREACHABLE) return false;
+        if (hours) *hours = time;
+        return true;
+    }
+
+    PathfindingResult result;
+    if (!location_graph_find_path_with_workspace(graph, graph->workspace, graph->mode,
+                                                  from_id, to_id, &result) ||
+        !result.path_found) {
+        return false;
+    }
+    if (hours) *hours = result.total_travel_time;
+    return true;
+}
+
+bool location_graph_build_travel_table(LocationGraph* graph) {
+    if (!graph) return false;
+
+    if (graph->location_count > LOCATION_GRAPH_TABLE_MAX_LOCATIONS) {
+        LOG_WARN("location_graph_build_travel_table: %zu locations exceeds table limit %d",
+                 graph->location_count, LOCATION_GRAPH_TABLE_MAX_LOCATIONS);
+        return false;
+    }
+
+    /* Skip the warm-up: the second request of a version builds */
+    if (!table_ready(graph) && graph->table_requests < 2) {
+        table_ready(graph);
+    }
+    return graph->table_valid;
+}
+
+uint32_t location_graph_get_version(const LocationGraph* graph) {
+    return graph ? graph->version : 0;
 }
 
 size_t location_graph_get_connection_count(const LocationGraph* graph) {
     return graph ? graph->connection_count : 0;
 }
 
+size_t location_graph_get_location_count(const LocationGraph* graph) {
+    return graph ? graph->location_count : 0;
+}
+
 size_t location_graph_get_all_locations(const LocationGraph* graph,
                                          uint32_t* locations,
                                          size_t max_locations) {
@@ -615,21 +1258,51 @@ size_t location_graph_get_all_locations(const LocationGraph* graph,
     return count;
 }
 
+size_t location_graph_get_edges(const LocationGraph* graph,
+                                 uint32_t* from_index,
+                                 uint32_t* to_index,
+                                 uint8_t* travel_times,
+                                 size_t max_edges) {
+    if (!graph || !from_index || !to_index) return 0;
+
+    size_t count = graph->connection_count < max_edges ?
+                   graph->connection_count : max_edges;
+    if (count == 0) return 0;
+
+    memcpy(from_index, graph->edge_from, sizeof(uint32_t) * count);
+    memcpy(to_index, graph->edge_to, sizeof(uint32_t) * count);
+    if (travel_times) {
+        memcpy(travel_times, graph->edge_times, count);
+    }
+    return count;
+}
+
 bool location_graph_validate_connectivity(const LocationGraph* graph,
                                            uint32_t starting_location_id) {
     if (!graph) return false;
 
     if (graph->location_count == 0) return true; /* Empty graph is valid */
 
-    /* Check if all locations are reachable from start */
-    for (size_t i = 0; i < graph->location_count; i++) {
-        uint32_t location_id = graph->location_ids[i];
-        if (location_id == starting_location_id) continue;
+    int start_index = find_location_index(graph, starting_location_id);
+    if (start_index < 0) {
+        LOG_WARN("location_graph_validate_connectivity: Unknown start %u",
+                 starting_location_id);
+        return false;
+    }
 
-        if (!location_graph_is_reachable(graph, starting_location_id, location_id)) {
+    /* One full search from the start settles every reachable location */
+    PathWorkspace* ws = graph->workspace;
+    if (!ensure_compiled(graph) || !workspace_prepare(ws, graph, false)) {
+        return false;
+    }
+    uint32_t settled_count;
+    run_dijkstra(graph, ws, (uint32_t)start_index, UINT32_MAX, false, &settled_count);
+
+    for (size_t i = 0; i < graph->location_count; i++) {
+        if (ws->forward.settled[i] != ws->generation) {
             LOG_WARN(
                        "location_graph_validate_connectivity: Location %u unreachable from %u",
-                       location_id, starting_location_id);
+                       graph->location_ids[i], starting_location_id);
             return false;
         }
     }
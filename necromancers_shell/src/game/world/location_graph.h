@@ -15,6 +15,12 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+/** Travel table entry for a pair with no path */
+#define LOCATION_GRAPH_UNREACHABLE UINT16_MAX
+
+/** Largest graph that keeps an all-pairs travel table (6 bytes per pair) */
+#define LOCATION_GRAPH_TABLE_MAX_LOCATIONS 1024
+
 /**
  * @brief Connection between two locations
  *
@@ -40,17 +46,40 @@ typedef struct {
     size_t path_length;             /**< Number of locations in path */
     uint32_t total_travel_time;     /**< Sum of travel times in hours */
     uint32_t total_danger;          /**< Sum of danger levels along path */
+    uint32_t nodes_settled;         /**< Locations the search finalized (0 from table) */
     bool path_found;                /**< Whether a valid path exists */
 } PathfindingResult;
 
+/**
+ * @brief Shortest path search strategy
+ *
+ * All modes return a shortest path by travel time; they differ in how
+ * much of the graph they visit to find it.
+ */
+typedef enum {
+    PATHFINDING_DIJKSTRA,           /**< Uniform expansion from the start */
+    PATHFINDING_ASTAR,              /**< Guided by map positions toward the target */
+    PATHFINDING_BIDIRECTIONAL       /**< Dijkstra from both ends, meeting midway */
+} PathfindingMode;
+
 /**
  * @brief Location graph structure
  *
  * Stores all connections between locations in the game world.
- * Uses adjacency list representation for efficient pathfinding.
+ * Queries run on a compact CSR (compressed sparse row) adjacency that is
+ * recompiled lazily after connections are added.
  */
 typedef struct LocationGraph LocationGraph;
 
+/**
+ * @brief Reusable pathfinding scratch memory
+ *
+ * Holds the distance, predecessor and priority-queue arrays for shortest
+ * path queries. Once sized for a graph, queries through it allocate
+ * nothing. A workspace may be used with any graph, one query at a time.
+ */
+typedef struct PathWorkspace PathWorkspace;
+
 /**
  * @brief Create a new location graph
  *
@@ -65,6 +94,32 @@ LocationGraph* location_graph_create(void);
  */
 void location_graph_destroy(LocationGraph* graph);
 
+/**
+ * @brief Compile the graph's query representation now
+ *
+ * Queries compile the adjacency on demand after the graph changes, which
+ * writes to the graph. Call this after the last edit before querying one
+ * graph from several threads (each with its own PathWorkspace).
+ *
+ * @param graph Location graph
+ * @return true on success, false on allocation failure
+ */
+bool location_graph_compile(LocationGraph* graph);
+
+/**
+ * @brief Create a pathfinding workspace
+ *
+ * @return New workspace, or NULL on failure
+ */
+PathWorkspace* path_workspace_create(void);
+
+/**
+ * @brief Destroy a pathfinding workspace
+ *
+ * @param workspace Workspace to destroy (can be NULL)
+ */
+void path_workspace_destroy(PathWorkspace* workspace);
+
 /**
  * @brief Add a connection between two locations
  *
@@ -159,10 +214,47 @@ bool location_graph_get_connection(const LocationGraph* graph,
                                     LocationConnection* connection);
 
 /**
- * @brief Find shortest path between two locations using Dijkstra's algorithm
+ * @brief Set a location's map position for A* search
+ *
+ * A* estimates remaining travel time from straight-line distance, scaled
+ * by the fastest hours-per-unit of any connection so the estimate never
+ * overshoots. Until every location has a position, A* searches like
+ * Dijkstra.
+ *
+ * @param graph Location graph
+ * @param location_id Location to place (must already be in the graph)
+ * @param x Map X coordinate
+ * @param y Map Y coordinate
+ * @return true on success, false if the location is unknown
+ */
+bool location_graph_set_position(LocationGraph* graph, uint32_t location_id,
+                                 float x, float y);
+
+/**
+ * @brief Select the search used by location_graph_find_path()
+ *
+ * @param graph Location graph
+ * @param mode Pathfinding mode (default PATHFINDING_DIJKSTRA)
+ */
+void location_graph_set_pathfinding_mode(LocationGraph* graph, PathfindingMode mode);
+
+/**
+ * @brief Get the search used by location_graph_find_path()
+ *
+ * @param graph Location graph
+ * @return Current pathfinding mode
+ */
+PathfindingMode location_graph_get_pathfinding_mode(const LocationGraph* graph);
+
+/**
+ * @brief Find shortest path between two locations
+ *
+ * Uses travel time as edge weight and the graph's pathfinding mode
+ * (see location_graph_set_pathfinding_mode()). Ignores locked connections
+ * unless player has met unlock requirements.
  *
- * Uses travel time as edge weight. Ignores locked connections unless
- * player has met unlock requirements.
+ * Repeated queries on an unchanged graph are answered from the all-pairs
+ * travel table in O(path length); see location_graph_build_travel_table().
  *
  * The returned PathfindingResult must be freed with pathfinding_result_free().
  *
@@ -177,6 +269,30 @@ bool location_graph_find_path(const LocationGraph* graph,
                                uint32_t to_id,
                                PathfindingResult* result);
 
+/**
+ * @brief Find shortest path using caller-provided scratch memory
+ *
+ * Same search as location_graph_find_path() with an explicit mode, but
+ * allocation-free once the workspace has grown to the graph's size. It
+ * always searches and never touches the travel table.
+ * result->path points into the workspace and stays valid until its next
+ * query; do not pass the result to pathfinding_result_free().
+ *
+ * @param graph Location graph
+ * @param workspace Workspace to run the query in
+ * @param mode Search to run (independent of the graph's mode)
+ * @param from_id Starting location ID
+ * @param to_id Target location ID
+ * @param result Output pathfinding result
+ * @return true on success (path may or may not exist), false on error
+ */
+bool location_graph_find_path_with_workspace(const LocationGraph* graph,
+                                              PathWorkspace* workspace,
+                                              PathfindingMode mode,
+                                              uint32_t from_id,
+                                              uint32_t to_id,
+                                              PathfindingResult* result);
+
 /**
  * @brief Free pathfinding result
  *
@@ -189,7 +305,8 @@ void pathfinding_result_free(PathfindingResult* result);
 /**
  * @brief Check if location is reachable from starting location
  *
- * Uses breadth-first search to determine reachability.
+ * Uses the travel table when warm, otherwise runs a shortest-path search
+ * in the graph's own workspace.
  *
  * @param graph Location graph
  * @param from_id Starting location ID
@@ -200,6 +317,49 @@ bool location_graph_is_reachable(const LocationGraph* graph,
                                   uint32_t from_id,
                                   uint32_t to_id);
 
+/**
+ * @brief Get the shortest travel time between two locations
+ *
+ * O(1) once the travel table is warm.
+ *
+ * @param graph Location graph
+ * @param from_id Starting location ID
+ * @param to_id Target location ID
+ * @param hours Output travel time (can be NULL)
+ * @return true if a path exists, false otherwise
+ */
+bool location_graph_get_travel_time(const LocationGraph* graph,
+                                     uint32_t from_id,
+                                     uint32_t to_id,
+                                     uint32_t* hours);
+
+/**
+ * @brief Build the all-pairs travel table now
+ *
+ * The table holds the shortest time and first hop for every pair of
+ * locations, stamped with the graph version. Adding a connection or an
+ * unlock requirement bumps the version; the table is then rebuilt on the
+ * second query of the new version, so interleaved edits and one-off
+ * queries do not trigger rebuilds. Call this to warm it up front, e.g.
+ * before a burst of routing queries. Graphs larger than
+ * LOCATION_GRAPH_TABLE_MAX_LOCATIONS, or with times past
+ * LOCATION_GRAPH_UNREACHABLE, always search instead.
+ *
+ * @param graph Location graph
+ * @return true if the table is ready, false if unavailable
+ */
+bool location_graph_build_travel_table(LocationGraph* graph);
+
+/**
+ * @brief Get the graph version
+ *
+ * Changes whenever connections or unlock requirements change.
+ *
+ * @param graph Location graph
+ * @return Current version (0 for NULL)
+ */
+uint32_t location_graph_get_version(const LocationGraph* graph);
+
 /**
  * @brief Get total number of connections in the graph
  *
@@ -208,6 +368,14 @@ bool location_graph_is_reachable(const LocationGraph* graph,
  */
 size_t location_graph_get_connection_count(const LocationGraph* graph);
 
+/**
+ * @brief Get number of unique locations in the graph
+ *
+ * @param graph Location graph
+ * @return Number of locations with at least one connection
+ */
+size_t location_graph_get_location_count(const LocationGraph* graph);
+
 /**
  * @brief Get all unique location IDs in the graph
  *
@@ -222,6 +390,26 @@ size_t location_graph_get_all_locations(const LocationGraph* graph,
                                          uint32_t* locations,
                                          size_t max_locations);
 
+/**
+ * @brief Export every connection as location index pairs
+ *
+ * Indices refer to the order of location_graph_get_all_locations(), so
+ * callers can lay out or analyse the graph in plain arrays. Connections
+ * are listed in insertion order.
+ *
+ * @param graph Location graph
+ * @param from_index Output source indices (caller allocates)
+ * @param to_index Output destination indices (caller allocates)
+ * @param travel_times Output travel times (can be NULL)
+ * @param max_edges Capacity of the output arrays
+ * @return Number of connections written
+ */
+size_t location_graph_get_edges(const LocationGraph* graph,
+                                 uint32_t* from_index,
+                                 uint32_t* to_index,
+                                 uint8_t* travel_times,
+                                 size_t max_edges);
+
 /**
  * @brief Validate graph connectivity
  *
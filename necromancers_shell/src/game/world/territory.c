@@ -4,6 +4,7 @@
  */
 
 #include "territory.h"
+#include "../../utils/id_map.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -17,6 +18,8 @@ struct TerritoryManager {
     Location** locations;       /**< Dynamic array of location pointers */
     size_t count;               /**< Number of locations */
     size_t capacity;            /**< Capacity of array */
+    IdMap* by_id;               /**< Location ID -> Location* */
+    uint64_t version;           /**< Bumped on every recorded change */
 };
 
 TerritoryManager* territory_manager_create(void) {
@@ -26,13 +29,17 @@ TerritoryManager* territory_manager_create(void) {
     }
 
     manager->locations = malloc(INITIAL_CAPACITY * sizeof(Location*));
-    if (!manager->locations) {
+    manager->by_id = id_map_create(INITIAL_CAPACITY);
+    if (!manager->locations || !manager->by_id) {
+        free(manager->locations);
+        id_map_destroy(manager->by_id);
         free(manager);
         return NULL;
     }
 
     manager->count = 0;
     manager->capacity = INITIAL_CAPACITY;
+    manager->version = 1;
 
     return manager;
 }
@@ -47,6 +54,7 @@ void territory_manager_destroy(TerritoryManager* manager) {
         location_destroy(manager->locations[i]);
     }
     free(manager->locations);
+    id_map_destroy(manager->by_id);
     free(manager);
 }
 
@@ -56,10 +64,8 @@ bool territory_manager_add_location(TerritoryManager* manager, Location* locatio
     }
 
     /* Check for duplicate ID */
-    for (size_t i = 0; i < manager->count; i++) {
-        if (manager->locations[i]->id == location->id) {
-            return false; /* Duplicate ID */
-        }
+    if (id_map_contains(manager->by_id, location->id)) {
+        return false; /* Duplicate ID */
     }
 
     /* Expand array if needed */
@@ -74,22 +80,44 @@ bool territory_manager_add_location(TerritoryManager* manager, Location* locatio
         manager->capacity = new_capacity;
     }
 
+    if (!id_map_put(manager->by_id, location->id, location)) {
+        return false;
+    }
+
     /* Add location */
     manager->locations[manager->count++] = location;
+    manager->version++;
+    return true;
+}
+
+bool territory_manager_discover_location(TerritoryManager* manager, uint32_t id,
+                                          uint64_t timestamp) {
+    Location* location = territory_manager_get_location(manager, id);
+    if (!location || location->discovered) {
+        return false;
+    }
+
+    location_discover(location, timestamp);
+    manager->version++;
     return true;
 }
 
+void territory_manager_mark_changed(TerritoryManager* manager) {
+    if (manager) {
+        manager->version++;
+    }
+}
+
+uint64_t territory_manager_get_version(const TerritoryManager* manager) {
+    return manager ? manager->version : 0;
+}
+
 Location* territory_manager_get_location(const TerritoryManager* manager, uint32_t id) {
     if (!manager) {
         return NULL;
     }
 
-    for (size_t i = 0; i < manager->count; i++) {
-        if (manager->locations[i]->id == id) {
-            return manager->locations[i];
-        }
-    }
-    return NULL;
+    return (Location*)id_map_get(manager->by_id, id);
 }
 
 Location* territory_manager_get_location_by_name(const TerritoryManager* manager,
@@ -298,4 +326,6 @@ void territory_manager_clear(TerritoryManager* manager) {
         location_destroy(manager->locations[i]);
     }
     manager->count = 0;
+    id_map_clear(manager->by_id);
+    manager->version++;
 }
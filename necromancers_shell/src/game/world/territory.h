@@ -3,6 +3,11 @@
  * @brief Territory manager for tracking all game locations
  *
  * Manages collection of locations, discovery, and spatial relationships.
+ *
+ * A version counter changes whenever a location is added, removed or
+ * discovered through the manager, so views such as the world map can
+ * cache what they derive from locations. Code that edits a Location's
+ * fields directly should call territory_manager_mark_changed().
  */
 
 #ifndef NECROMANCER_TERRITORY_H
@@ -73,6 +78,32 @@ bool territory_manager_get_discovered(const TerritoryManager* manager,
                                        Location*** results,
                                        size_t* count);
 
+/**
+ * @brief Discover a location and record the change
+ *
+ * @param manager Territory manager
+ * @param id Location ID
+ * @param timestamp Discovery time
+ * @return true if the location was newly discovered, false otherwise
+ */
+bool territory_manager_discover_location(TerritoryManager* manager, uint32_t id,
+                                          uint64_t timestamp);
+
+/**
+ * @brief Record a direct edit of a location's fields
+ *
+ * @param manager Territory manager
+ */
+void territory_manager_mark_changed(TerritoryManager* manager);
+
+/**
+ * @brief Get the change counter
+ *
+ * @param manager Territory manager
+ * @return Version, different after any recorded change (0 for NULL)
+ */
+uint64_t territory_manager_get_version(const TerritoryManager* manager);
+
 /**
  * @brief Get total number of locations
  *
@@ -5,39 +5,55 @@
 
 #include "territory_status.h"
 #include "../../utils/logger.h"
-#include "../../utils/hash_table.h"
+#include "../../utils/id_map.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
 #define ALERT_DECAY_TIME_HOURS 4    /**< Hours between alert level decays */
 #define REINFORCEMENT_THRESHOLD 75   /**< Alert threshold for reinforcements */
+#define REINFORCEMENT_DELAY 7200     /**< Seconds until reinforcements arrive */
+
+#define INITIAL_CAPACITY 64
 
 /**
  * @brief Territory status manager structure
+ *
+ * Statuses are stored densely in creation order; the ID map only
+ * translates a location ID to its slot, so hourly updates and filters
+ * are straight sweeps over one array.
  */
 struct TerritoryStatusManager {
-    HashTable* statuses;  /**< Key: location_id, Value: TerritoryStatus* */
+    TerritoryStatus* statuses;  /**< Dense status array */
+    size_t count;               /**< Statuses in use */
+    size_t capacity;            /**< Allocated statuses */
+    IdMap* index;               /**< Key: location_id, Value: slot in statuses */
 };
 
 /* Helper functions */
 
 static TerritoryStatus* get_or_create_status(TerritoryStatusManager* manager, uint32_t location_id) {
-    char key[32];
-    snprintf(key, sizeof(key), "%u", location_id);
-
-    TerritoryStatus* status = hash_table_get(manager->statuses, key);
-    if (status) {
-        return status;
+    size_t slot;
+    if (id_map_get_index(manager->index, location_id, &slot)) {
+        return &manager->statuses[slot];
     }
 
     /* Create new status */
-    status = malloc(sizeof(TerritoryStatus));
-    if (!status) {
-        LOG_ERROR("Failed to allocate TerritoryStatus");
-        return NULL;
+    if (manager->count >= manager->capacity) {
+        size_t capacity = manager->capacity * 2;
+        TerritoryStatus* statuses = realloc(manager->statuses,
+                                            sizeof(TerritoryStatus) * capacity);
+        if (!statuses) {
+            LOG_ERROR("Failed to allocate TerritoryStatus");
+            return NULL;
+        }
+        manager->statuses = statuses;
+        manager->capacity = capacity;
     }
 
+    slot = manager->count;
+    TerritoryStatus* status = &manager->statuses[slot];
+
     status->location_id = location_id;
     status->control_percentage = 0;
     status->dominant_faction = FACTION_NEUTRAL;
@@ -51,7 +67,11 @@ static TerritoryStatus* get_or_create_status(TerritoryStatusManager* manager, ui
     status->reinforcements_called = false;
     status->garrison_strength = 50;
 
-    hash_table_put(manager->statuses, key, status);
+    if (!id_map_put_index(manager->index, location_id, slot)) {
+        LOG_ERROR("Failed to index TerritoryStatus for location %u", location_id);
+        return NULL;
+    }
+    manager->count++;
     LOG_DEBUG("Created territory status for location %u", location_id);
     return status;
 }
@@ -102,69 +122,14 @@ static void update_resource_modifier(TerritoryStatus* status) {
     if (status->resource_modifier > 2.0f) status->resource_modifier = 2.0f;
 }
 
-/* Callback for hash_table_foreach */
-
-static void free_status_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    (void)userdata;
-    free(value);
-}
-
-typedef struct {
-    uint32_t* results;
-    size_t count;
-    size_t max_results;
-    AlertLevel filter_alert;
-} AlertFilterContext;
-
-static void filter_by_alert_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    AlertFilterContext* ctx = (AlertFilterContext*)userdata;
-    TerritoryStatus* status = (TerritoryStatus*)value;
-
-    if (status && status->alert_level == ctx->filter_alert && ctx->count < ctx->max_results) {
-        ctx->results[ctx->count++] = status->location_id;
-    }
-}
-
-typedef struct {
-    uint32_t* results;
-    size_t count;
-    size_t max_results;
-    uint64_t current_time;
-} ControlFilterContext;
-
-static void filter_controlled_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    ControlFilterContext* ctx = (ControlFilterContext*)userdata;
-    TerritoryStatus* status = (TerritoryStatus*)value;
-
-    if (status && status->control_percentage > 50 && ctx->count < ctx->max_results) {
-        ctx->results[ctx->count++] = status->location_id;
-    }
-}
-
-typedef struct {
-    uint64_t current_time;
-} UpdateContext;
-
-static void update_status_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    UpdateContext* ctx = (UpdateContext*)userdata;
-    TerritoryStatus* status = (TerritoryStatus*)value;
-
-    if (!status) return;
-
+/* Returns true if reinforcements arrived; logs nothing (may run on a worker) */
+static bool update_status(TerritoryStatus* status, uint64_t current_time) {
     /* Decay alert if enough time has passed */
     if (status->alert_level > ALERT_NONE &&
-        ctx->current_time >= status->alert_decay_time) {
+        current_time >= status->alert_decay_time) {
 
         status->alert_level--;
-        status->alert_decay_time = ctx->current_time + (ALERT_DECAY_TIME_HOURS * 3600);
-
-        LOG_DEBUG("Alert decayed to %s for location %u",
-                  territory_status_alert_name(status->alert_level),
-                  status->location_id);
+        status->alert_decay_time = current_time + (ALERT_DECAY_TIME_HOURS * 3600);
     }
 
     /* Update modifiers */
@@ -174,13 +139,14 @@ static void update_status_callback(const char* key, void* value, void* userdata)
 
     /* Check if reinforcements arrive */
     if (status->reinforcements_called) {
-        uint64_t time_since_call = ctx->current_time - status->last_activity_time;
-        if (time_since_call >= 7200) {  /* 2 hours */
+        uint64_t time_since_call = current_time - status->last_activity_time;
+        if (time_since_call >= REINFORCEMENT_DELAY) {
             status->garrison_strength += 50;
             status->reinforcements_called = false;
-            LOG_INFO("Reinforcements arrived at location %u", status->location_id);
+            return true;
         }
     }
+    return false;
 }
 
 /* Public API */
@@ -192,12 +158,17 @@ TerritoryStatusManager* territory_status_create(void) {
         return NULL;
     }
 
-    manager->statuses = hash_table_create(100);
-    if (!manager->statuses) {
+    manager->statuses = malloc(sizeof(TerritoryStatus) * INITIAL_CAPACITY);
+    manager->index = id_map_create(INITIAL_CAPACITY);
+    if (!manager->statuses || !manager->index) {
+        free(manager->statuses);
+        id_map_destroy(manager->index);
         free(manager);
-        LOG_ERROR("Failed to create hash table for territory statuses");
+        LOG_ERROR("Failed to create storage for territory statuses");
         return NULL;
     }
+    manager->count = 0;
+    manager->capacity = INITIAL_CAPACITY;
 
     LOG_DEBUG("Created territory status manager");
     return manager;
@@ -206,10 +177,8 @@ TerritoryStatusManager* territory_status_create(void) {
 void territory_status_destroy(TerritoryStatusManager* manager) {
     if (!manager) return;
 
-    if (manager->statuses) {
-        hash_table_foreach(manager->statuses, free_status_callback, NULL);
-        hash_table_destroy(manager->statuses);
-    }
+    free(manager->statuses);
+    id_map_destroy(manager->index);
 
     free(manager);
     LOG_DEBUG("Destroyed territory status manager");
@@ -294,11 +263,34 @@ AlertLevel territory_status_decay_alert(TerritoryStatusManager* manager,
     return status->alert_level;
 }
 
-void territory_status_update_all(TerritoryStatusManager* manager, uint64_t current_time) {
-    if (!manager) return;
+size_t territory_status_update_all(TerritoryStatusManager* manager, uint64_t current_time) {
+    if (!manager) return 0;
+
+    size_t arrived = 0;
+    for (size_t i = 0; i < manager->count; i++) {
+        if (update_status(&manager->statuses[i], current_time)) {
+            arrived++;
+        }
+    }
+    return arrived;
+}
 
-    UpdateContext ctx = { .current_time = current_time };
-    hash_table_foreach(manager->statuses, update_status_callback, &ctx);
+uint64_t territory_status_next_change(const TerritoryStatusManager* manager) {
+    uint64_t next = UINT64_MAX;
+    if (!manager) return next;
+
+    for (size_t i = 0; i < manager->count; i++) {
+        const TerritoryStatus* status = &manager->statuses[i];
+        if (status->alert_level > ALERT_NONE && status->alert_decay_time < next) {
+            next = status->alert_decay_time;
+        }
+        if (status->reinforcements_called) {
+            uint64_t arrival = status->last_activity_time + REINFORCEMENT_DELAY;
+            if (arrival < next) next = arrival;
+        }
+    }
+
+    return next;
 }
 
 float territory_status_resource_modifier(const TerritoryStatus* status) {
@@ -374,15 +366,13 @@ size_t territory_status_get_by_alert(const TerritoryStatusManager* manager,
                                       size_t max_results) {
     if (!manager || !results) return 0;
 
-    AlertFilterContext ctx = {
-        .results = results,
-        .count = 0,
-        .max_results = max_results,
-        .filter_alert = alert_level
-    };
-
-    hash_table_foreach(manager->statuses, filter_by_alert_callback, &ctx);
-    return ctx.count;
+    size_t count = 0;
+    for (size_t i = 0; i < manager->count && count < max_results; i++) {
+        if (manager->statuses[i].alert_level == alert_level) {
+            results[count++] = manager->statuses[i].location_id;
+        }
+    }
+    return count;
 }
 
 size_t territory_status_get_controlled(const TerritoryStatusManager* manager,
@@ -390,13 +380,11 @@ size_t territory_status_get_controlled(const TerritoryStatusManager* manager,
                                         size_t max_results) {
     if (!manager || !results) return 0;
 
-    ControlFilterContext ctx = {
-        .results = results,
-        .count = 0,
-        .max_results = max_results,
-        .current_time = 0
-    };
-
-    hash_table_foreach(manager->statuses, filter_controlled_callback, &ctx);
-    return ctx.count;
+    size_t count = 0;
+    for (size_t i = 0; i < manager->count && count < max_results; i++) {
+        if (manager->statuses[i].control_percentage > 50) {
+            results[count++] = manager->statuses[i].location_id;
+        }
+    }
+    return count;
 }
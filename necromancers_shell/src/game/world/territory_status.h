@@ -94,6 +94,9 @@ void territory_status_destroy(TerritoryStatusManager* manager);
 /**
  * @brief Get or create status for a location
  *
+ * Statuses live in one contiguous array, so the returned pointer stays
+ * valid only until a status is created for another location.
+ *
  * @param manager Territory status manager
  * @param location_id Location ID
  * @return Status structure, or NULL on failure
@@ -141,12 +144,24 @@ AlertLevel territory_status_decay_alert(TerritoryStatusManager* manager,
 /**
  * @brief Update all territory statuses based on game time
  *
- * Decays alerts, updates stability, checks for reinforcements
+ * Decays alerts, updates stability, checks for reinforcements. Logs
+ * nothing, so the time kernel can run it on a worker thread.
  *
  * @param manager Territory status manager
  * @param current_time Current game time
+ * @return Number of locations whose reinforcements arrived
+ */
+size_t territory_status_update_all(TerritoryStatusManager* manager, uint64_t current_time);
+
+/**
+ * @brief Get the next time territory_status_update_all() would change anything
+ *
+ * That is the earliest pending alert decay or reinforcement arrival.
+ *
+ * @param manager Territory status manager
+ * @return Time of the next change (same units as update), or UINT64_MAX if none
  */
-void territory_status_update_all(TerritoryStatusManager* manager, uint64_t current_time);
+uint64_t territory_status_next_change(const TerritoryStatusManager* manager);
 
 /**
  * @brief Calculate resource generation modifier
@@ -5,73 +5,138 @@
 
 #include "world_map.h"
 #include "../../utils/logger.h"
-#include "../../utils/hash_table.h"
+#include "../../utils/id_map.h"
+#include "force_layout.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+#include <stdatomic.h>
+#include <pthread.h>
 
 #define MAX_MAP_WIDTH 120
 #define MAX_MAP_HEIGHT 40
 
+/* Full layouts are scaled to fit within +/- this on both axes */
+#define WORLD_MAP_COORD_LIMIT 1000.0f
+
+/* Side of a spatial grid cell in world units */
+#define WORLD_MAP_CELL_SIZE 32
+
+typedef struct LayoutJob LayoutJob;
+
 /**
- * @brief World map structure
+ * @brief Projection of a world-space box onto a character grid
  */
-struct WorldMap {
-    TerritoryManager* territory;    /**< Territory manager (not owned) */
-    LocationGraph* graph;           /**< Location graph (not owned) */
-    HashTable* location_data;       /**< Key: location_id, Value: LocationMapData* */
-};
-
-/* Helper structures for iteration callbacks */
+typedef struct {
+    uint16_t width;                 /**< Grid columns, border included */
+    uint16_t height;                /**< Grid rows, border included */
+    int16_t min_x;                  /**< Padded world box */
+    int16_t max_x;
+    int16_t min_y;
+    int16_t max_y;
+    int16_t world_width;            /**< Box size, never 0 */
+    int16_t world_height;
+} MapView;
 
+/**
+ * @brief Cached static layer of the last render
+ *
+ * Border, location symbols and connection dots for one view. Markers for
+ * the player and the highlight are stamped over a copy, so the layer
+ * survives everything except changes to the locations themselves.
+ */
 typedef struct {
-    uint32_t* results;
-    size_t count;
-    size_t max_results;
-    MapRegion filter_region;
-} RegionFilterContext;
+    char* cells;                    /**< view.height rows of view.width chars */
+    size_t capacity;                /**< Allocated bytes in cells */
+    MapView view;                   /**< View the layer was drawn for */
+    bool show_undiscovered;
+    bool show_connections;
+    uint64_t map_version;           /**< Versions the layer was drawn at */
+    uint64_t territory_version;
+    uint64_t graph_version;
+    bool valid;                     /**< Layer has been drawn at least once */
+} MapLayer;
 
+/**
+ * @brief Growable list of location entries (slots in WorldMap.entries)
+ */
 typedef struct {
-    uint32_t* results;
+    uint32_t* slots;
     size_t count;
-    size_t max_results;
-    MapCoordinates center_coords;
-    uint16_t radius;
-    uint32_t center_id;
-} RadiusFilterContext;
+    size_t capacity;
+} MapEntryList;
 
+/**
+ * @brief Occupied cell of the spatial grid
+ */
 typedef struct {
-    int16_t min_x;
-    int16_t max_x;
-    int16_t min_y;
-    int16_t max_y;
-    bool first;
-} BoundsContext;
+    int16_t cx;                     /**< Cell column (x / WORLD_MAP_CELL_SIZE) */
+    int16_t cy;                     /**< Cell row */
+    MapEntryList list;              /**< Locations inside the cell */
+} SpatialCell;
 
-typedef struct {
-    char** grid;
+/**
+ * @brief World map structure
+ *
+ * Entries live in one dense array in creation order; the ID map only
+ * translates a location ID to its slot. Every entry is also filed in a uniform grid of
+ * WORLD_MAP_CELL_SIZE cells (only occupied cells exist) and in a list
+ * for its region, so radius, region and viewport queries touch only
+ * nearby or matching locations. The bounding box is cached and only
+ * recomputed after a location on its edge moves.
+ */
+struct WorldMap {
+    TerritoryManager* territory;    /**< Territory manager (not owned) */
+    LocationGraph* graph;           /**< Location graph (not owned) */
+    LocationMapData* entries;       /**< Dense entry array */
+    size_t entry_count;             /**< Entries in use */
+    size_t entry_capacity;          /**< Allocated entries */
+    IdMap* entry_index;             /**< Key: location_id, Value: slot in entries */
+    IdMap* grid_cells;              /**< Key: packed cell coords, Value: SpatialCell* */
+    MapEntryList regions[MAP_REGION_COUNT]; /**< Locations per region */
+    MapCoordinates bounds_min;      /**< Cached bounding box */
+    MapCoordinates bounds_max;
+    bool bounds_dirty;              /**< Bounds need a rescan */
+    uint64_t version;               /**< Bumped whenever an entry changes */
+    uint64_t territory_version;     /**< Territory version discovery flags match */
+    MapLayer layer;                 /**< Static layer of the last render */
+    LayoutJob* layout_job;          /**< Background layout, NULL if none */
+    pthread_t layout_thread;        /**< Worker running layout_job */
+};
+
+/**
+ * @brief Frame kept by a frontend between renders
+ */
+struct MapFrame {
+    char* cells;                    /**< Rows of width chars plus a NUL */
+    char* next;                     /**< Frame being composed */
+    size_t capacity;                /**< Allocated bytes in each buffer */
     uint16_t width;
     uint16_t height;
-    int16_t min_x;
-    int16_t max_x;
-    int16_t min_y;
-    int16_t max_y;
-    int16_t world_width;
-    int16_t world_height;
-    uint32_t current_location_id;
-    uint32_t highlight_location_id;
+};
+
+typedef struct RenderContext {
+    char* cells;
+    MapView view;
     bool show_undiscovered;
     const WorldMap* map;
-    const MapRenderOptions* opts;
+    void (*pass)(const LocationMapData* data, struct RenderContext* ctx);
 } RenderContext;
 
+/**
+ * @brief Player and highlight symbols drawn over the static layer
+ */
+typedef struct {
+    int16_t x;
+    int16_t y;
+    char symbol;
+} MapMarker;
+
 /* Helper functions */
 
+static bool finish_layout(WorldMap* map, bool apply);
+
 static char get_default_symbol(LocationType type) {
     switch (type) {
         case LOCATION_TYPE_GRAVEYARD:    return 'G';
@@ -83,136 +148,289 @@ static char get_default_symbol(LocationType type) {
     }
 }
 
-static LocationMapData* get_or_create_map_data(WorldMap* map, uint32_t location_id) {
-    char key[32];
-    snprintf(key, sizeof(key), "%u", location_id);
+/* Spatial index */
 
-    LocationMapData* data = hash_table_get(map->location_data, key);
-    if (data) {
-        return data;
-    }
+static int16_t floor_div(int32_t value, int32_t divisor) {
+    int32_t q = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) q--;
+    return (int16_t)q;
+}
 
-    /* Create new map data */
-    data = malloc(sizeof(LocationMapData));
-    if (!data) return NULL;
+static uint32_t cell_key(int16_t cx, int16_t cy) {
+    return ((uint32_t)(uint16_t)cx << 16) | (uint16_t)cy;
+}
 
-    data->location_id = location_id;
-    data->coords.x = 0;
-    data->coords.y = 0;
-    data->region = MAP_REGION_STARTING_GROUNDS;
-    data->discovered = false;
+static bool entry_list_add(MapEntryList* list, uint32_t slot) {
+    if (list->count >= list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 4;
+        uint32_t* slots = realloc(list->slots, sizeof(uint32_t) * capacity);
+        if (!slots) return false;
+        list->slots = slots;
+        list->capacity = capacity;
+    }
+    list->slots[list->count++] = slot;
+    return true;
+}
 
-    /* Get location to determine symbol */
-    Location* loc = territory_manager_get_location(map->territory, location_id);
-    if (loc) {
-        data->symbol = get_default_symbol(loc->type);
-        data->discovered = (loc->status == LOCATION_STATUS_DISCOVERED);
-    } else {
-        data->symbol = '?';
+static void entry_list_remove(MapEntryList* list, uint32_t slot) {
+    for (size_t i = 0; i < list->count; i++) {
+        if (list->slots[i] == slot) {
+            list->slots[i] = list->slots[--list->count];
+            return;
+        }
     }
+}
 
-    hash_table_put(map->location_data, key, data);
-    return data;
+static LocationMapData* find_map_data(const WorldMap* map, uint32_t location_id) {
+    size_t slot;
+    if (!id_map_get_index(map->entry_index, location_id, &slot)) return NULL;
+    return &map->entries[slot];
 }
 
-/* Callback functions for hash_table_foreach */
+static bool grid_insert(WorldMap* map, uint32_t slot) {
+    const LocationMapData* data = &map->entries[slot];
+    int16_t cx = floor_div(data->coords.x, WORLD_MAP_CELL_SIZE);
+    int16_t cy = floor_div(data->coords.y, WORLD_MAP_CELL_SIZE);
+    uint32_t key = cell_key(cx, cy);
+
+    SpatialCell* cell = id_map_get(map->grid_cells, key);
+    if (!cell) {
+        cell = calloc(1, sizeof(SpatialCell));
+        if (!cell) return false;
+        cell->cx = cx;
+        cell->cy = cy;
+        if (!id_map_put(map->grid_cells, key, cell)) {
+            free(cell);
+            return false;
+        }
+    }
+    return entry_list_add(&cell->list, slot);
+}
 
-static void free_location_data_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    (void)userdata;
-    free(value);
+static void grid_remove(WorldMap* map, uint32_t slot) {
+    const LocationMapData* data = &map->entries[slot];
+    uint32_t key = cell_key(floor_div(data->coords.x, WORLD_MAP_CELL_SIZE),
+                            floor_div(data->coords.y, WORLD_MAP_CELL_SIZE));
+    SpatialCell* cell = id_map_get(map->grid_cells, key);
+    if (!cell) return;
+
+    entry_list_remove(&cell->list, slot);
+    if (cell->list.count == 0) {
+        id_map_remove(map->grid_cells, key);
+        free(cell->list.slots);
+        free(cell);
+    }
 }
 
-static void filter_by_region_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    RegionFilterContext* ctx = (RegionFilterContext*)userdata;
-    LocationMapData* data = (LocationMapData*)value;
+/* Grow the cached bounds to cover a point */
+static void bounds_grow(WorldMap* map, MapCoordinates coords) {
+    if (coords.x < map->bounds_min.x) map->bounds_min.x = coords.x;
+    if (coords.x > map->bounds_max.x) map->bounds_max.x = coords.x;
+    if (coords.y < map->bounds_min.y) map->bounds_min.y = coords.y;
+    if (coords.y > map->bounds_max.y) map->bounds_max.y = coords.y;
+}
+
+typedef void (*CellVisitor)(const SpatialCell* cell, void* userdata);
+
+typedef struct {
+    int16_t cx0, cy0, cx1, cy1;
+    CellVisitor visit;
+    void* userdata;
+} CellRangeContext;
 
-    if (data && data->region == ctx->filter_region && ctx->count < ctx->max_results) {
-        ctx->results[ctx->count++] = data->location_id;
+static void visit_cell_in_range(uint32_t key, void* value, void* userdata) {
+    (void)key;
+    const SpatialCell* cell = value;
+    CellRangeContext* ctx = userdata;
+    if (cell->cx >= ctx->cx0 && cell->cx <= ctx->cx1 &&
+        cell->cy >= ctx->cy0 && cell->cy <= ctx->cy1) {
+        ctx->visit(cell, ctx->userdata);
     }
 }
 
-static void filter_by_radius_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    RadiusFilterContext* ctx = (RadiusFilterContext*)userdata;
-    LocationMapData* data = (LocationMapData*)value;
+/**
+ * @brief Visit every occupied cell overlapping a world-space box
+ *
+ * Probes the box cell by cell, unless the box spans more cells than are
+ * occupied, in which case it scans the occupied cells instead.
+ */
+static void grid_visit_box(const WorldMap* map, int32_t x0, int32_t y0,
+                           int32_t x1, int32_t y1, CellVisitor visit, void* userdata) {
+    CellRangeContext ctx = {
+        .cx0 = floor_div(x0, WORLD_MAP_CELL_SIZE),
+        .cy0 = floor_div(y0, WORLD_MAP_CELL_SIZE),
+        .cx1 = floor_div(x1, WORLD_MAP_CELL_SIZE),
+        .cy1 = floor_div(y1, WORLD_MAP_CELL_SIZE),
+        .visit = visit,
+        .userdata = userdata
+    };
 
-    if (!data || data->location_id == ctx->center_id || ctx->count >= ctx->max_results) {
+    uint64_t span = (uint64_t)(ctx.cx1 - ctx.cx0 + 1) * (uint64_t)(ctx.cy1 - ctx.cy0 + 1);
+    if (span > id_map_size(map->grid_cells)) {
+        id_map_foreach(map->grid_cells, visit_cell_in_range, &ctx);
         return;
     }
 
-    /* Manhattan distance */
-    int16_t dx = abs(data->coords.x - ctx->center_coords.x);
-    int16_t dy = abs(data->coords.y - ctx->center_coords.y);
-    uint16_t distance = dx + dy;
+    for (int32_t cy = ctx.cy0; cy <= ctx.cy1; cy++) {
+        for (int32_t cx = ctx.cx0; cx <= ctx.cx1; cx++) {
+            const SpatialCell* cell = id_map_get(map->grid_cells,
+                                                 cell_key((int16_t)cx, (int16_t)cy));
+            if (cell) visit(cell, userdata);
+        }
+    }
+}
+
+/* Recompute stale bounds with one sweep over the entries */
+static void bounds_refresh(WorldMap* map) {
+    if (!map->bounds_dirty) return;
 
-    if (distance <= ctx->radius) {
-        ctx->results[ctx->count++] = data->location_id;
+    map->bounds_min.x = map->bounds_min.y = INT16_MAX;
+    map->bounds_max.x = map->bounds_max.y = INT16_MIN;
+    for (size_t i = 0; i < map->entry_count; i++) {
+        bounds_grow(map, map->entries[i].coords);
     }
+    map->bounds_dirty = false;
 }
 
-static void calculate_bounds_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    BoundsContext* ctx = (BoundsContext*)userdata;
-    LocationMapData* data = (LocationMapData*)value;
+/* Track a new or moved entry in the bounds (moved: old position given) */
+static void bounds_update(WorldMap* map, const MapCoordinates* old_coords,
+                          MapCoordinates coords) {
+    if (map->bounds_dirty) return;
 
-    if (!data) return;
+    /* Moving off an edge may shrink the box: recompute on next read */
+    if (old_coords && (old_coords->x == map->bounds_min.x || old_coords->x == map->bounds_max.x ||
+                       old_coords->y == map->bounds_min.y || old_coords->y == map->bounds_max.y)) {
+        map->bounds_dirty = true;
+        return;
+    }
 
-    if (ctx->first) {
-        ctx->min_x = ctx->max_x = data->coords.x;
-        ctx->min_y = ctx->max_y = data->coords.y;
-        ctx->first = false;
+    if (map->entry_count == 1) {
+        map->bounds_min = map->bounds_max = coords;
     } else {
-        if (data->coords.x < ctx->min_x) ctx->min_x = data->coords.x;
-        if (data->coords.x > ctx->max_x) ctx->max_x = data->coords.x;
-        if (data->coords.y < ctx->min_y) ctx->min_y = data->coords.y;
-        if (data->coords.y > ctx->max_y) ctx->max_y = data->coords.y;
+        bounds_grow(map, coords);
     }
 }
 
-static void plot_location_callback(const char* key, void* value, void* userdata) {
+static void free_cell_callback(uint32_t key, void* value, void* userdata) {
     (void)key;
-    RenderContext* ctx = (RenderContext*)userdata;
-    LocationMapData* data = (LocationMapData*)value;
+    (void)userdata;
+    SpatialCell* cell = value;
+    free(cell->list.slots);
+    free(cell);
+}
 
-    if (!data) return;
+static bool location_is_discovered(const Location* loc) {
+    return loc && loc->status == LOCATION_STATUS_DISCOVERED;
+}
 
-    /* Skip undiscovered if option disabled */
-    if (!ctx->show_undiscovered && !data->discovered) return;
+/**
+ * @brief Find or add the entry for a location
+ *
+ * @return The entry, valid until the next entry is added, or NULL on failure
+ */
+static LocationMapData* get_or_create_map_data(WorldMap* map, uint32_t location_id) {
+    LocationMapData* data = find_map_data(map, location_id);
+    if (data) {
+        return data;
+    }
 
-    /* Transform world coordinates to map coordinates */
-    int16_t map_x = ((data->coords.x - ctx->min_x) * (ctx->width - 3)) / ctx->world_width + 1;
-    int16_t map_y = ((data->coords.y - ctx->min_y) * (ctx->height - 3)) / ctx->world_height + 1;
+    /* Create new map data */
+    if (map->entry_count >= map->entry_capacity) {
+        size_t capacity = map->entry_capacity * 2;
+        LocationMapData* entries = realloc(map->entries, sizeof(LocationMapData) * capacity);
+        if (!entries) return NULL;
+        map->entries = entries;
+        map->entry_capacity = capacity;
+    }
 
-    /* Clamp to valid range */
-    if (map_x < 1) { map_x = 1; }
-    if (map_x >= (int16_t)(ctx->width - 1)) { map_x = ctx->width - 2; }
-    if (map_y < 1) { map_y = 1; }
-    if (map_y >= (int16_t)(ctx->height - 1)) { map_y = ctx->height - 2; }
+    uint32_t slot = (uint32_t)map->entry_count;
+    data = &map->entries[slot];
+    data->location_id = location_id;
+    data->coords.x = 0;
+    data->coords.y = 0;
+    data->placed = false;
+    data->region = MAP_REGION_STARTING_GROUNDS;
+    data->discovered = false;
 
-    /* Determine symbol */
-    char symbol = data->symbol;
-    if (!data->discovered && ctx->show_undiscovered) {
-        symbol = '?';
+    /* Get location to determine symbol */
+    Location* loc = territory_manager_get_location(map->territory, location_id);
+    if (loc) {
+        data->symbol = get_default_symbol(loc->type);
+        data->discovered = location_is_discovered(loc);
+    } else {
+        data->symbol = '?';
     }
-    if (data->location_id == ctx->current_location_id) {
-        symbol = '@';
+
+    if (!id_map_put_index(map->entry_index, location_id, slot)) {
+        return NULL;
+    }
+
+    if (!entry_list_add(&map->regions[data->region], slot)) {
+        id_map_remove(map->entry_index, location_id);
+        return NULL;
     }
-    if (data->location_id == ctx->highlight_location_id) {
-        symbol = '*';
+    if (!grid_insert(map, slot)) {
+        entry_list_remove(&map->regions[data->region], slot);
+        id_map_remove(map->entry_index, location_id);
+        return NULL;
     }
+    map->entry_count++;
+    bounds_update(map, NULL, data->coords);
+    map->version++;
+    return data;
+}
+
+static bool set_coordinates(WorldMap* map, uint32_t location_id, int16_t x, int16_t y) {
+    LocationMapData* data = get_or_create_map_data(map, location_id);
+    if (!data) return false;
+
+    if (data->coords.x != x || data->coords.y != y) {
+        uint32_t slot = (uint32_t)(data - map->entries);
+        MapCoordinates old_coords = data->coords;
+        grid_remove(map, slot);
+        data->coords.x = x;
+        data->coords.y = y;
+        if (!grid_insert(map, slot)) {
+            LOG_ERROR("world_map: Failed to index location %u", location_id);
+            return false;
+        }
+        bounds_update(map, &old_coords, data->coords);
+        map->version++;
+    }
+    data->placed = true;
 
-    ctx->grid[map_y][map_x] = symbol;
+    /* Feed the A* heuristic; locations outside the graph have no paths */
+    location_graph_set_position(map->graph, location_id, x, y);
+    return true;
 }
 
-static void draw_connections_callback(const char* key, void* value, void* userdata) {
-    (void)key;
-    RenderContext* ctx = (RenderContext*)userdata;
-    LocationMapData* data = (LocationMapData*)value;
+/* World coordinates to a grid position inside the border */
+static void project(const MapView* view, MapCoordinates coords, int16_t* x, int16_t* y) {
+    int16_t map_x = ((coords.x - view->min_x) * (view->width - 3)) / view->world_width + 1;
+    int16_t map_y = ((coords.y - view->min_y) * (view->height - 3)) / view->world_height + 1;
 
-    if (!data) return;
+    /* Clamp to valid range */
+    if (map_x < 1) { map_x = 1; }
+    if (map_x >= (int16_t)(view->width - 1)) { map_x = view->width - 2; }
+    if (map_y < 1) { map_y = 1; }
+    if (map_y >= (int16_t)(view->height - 1)) { map_y = view->height - 2; }
 
+    *x = map_x;
+    *y = map_y;
+}
+
+static void plot_location(const LocationMapData* data, RenderContext* ctx) {
+    /* Skip undiscovered if option disabled */
+    if (!ctx->show_undiscovered && !data->discovered) return;
+
+    int16_t map_x, map_y;
+    project(&ctx->view, data->coords, &map_x, &map_y);
+
+    /* Markers are not part of the static layer */
+    ctx->cells[map_y * ctx->view.width + map_x] = data->discovered ? data->symbol : '?';
+}
+
+static void draw_connections(const LocationMapData* data, RenderContext* ctx) {
     /* Get neighbors */
     uint32_t neighbors[20];
     size_t neighbor_count = location_graph_get_neighbors(ctx->map->graph,
@@ -225,21 +443,9 @@ static void draw_connections_callback(const char* key, void* value, void* userda
             continue;
         }
 
-        /* Transform coordinates */
-        int16_t x1 = ((data->coords.x - ctx->min_x) * (ctx->width - 3)) / ctx->world_width + 1;
-        int16_t y1 = ((data->coords.y - ctx->min_y) * (ctx->height - 3)) / ctx->world_height + 1;
-        int16_t x2 = ((neighbor_coords.x - ctx->min_x) * (ctx->width - 3)) / ctx->world_width + 1;
-        int16_t y2 = ((neighbor_coords.y - ctx->min_y) * (ctx->height - 3)) / ctx->world_height + 1;
-
-        /* Clamp */
-        if (x1 < 1) { x1 = 1; }
-        if (x1 >= (int16_t)(ctx->width - 1)) { x1 = ctx->width - 2; }
-        if (y1 < 1) { y1 = 1; }
-        if (y1 >= (int16_t)(ctx->height - 1)) { y1 = ctx->height - 2; }
-        if (x2 < 1) { x2 = 1; }
-        if (x2 >= (int16_t)(ctx->width - 1)) { x2 = ctx->width - 2; }
-        if (y2 < 1) { y2 = 1; }
-        if (y2 >= (int16_t)(ctx->height - 1)) { y2 = ctx->height - 2; }
+        int16_t x1, y1, x2, y2;
+        project(&ctx->view, data->coords, &x1, &y1);
+        project(&ctx->view, neighbor_coords, &x2, &y2);
 
         /* Draw simple line (only if not too far) */
         int16_t dx = abs(x2 - x1);
@@ -248,13 +454,274 @@ static void draw_connections_callback(const char* key, void* value, void* userda
             /* Draw midpoint dot */
             int16_t mx = (x1 + x2) / 2;
             int16_t my = (y1 + y2) / 2;
-            if (ctx->grid[my][mx] == ' ') {
-                ctx->grid[my][mx] = '.';
+            char* cell = &ctx->cells[my * ctx->view.width + mx];
+            if (*cell == ' ') {
+                *cell = '.';
             }
         }
     }
 }
 
+/* Clamp a viewport edge so padding cannot overflow int16 */
+static int16_t clamp_view(int32_t value) {
+    if (value < INT16_MIN + 2) return INT16_MIN + 2;
+    if (value > INT16_MAX - 2) return INT16_MAX - 2;
+    return (int16_t)value;
+}
+
+/* Run the current render pass over a cell's locations inside the box */
+static void render_cell(const SpatialCell* cell, void* userdata) {
+    RenderContext* ctx = userdata;
+    for (size_t i = 0; i < cell->list.count; i++) {
+        const LocationMapData* data = &ctx->map->entries[cell->list.slots[i]];
+        if (data->coords.x < ctx->view.min_x || data->coords.x > ctx->view.max_x ||
+            data->coords.y < ctx->view.min_y || data->coords.y > ctx->view.max_y) {
+            continue;
+        }
+        ctx->pass(data, ctx);
+    }
+}
+
+/* Bring discovery flags up to date with the territory */
+static void sync_discovery(WorldMap* map) {
+    uint64_t version = territory_manager_get_version(map->territory);
+    if (map->territory_version == version) return;
+
+    for (size_t i = 0; i < map->entry_count; i++) {
+        LocationMapData* data = &map->entries[i];
+        data->discovered = location_is_discovered(
+            territory_manager_get_location(map->territory, data->location_id));
+    }
+    map->territory_version = version;
+}
+
+static void clamp_options(MapRenderOptions* opts) {
+    if (opts->width > MAX_MAP_WIDTH) opts->width = MAX_MAP_WIDTH;
+    if (opts->height > MAX_MAP_HEIGHT) opts->height = MAX_MAP_HEIGHT;
+    /* Room for the border and one row/column inside it */
+    if (opts->width < 3) opts->width = 3;
+    if (opts->height < 3) opts->height = 3;
+}
+
+/**
+ * @brief Work out the world box and scale for a render
+ *
+ * @return false if the map has no locations (the view is still usable)
+ */
+static bool compute_view(const WorldMap* map, uint32_t current_location_id,
+                         const MapRenderOptions* opts, MapView* view) {
+    int16_t min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+    bool has_locations = world_map_get_bounds(map, &min_x, &max_x, &min_y, &max_y);
+
+    /* A viewport replaces the whole-world box with a window on the player */
+    MapCoordinates center;
+    if (opts->view_radius > 0 && world_map_get_coordinates(map, current_location_id, &center)) {
+        /* Keep the padded window's width within int16 */
+        int32_t radius = opts->view_radius < 8192 ? opts->view_radius : 8192;
+        min_x = clamp_view(center.x - radius);
+        max_x = clamp_view(center.x + radius);
+        min_y = clamp_view(center.y - radius);
+        max_y = clamp_view(center.y + radius);
+    }
+
+    /* Add padding */
+    min_x -= 2; max_x += 2;
+    min_y -= 2; max_y += 2;
+
+    view->width = opts->width;
+    view->height = opts->height;
+    view->min_x = min_x;
+    view->max_x = max_x;
+    view->min_y = min_y;
+    view->max_y = max_y;
+    view->world_width = max_x - min_x;
+    view->world_height = max_y - min_y;
+    if (view->world_width == 0) view->world_width = 1;
+    if (view->world_height == 0) view->world_height = 1;
+
+    return has_locations;
+}
+
+static bool views_equal(const MapView* a, const MapView* b) {
+    return a->width == b->width && a->height == b->height &&
+           a->min_x == b->min_x && a->max_x == b->max_x &&
+           a->min_y == b->min_y && a->max_y == b->max_y;
+}
+
+/**
+ * @brief Get the static layer for a view, redrawing it only if stale
+ *
+ * The layer is keyed on the view, the options that shape it and the
+ * version counters of the map, its territory and its graph, so renders
+ * of an unchanged world only copy it.
+ *
+ * @return The layer, or NULL on allocation failure
+ */
+static const MapLayer* layer_refresh(WorldMap* map, const MapView* view,
+                                     const MapRenderOptions* opts) {
+    sync_discovery(map);
+
+    MapLayer* layer = &map->layer;
+    uint64_t graph_version = location_graph_get_version(map->graph);
+    if (layer->valid && views_equal(&layer->view, view) &&
+        layer->show_undiscovered == opts->show_undiscovered &&
+        layer->show_connections == opts->show_connections &&
+        layer->map_version == map->version &&
+        layer->territory_version == map->territory_version &&
+        layer->graph_version == graph_version) {
+        return layer;
+    }
+
+    size_t size = (size_t)view->width * view->height;
+    if (size > layer->capacity) {
+        char* cells = realloc(layer->cells, size);
+        if (!cells) {
+            LOG_ERROR("world_map: Failed to allocate map layer");
+            return NULL;
+        }
+        layer->cells = cells;
+        layer->capacity = size;
+    }
+
+    /* Draw border */
+    char* cells = layer->cells;
+    uint16_t width = view->width;
+    uint16_t height = view->height;
+    memset(cells, ' ', size);
+    memset(cells, '-', width);
+    memset(cells + (size_t)(height - 1) * width, '-', width);
+    for (uint16_t y = 0; y < height; y++) {
+        cells[(size_t)y * width] = '|';
+        cells[(size_t)y * width + width - 1] = '|';
+    }
+    cells[0] = '+';
+    cells[width - 1] = '+';
+    cells[(size_t)(height - 1) * width] = '+';
+    cells[size - 1] = '+';
+
+    RenderContext ctx = {
+        .cells = cells,
+        .view = *view,
+        .show_undiscovered = opts->show_undiscovered,
+        .map = map
+    };
+
+    /* Only cells overlapping the box are visited; the rest is culled */
+    ctx.pass = plot_location;
+    grid_visit_box(map, view->min_x, view->min_y, view->max_x, view->max_y, render_cell, &ctx);
+
+    if (opts->show_connections) {
+        ctx.pass = draw_connections;
+        grid_visit_box(map, view->min_x, view->min_y, view->max_x, view->max_y,
+                       render_cell, &ctx);
+    }
+
+    layer->view = *view;
+    layer->show_undiscovered = opts->show_undiscovered;
+    layer->show_connections = opts->show_connections;
+    layer->map_version = map->version;
+    layer->territory_version = map->territory_version;
+    layer->graph_version = graph_version;
+    layer->valid = true;
+    return layer;
+}
+
+/* Grid position of a location's marker, if it is drawn in this view */
+static bool marker_position(const WorldMap* map, const MapView* view,
+                            const MapRenderOptions* opts, uint32_t location_id,
+                            MapMarker* marker) {
+    const LocationMapData* data = find_map_data(map, location_id);
+    if (!data) return false;
+    if (!opts->show_undiscovered && !data->discovered) return false;
+    if (data->coords.x < view->min_x || data->coords.x > view->max_x ||
+        data->coords.y < view->min_y || data->coords.y > view->max_y) {
+        return false;
+    }
+
+    project(view, data->coords, &marker->x, &marker->y);
+    return true;
+}
+
+/* Markers to stamp over the layer, later ones on top */
+static size_t collect_markers(const WorldMap* map, const MapView* view,
+                              uint32_t current_location_id,
+                              const MapRenderOptions* opts, MapMarker markers[2]) {
+    size_t count = 0;
+    if (marker_position(map, view, opts, current_location_id, &markers[count])) {
+        markers[count++].symbol = '@';
+    }
+    if (opts->highlight_location_id != 0 &&
+        marker_position(map, view, opts, opts->highlight_location_id, &markers[count])) {
+        markers[count++].symbol = '*';
+    }
+    return count;
+}
+
+/* Copy one layer row into out[0..len) with the markers on that row */
+static void compose_row(const MapLayer* layer, uint16_t y, const MapMarker* markers,
+                        size_t marker_count, char* out, size_t len) {
+    memcpy(out, layer->cells + (size_t)y * layer->view.width, len);
+    for (size_t i = 0; i < marker_count; i++) {
+        if (markers[i].y == y && (size_t)markers[i].x < len) {
+            out[markers[i].x] = markers[i].symbol;
+        }
+    }
+}
+
+/**
+ * @brief Describe the cells that differ between two frames
+ *
+ * Each changed row contributes the span between its first and last changed
+ * columns; equal spans on consecutive rows merge into one rectangle. If
+ * more than max_rects rectangles would be needed, a single one covering
+ * every change is reported instead.
+ */
+static size_t diff_frames(const char* old_cells, const char* new_cells,
+                          uint16_t width, uint16_t height,
+                          MapDirtyRect* rects, size_t max_rects) {
+    size_t stride = (size_t)width + 1;
+    size_t count = 0;
+    bool overflow = false;
+    uint16_t min_x = UINT16_MAX, max_x = 0, min_y = UINT16_MAX, max_y = 0;
+
+    for (uint16_t y = 0; y < height; y++) {
+        const char* a = old_cells + y * stride;
+        const char* b = new_cells + y * stride;
+
+        uint16_t x0 = 0;
+        while (x0 < width && a[x0] == b[x0]) x0++;
+        if (x0 == width) continue;
+        uint16_t x1 = width - 1;
+        while (a[x1] == b[x1]) x1--;
+
+        if (x0 < min_x) min_x = x0;
+        if (x1 > max_x) max_x = x1;
+        if (y < min_y) min_y = y;
+        max_y = y;
+        if (overflow) continue;
+
+        uint16_t span = x1 - x0 + 1;
+        if (count > 0) {
+            MapDirtyRect* last = &rects[count - 1];
+            if (last->x == x0 && last->width == span && last->y + last->height == y) {
+                last->height++;
+                continue;
+            }
+        }
+        if (count < max_rects) {
+            rects[count++] = (MapDirtyRect){x0, y, span, 1};
+        } else {
+            overflow = true;
+        }
+    }
+
+    if (overflow && max_rects > 0) {
+        rects[0] = (MapDirtyRect){min_x, min_y, max_x - min_x + 1, max_y - min_y + 1};
+        count = 1;
+    }
+    return count;
+}
+
 /* Public API */
 
 MapRenderOptions map_render_options_default(void) {
@@ -268,6 +735,7 @@ MapRenderOptions map_render_options_default(void) {
     opts.highlight_location_id = 0;
     opts.highlight_path = NULL;
     opts.highlight_path_length = 0;
+    opts.view_radius = 0;
     return opts;
 }
 
@@ -277,7 +745,7 @@ WorldMap* world_map_create(TerritoryManager* territory, LocationGraph* graph) {
         return NULL;
     }
 
-    WorldMap* map = malloc(sizeof(WorldMap));
+    WorldMap* map = calloc(1, sizeof(WorldMap));
     if (!map) {
         LOG_ERROR("world_map_create: Failed to allocate WorldMap");
         return NULL;
@@ -285,11 +753,20 @@ WorldMap* world_map_create(TerritoryManager* territory, LocationGraph* graph) {
 
     map->territory = territory;
     map->graph = graph;
-    map->location_data = hash_table_create(100);
-
-    if (!map->location_data) {
+    map->layout_job = NULL;
+    map->version = 1;
+    map->territory_version = territory_manager_get_version(territory);
+    map->entries = malloc(sizeof(LocationMapData) * 64);
+    map->entry_capacity = 64;
+    map->entry_index = id_map_create(64);
+    map->grid_cells = id_map_create(64);
+
+    if (!map->entries || !map->entry_index || !map->grid_cells) {
+        free(map->entries);
+        id_map_destroy(map->entry_index);
+        id_map_destroy(map->grid_cells);
         free(map);
-        LOG_ERROR("world_map_create: Failed to create hash table");
+        LOG_ERROR("world_map_create: Failed to create location map");
         return NULL;
     }
 
@@ -300,12 +777,20 @@ WorldMap* world_map_create(TerritoryManager* territory, LocationGraph* graph) {
 void world_map_destroy(WorldMap* map) {
     if (!map) return;
 
-    /* Free all location map data */
-    if (map->location_data) {
-        /* Iterate and free all values */
-        hash_table_foreach(map->location_data, free_location_data_callback, NULL);
-        hash_table_destroy(map->location_data);
+    /* A layout still running has nothing left to apply to */
+    if (map->layout_job) {
+        finish_layout(map, false);
+    }
+
+    free(map->entries);
+    id_map_destroy(map->entry_index);
+
+    id_map_foreach(map->grid_cells, free_cell_callback, NULL);
+    id_map_destroy(map->grid_cells);
+    for (int r = 0; r < MAP_REGION_COUNT; r++) {
+        free(map->regions[r].slots);
     }
+    free(map->layer.cells);
 
     free(map);
     LOG_DEBUG("world_map_destroy: Destroyed world map");
@@ -315,11 +800,7 @@ bool world_map_set_coordinates(WorldMap* map, uint32_t location_id,
                                 int16_t x, int16_t y) {
     if (!map) return false;
 
-    LocationMapData* data = get_or_create_map_data(map, location_id);
-    if (!data) return false;
-
-    data->coords.x = x;
-    data->coords.y = y;
+    if (!set_coordinates(map, location_id, x, y)) return false;
 
     LOG_DEBUG("world_map_set_coordinates: Set location %u to (%d, %d)",
               location_id, x, y);
@@ -330,10 +811,7 @@ bool world_map_get_coordinates(const WorldMap* map, uint32_t location_id,
                                 MapCoordinates* coords) {
     if (!map) return false;
 
-    char key[32];
-    snprintf(key, sizeof(key), "%u", location_id);
-
-    LocationMapData* data = hash_table_get(map->location_data, key);
+    const LocationMapData* data = find_map_data(map, location_id);
     if (!data) return false;
 
     if (coords) {
@@ -349,7 +827,13 @@ bool world_map_set_region(WorldMap* map, uint32_t location_id, MapRegion region)
     LocationMapData* data = get_or_create_map_data(map, location_id);
     if (!data) return false;
 
-    data->region = region;
+    if (data->region != region) {
+        uint32_t slot = (uint32_t)(data - map->entries);
+        if (!entry_list_add(&map->regions[region], slot)) return false;
+        entry_list_remove(&map->regions[data->region], slot);
+        data->region = region;
+        map->version++;
+    }
     LOG_DEBUG("world_map_set_region: Set location %u to region %d",
               location_id, region);
     return true;
@@ -358,10 +842,7 @@ bool world_map_set_region(WorldMap* map, uint32_t location_id, MapRegion region)
 MapRegion world_map_get_region(const WorldMap* map, uint32_t location_id) {
     if (!map) return MAP_REGION_STARTING_GROUNDS;
 
-    char key[32];
-    snprintf(key, sizeof(key), "%u", location_id);
-
-    LocationMapData* data = hash_table_get(map->location_data, key);
+    const LocationMapData* data = find_map_data(map, location_id);
     if (!data) return MAP_REGION_STARTING_GROUNDS;
 
     return data->region;
@@ -373,7 +854,10 @@ bool world_map_set_symbol(WorldMap* map, uint32_t location_id, char symbol) {
     LocationMapData* data = get_or_create_map_data(map, location_id);
     if (!data) return false;
 
-    data->symbol = symbol;
+    if (data->symbol != symbol) {
+        data->symbol = symbol;
+        map->version++;
+    }
     return true;
 }
 
@@ -381,15 +865,38 @@ size_t world_map_get_locations_in_region(const WorldMap* map, MapRegion region,
                                           uint32_t* results, size_t max_results) {
     if (!map || !results || region >= MAP_REGION_COUNT) return 0;
 
-    RegionFilterContext ctx = {
-        .results = results,
-        .count = 0,
-        .max_results = max_results,
-        .filter_region = region
-    };
+    const MapEntryList* list = &map->regions[region];
+    size_t count = list->count < max_results ? list->count : max_results;
+    for (size_t i = 0; i < count; i++) {
+        results[i] = map->entries[list->slots[i]].location_id;
+    }
+    return count;
+}
 
-    hash_table_foreach(map->location_data, filter_by_region_callback, &ctx);
-    return ctx.count;
+typedef struct {
+    const WorldMap* map;
+    uint32_t* results;
+    size_t count;
+    size_t max_results;
+    MapCoordinates center_coords;
+    uint16_t radius;
+    uint32_t center_id;
+} RadiusFilterContext;
+
+static void filter_by_radius(const SpatialCell* cell, void* userdata) {
+    RadiusFilterContext* ctx = userdata;
+
+    for (size_t i = 0; i < cell->list.count && ctx->count < ctx->max_results; i++) {
+        const LocationMapData* data = &ctx->map->entries[cell->list.slots[i]];
+        if (data->location_id == ctx->center_id) continue;
+
+        /* Manhattan distance */
+        int32_t dx = abs(data->coords.x - ctx->center_coords.x);
+        int32_t dy = abs(data->coords.y - ctx->center_coords.y);
+        if (dx + dy <= ctx->radius) {
+            ctx->results[ctx->count++] = data->location_id;
+        }
+    }
 }
 
 size_t world_map_get_locations_in_radius(const WorldMap* map,
@@ -405,6 +912,7 @@ size_t world_map_get_locations_in_radius(const WorldMap* map,
     }
 
     RadiusFilterContext ctx = {
+        .map = map,
         .results = results,
         .count = 0,
         .max_results = max_results,
@@ -413,7 +921,10 @@ size_t world_map_get_locations_in_radius(const WorldMap* map,
         .center_id = center_id
     };
 
-    hash_table_foreach(map->location_data, filter_by_radius_callback, &ctx);
+    /* The diamond fits in its bounding square of cells */
+    grid_visit_box(map, center_coords.x - radius, center_coords.y - radius,
+                   center_coords.x + radius, center_coords.y + radius,
+                   filter_by_radius, &ctx);
     return ctx.count;
 }
 
@@ -422,28 +933,17 @@ bool world_map_get_bounds(const WorldMap* map,
                            int16_t* min_y, int16_t* max_y) {
     if (!map) return false;
 
-    if (hash_table_size(map->location_data) == 0) {
+    if (map->entry_count == 0) {
         return false;
     }
 
-    BoundsContext ctx = {
-        .min_x = 0,
-        .max_x = 0,
-        .min_y = 0,
-        .max_y = 0,
-        .first = true
-    };
-
-    hash_table_foreach(map->location_data, calculate_bounds_callback, &ctx);
-
-    if (ctx.first) {
-        return false;  /* No valid locations found */
-    }
+    /* The cache is refreshed lazily, like the graph's compiled adjacency */
+    bounds_refresh((WorldMap*)map);
 
-    if (min_x) *min_x = ctx.min_x;
-    if (max_x) *max_x = ctx.max_x;
-    if (min_y) *min_y = ctx.min_y;
-    if (max_y) *max_y = ctx.max_y;
+    if (min_x) *min_x = map->bounds_min.x;
+    if (max_x) *max_x = map->bounds_max.x;
+    if (min_y) *min_y = map->bounds_min.y;
+    if (max_y) *max_y = map->bounds_max.y;
 
     return true;
 }
@@ -456,94 +956,31 @@ size_t world_map_render(const WorldMap* map,
     if (!map || !buffer || buffer_size == 0) return 0;
 
     MapRenderOptions opts = options ? *options : map_render_options_default();
+    clamp_options(&opts);
 
-    /* Clamp dimensions */
-    if (opts.width > MAX_MAP_WIDTH) opts.width = MAX_MAP_WIDTH;
-    if (opts.height > MAX_MAP_HEIGHT) opts.height = MAX_MAP_HEIGHT;
-
-    /* Get bounding box */
-    int16_t min_x, max_x, min_y, max_y;
-    if (!world_map_get_bounds(map, &min_x, &max_x, &min_y, &max_y)) {
+    MapView view;
+    if (!compute_view(map, current_location_id, &opts, &view)) {
         strncpy(buffer, "[Empty map - no locations]", buffer_size - 1);
         buffer[buffer_size - 1] = '\0';
         return strlen(buffer);
     }
 
-    /* Add padding */
-    min_x -= 2; max_x += 2;
-    min_y -= 2; max_y += 2;
-
-    /* Calculate scale */
-    int16_t world_width = max_x - min_x;
-    int16_t world_height = max_y - min_y;
-
-    if (world_width == 0) world_width = 1;
-    if (world_height == 0) world_height = 1;
+    /* The layer is a cache refreshed lazily, like the bounds */
+    const MapLayer* layer = layer_refresh((WorldMap*)map, &view, &opts);
+    if (!layer) return 0;
 
-    /* Create map grid */
-    char** grid = malloc(sizeof(char*) * opts.height);
-    if (!grid) return 0;
-
-    for (uint16_t y = 0; y < opts.height; y++) {
-        grid[y] = malloc(opts.width + 1);
-        if (!grid[y]) {
-            for (uint16_t j = 0; j < y; j++) free(grid[j]);
-            free(grid);
-            return 0;
-        }
-        memset(grid[y], ' ', opts.width);
-        grid[y][opts.width] = '\0';
-    }
-
-    /* Draw border */
-    for (uint16_t x = 0; x < opts.width; x++) {
-        grid[0][x] = '-';
-        grid[opts.height - 1][x] = '-';
-    }
-    for (uint16_t y = 0; y < opts.height; y++) {
-        grid[y][0] = '|';
-        grid[y][opts.width - 1] = '|';
-    }
-    grid[0][0] = '+';
-    grid[0][opts.width - 1] = '+';
-    grid[opts.height - 1][0] = '+';
-    grid[opts.height - 1][opts.width - 1] = '+';
-
-    /* Plot locations */
-    RenderContext render_ctx = {
-        .grid = grid,
-        .width = opts.width,
-        .height = opts.height,
-        .min_x = min_x,
-        .max_x = max_x,
-        .min_y = min_y,
-        .max_y = max_y,
-        .world_width = world_width,
-        .world_height = world_height,
-        .current_location_id = current_location_id,
-        .highlight_location_id = opts.highlight_location_id,
-        .show_undiscovered = opts.show_undiscovered,
-        .map = map,
-        .opts = &opts
-    };
-
-    hash_table_foreach(map->location_data, plot_location_callback, &render_ctx);
-
-    /* Draw connections */
-    if (opts.show_connections) {
-        hash_table_foreach(map->location_data, draw_connections_callback, &render_ctx);
-    }
+    MapMarker markers[2];
+    size_t marker_count = collect_markers(map, &view, current_location_id, &opts, markers);
 
     /* Assemble buffer */
     size_t written = 0;
-    for (uint16_t y = 0; y < opts.height && written < buffer_size - 1; y++) {
-        size_t line_len = strlen(grid[y]);
-        size_t copy_len = line_len;
+    for (uint16_t y = 0; y < view.height && written < buffer_size - 1; y++) {
+        size_t copy_len = view.width;
         if (written + copy_len + 1 >= buffer_size) {
             copy_len = buffer_size - written - 2;
         }
 
-        memcpy(buffer + written, grid[y], copy_len);
+        compose_row(layer, y, markers, marker_count, buffer + written, copy_len);
         written += copy_len;
 
         if (written < buffer_size - 1) {
@@ -563,14 +1000,106 @@ size_t world_map_render(const WorldMap* map,
     }
 
     buffer[written] = '\0';
+    return written;
+}
 
-    /* Free grid */
-    for (uint16_t y = 0; y < opts.height; y++) {
-        free(grid[y]);
+MapFrame* map_frame_create(void) {
+    MapFrame* frame = calloc(1, sizeof(MapFrame));
+    if (!frame) {
+        LOG_ERROR("map_frame_create: Failed to allocate MapFrame");
     }
-    free(grid);
+    return frame;
+}
 
-    return written;
+void map_frame_destroy(MapFrame* frame) {
+    if (!frame) return;
+
+    free(frame->cells);
+    free(frame->next);
+    free(frame);
+}
+
+uint16_t map_frame_get_width(const MapFrame* frame) {
+    return frame ? frame->width : 0;
+}
+
+uint16_t map_frame_get_height(const MapFrame* frame) {
+    return frame ? frame->height : 0;
+}
+
+const char* map_frame_get_row(const MapFrame* frame, uint16_t y) {
+    if (!frame || y >= frame->height) return NULL;
+    return frame->cells + (size_t)y * (frame->width + 1);
+}
+
+size_t world_map_render_frame(const WorldMap* map,
+                              uint32_t current_location_id,
+                              const MapRenderOptions* options,
+                              MapFrame* frame,
+                              MapDirtyRect* rects,
+                              size_t max_rects) {
+    if (!map || !frame) return 0;
+    if (!rects) max_rects = 0;
+
+    MapRenderOptions opts = options ? *options : map_render_options_default();
+    clamp_options(&opts);
+
+    /* An empty map still gets its border */
+    MapView view;
+    compute_view(map, current_location_id, &opts, &view);
+
+    const MapLayer* layer = layer_refresh((WorldMap*)map, &view, &opts);
+    if (!layer) return 0;
+
+    size_t stride = (size_t)view.width + 1;
+    size_t size = stride * view.height;
+    if (size > frame->capacity) {
+        char* cells = realloc(frame->cells, size);
+        if (!cells) {
+            LOG_ERROR("world_map_render_frame: Failed to allocate frame");
+            return 0;
+        }
+        frame->cells = cells;
+
+        char* next = realloc(frame->next, size);
+        if (!next) {
+            LOG_ERROR("world_map_render_frame: Failed to allocate frame");
+            return 0;
+        }
+        frame->next = next;
+        frame->capacity = size;
+    }
+
+    MapMarker markers[2];
+    size_t marker_count = collect_markers(map, &view, current_location_id, &opts, markers);
+    for (uint16_t y = 0; y < view.height; y++) {
+        char* row = frame->next + y * stride;
+        compose_row(layer, y, markers, marker_count, row, view.width);
+        row[view.width] = '\0';
+    }
+
+    size_t count = 0;
+    if (frame->width != view.width || frame->height != view.height) {
+        /* Nothing on screen to compare against */
+        if (max_rects > 0) {
+            rects[0] = (MapDirtyRect){0, 0, view.width, view.height};
+            count = 1;
+        }
+    } else {
+        count = diff_frames(frame->cells, frame->next, view.width, view.height,
+                            rects, max_rects);
+    }
+
+    char* shown = frame->cells;
+    frame->cells = frame->next;
+    frame->next = shown;
+    frame->width = view.width;
+    frame->height = view.height;
+    return count;
+}
+
+uint64_t world_map_get_version(const WorldMap* map) {
+    return map ? map->version : 0;
 }
 
 size_t world_map_get_legend(char* buffer, size_t buffer_size) {
@@ -602,30 +1131,320 @@ const char* world_map_region_name(MapRegion region) {
     }
 }
 
-bool world_map_auto_layout(WorldMap* map, uint32_t iterations) {
+/**
+ * @brief Snapshot of the graph and positions for one layout run
+ *
+ * The worker thread only touches the job, never the map, so the game
+ * keeps running while a layout is computed.
+ */
+struct LayoutJob {
+    uint32_t* ids;              /**< Location IDs in graph order */
+    float* x;                   /**< Positions (in/out) */
+    float* y;
+    bool* fixed;                /**< Already placed (incremental only) */
+    uint32_t* edge_from;
+    uint32_t* edge_to;
+    float* edge_length;
+    size_t node_count;
+    size_t edge_count;
+    uint32_t iterations;
+    bool incremental;
+    bool fitted;                /**< Recentered and rescaled, placed ones included */
+    bool ok;                    /**< Layout succeeded */
+    atomic_bool done;           /**< Set by the worker when finished */
+};
+
+static void layout_job_free(LayoutJob* job) {
+    if (!job) return;
+    free(job->ids);
+    free(job->x);
+    free(job->y);
+    free(job->fixed);
+    free(job->edge_from);
+    free(job->edge_to);
+    free(job->edge_length);
+    free(job);
+}
+
+/* Golden-angle spiral: an even, deterministic spread around (cx, cy) */
+static void spiral_position(size_t i, float spacing, float cx, float cy,
+                            float* x, float* y) {
+    float radius = spacing * sqrtf((float)i + 0.5f);
+    float angle = (float)i * 2.39996323f;
+    *x = cx + radius * cosf(angle);
+    *y = cy + radius * sinf(angle);
+}
+
+/**
+ * @brief Snapshot the graph for a layout run
+ *
+ * A full layout starts every location on a spiral. An incremental one
+ * pins placed locations and starts each new one at the centroid of its
+ * placed neighbors, or on a spiral around the placed ones if it has none.
+ */
+static LayoutJob* layout_job_create(const WorldMap* map, uint32_t iterations,
+                                    bool incremental) {
+    LayoutJob* job = calloc(1, sizeof(LayoutJob));
+    if (!job) return NULL;
+
+    size_t n = location_graph_get_location_count(map->graph);
+    size_t edges = location_graph_get_connection_count(map->graph);
+    job->iterations = iterations ? iterations : WORLD_MAP_DEFAULT_LAYOUT_ITERATIONS;
+    job->incremental = incremental;
+    atomic_init(&job->done, false);
+
+    size_t node_alloc = n ? n : 1;
+    size_t edge_alloc = edges ? edges : 1;
+    job->ids = malloc(sizeof(uint32_t) * node_alloc);
+    job->x = malloc(sizeof(float) * node_alloc);
+    job->y = malloc(sizeof(float) * node_alloc);
+    job->fixed = calloc(node_alloc, sizeof(bool));
+    job->edge_from = malloc(sizeof(uint32_t) * edge_alloc);
+    job->edge_to = malloc(sizeof(uint32_t) * edge_alloc);
+    job->edge_length = malloc(sizeof(float) * edge_alloc);
+    uint8_t* times = malloc(edge_alloc);
+    uint32_t* placed_neighbors = calloc(node_alloc, sizeof(uint32_t));
+    if (!job->ids || !job->x || !job->y || !job->fixed || !job->edge_from ||
+        !job->edge_to || !job->edge_length || !times || !placed_neighbors) {
+        free(times);
+        free(placed_neighbors);
+        layout_job_free(job);
+        return NULL;
+    }
+
+    job->node_count = location_graph_get_all_locations(map->graph, job->ids, n);
+    job->edge_count = location_graph_get_edges(map->graph, job->edge_from, job->edge_to,
+                                               times, edges);
+    for (size_t e = 0; e < job->edge_count; e++) {
+        job->edge_length[e] = WORLD_MAP_LAYOUT_UNITS_PER_HOUR * (float)times[e];
+    }
+    free(times);
+
+    float spacing = WORLD_MAP_LAYOUT_UNITS_PER_HOUR * 2.0f;
+    float cx = 0.0f, cy = 0.0f;
+    size_t placed_count = 0;
+
+    if (incremental) {
+        for (size_t i = 0; i < job->node_count; i++) {
+            const LocationMapData* data = find_map_data(map, job->ids[i]);
+            if (data && data->placed) {
+                job->fixed[i] = true;
+                job->x[i] = data->coords.x;
+                job->y[i] = data->coords.y;
+                cx += job->x[i];
+                cy += job->y[i];
+                placed_count++;
+            } else {
+                job->x[i] = 0.0f;
+                job->y[i] = 0.0f;
+            }
+        }
+        if (placed_count > 0) {
+            cx /= (float)placed_count;
+            cy /= (float)placed_count;
+        }
+
+        /* Sum placed neighbors' positions into each new location */
+        for (size_t e = 0; e < job->edge_count; e++) {
+            uint32_t a = job->edge_from[e];
+            uint32_t b = job->edge_to[e];
+            if (job->fixed[a] && !job->fixed[b]) {
+                job->x[b] += job->x[a];
+                job->y[b] += job->y[a];
+                placed_neighbors[b]++;
+            } else if (job->fixed[b] && !job->fixed[a]) {
+                job->x[a] += job->x[b];
+                job->y[a] += job->y[b];
+                placed_neighbors[a]++;
+            }
+        }
+    }
+
+    /* Spiral slots for new locations continue past the placed ones */
+    size_t slot = placed_count;
+    for (size_t i = 0; i < job->node_count; i++) {
+        if (job->fixed[i]) continue;
+
+        if (placed_neighbors[i] > 0) {
+            /* Offset by index so siblings of one neighbor do not coincide */
+            float ox, oy;
+            spiral_position(i % 64, spacing * 0.25f, 0.0f, 0.0f, &ox, &oy);
+            job->x[i] = job->x[i] / (float)placed_neighbors[i] + ox;
+            job->y[i] = job->y[i] / (float)placed_neighbors[i] + oy;
+        } else {
+            spiral_position(slot++, spacing, cx, cy, &job->x[i], &job->y[i]);
+        }
+    }
+
+    free(placed_neighbors);
+    return job;
+}
+
+/**
+ * @brief Center positions on the origin and shrink them into map range
+ *
+ * Moves every location, placed or not, so the job records that all of
+ * them must be written back.
+ */
+static void layout_job_fit(LayoutJob* job) {
+    float cx = 0.0f, cy = 0.0f;
+    for (size_t i = 0; i < job->node_count; i++) {
+        cx += job->x[i];
+        cy += job->y[i];
+    }
+    cx /= (float)job->node_count;
+    cy /= (float)job->node_count;
+
+    float extent = 0.0f;
+    for (size_t i = 0; i < job->node_count; i++) {
+        job->x[i] -= cx;
+        job->y[i] -= cy;
+        extent = fmaxf(extent, fmaxf(fabsf(job->x[i]), fabsf(job->y[i])));
+    }
+    if (extent > WORLD_MAP_COORD_LIMIT) {
+        float scale = WORLD_MAP_COORD_LIMIT / extent;
+        for (size_t i = 0; i < job->node_count; i++) {
+            job->x[i] *= scale;
+            job->y[i] *= scale;
+        }
+    }
+    job->fitted = true;
+}
+
+/**
+ * @brief Run the force simulation and fit the result to map range
+ */
+static void layout_job_run(LayoutJob* job) {
+    ForceLayoutProblem problem = {
+        .node_count = job->node_count,
+        .x = job->x,
+        .y = job->y,
+        .fixed = job->incremental ? job->fixed : NULL,
+        .edge_count = job->edge_count,
+        .edge_from = job->edge_from,
+        .edge_to = job->edge_to,
+        .edge_length = job->edge_length
+    };
+    job->ok = force_layout_run(&problem, job->iterations, FORCE_LAYOUT_DEFAULT_THETA);
+
+    if (job->ok && job->node_count > 0) {
+        /* A full layout is always fitted; an incremental one keeps placed
+         * locations still unless something landed outside map range */
+        bool fit = !job->incremental;
+        for (size_t i = 0; i < job->node_count && !fit; i++) {
+            fit = fabsf(job->x[i]) > WORLD_MAP_COORD_LIMIT ||
+                  fabsf(job->y[i]) > WORLD_MAP_COORD_LIMIT;
+        }
+        if (fit) {
+            layout_job_fit(job);
+        }
+    }
+
+    atomic_store(&job->done, true);
+}
+
+static void* layout_worker(void* arg) {
+    layout_job_run((LayoutJob*)arg);
+    return NULL;
+}
+
+static int16_t clamp_coordinate(float value) {
+    if (value > WORLD_MAP_COORD_LIMIT) return WORLD_MAP_COORD_LIMIT;
+    if (value < -WORLD_MAP_COORD_LIMIT) return -WORLD_MAP_COORD_LIMIT;
+    return (int16_t)lroundf(value);
+}
+
+/**
+ * @brief Copy a finished job's positions into the map
+ */
+static bool layout_job_apply(WorldMap* map, const LayoutJob* job) {
+    if (!job->ok) return false;
+
+    size_t moved = 0;
+    for (size_t i = 0; i < job->node_count; i++) {
+        if (job->incremental && !job->fitted && job->fixed[i]) continue;
+        if (!set_coordinates(map, job->ids[i], clamp_coordinate(job->x[i]),
+                             clamp_coordinate(job->y[i]))) {
+            return false;
+        }
+        moved++;
+    }
+
+    LOG_INFO("world_map: %s layout placed %zu of %zu locations",
+             job->incremental ? "Incremental" : "Full", moved, job->node_count);
+    return true;
+}
+
+static bool run_layout(WorldMap* map, uint32_t iterations, bool incremental) {
     if (!map) return false;
 
-    /* Simple circular layout algorithm */
-    uint32_t locations[100];
-    size_t count = location_graph_get_all_locations(map->graph, locations, 100);
+    LayoutJob* job = layout_job_create(map, iterations, incremental);
+    if (!job) {
+        LOG_ERROR("world_map: Failed to allocate layout job");
+        return false;
+    }
 
-    if (count == 0) return true;
+    layout_job_run(job);
+    bool ok = layout_job_apply(map, job);
+    layout_job_free(job);
+    return ok;
+}
 
-    /* Arrange in a circle */
-    double angle_step = (2.0 * M_PI) / count;
-    double radius = (count * 3.0); /* Scale radius with location count */
+bool world_map_auto_layout(WorldMap* map, uint32_t iterations) {
+    return run_layout(map, iterations, false);
+}
 
-    for (size_t i = 0; i < count; i++) {
-        double angle = i * angle_step;
-        int16_t x = (int16_t)(cos(angle) * radius);
-        int16_t y = (int16_t)(sin(angle) * radius);
+bool world_map_layout_incremental(WorldMap* map, uint32_t iterations) {
+    return run_layout(map, iterations, true);
+}
+
+bool world_map_auto_layout_async(WorldMap* map, uint32_t iterations, bool incremental) {
+    if (!map) return false;
 
-        world_map_set_coordinates(map, locations[i], x, y);
+    if (map->layout_job) {
+        LOG_WARN("world_map_auto_layout_async: Layout already running");
+        return false;
+    }
+
+    LayoutJob* job = layout_job_create(map, iterations, incremental);
+    if (!job) {
+        LOG_ERROR("world_map_auto_layout_async: Failed to allocate layout job");
+        return false;
     }
 
-    LOG_INFO("world_map_auto_layout: Laid out %zu locations in circular pattern",
-             count);
+    if (pthread_create(&map->layout_thread, NULL, layout_worker, job) != 0) {
+        LOG_ERROR("world_map_auto_layout_async: Failed to start worker thread");
+        layout_job_free(job);
+        return false;
+    }
 
-    (void)iterations; /* Unused for simple layout */
+    map->layout_job = job;
     return true;
 }
+
+/**
+ * @brief Join the worker and optionally apply its result
+ */
+static bool finish_layout(WorldMap* map, bool apply) {
+    pthread_join(map->layout_thread, NULL);
+    bool ok = apply && layout_job_apply(map, map->layout_job);
+    layout_job_free(map->layout_job);
+    map->layout_job = NULL;
+    return ok;
+}
+
+bool world_map_layout_poll(WorldMap* map) {
+    if (!map || !map->layout_job || !atomic_load(&map->layout_job->done)) {
+        return false;
+    }
+    return finish_layout(map, true);
+}
+
+bool world_map_layout_wait(WorldMap* map) {
+    if (!map || !map->layout_job) return false;
+    return finish_layout(map, true);
+}
+
+bool world_map_layout_pending(const WorldMap* map) {
+    return map && map->layout_job;
+}
@@ -16,6 +16,12 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+/** Iterations used when a layout is requested with 0 */
+#define WORLD_MAP_DEFAULT_LAYOUT_ITERATIONS 100
+
+/** Layout distance per hour of travel along a connection */
+#define WORLD_MAP_LAYOUT_UNITS_PER_HOUR 4.0f
+
 /**
  * @brief 2D map coordinates
  */
@@ -46,6 +52,7 @@ typedef struct {
     MapRegion region;           /**< Region this location belongs to */
     char symbol;                /**< ASCII symbol for this location */
     bool discovered;            /**< Whether location is discovered */
+    bool placed;                /**< Whether coords have been set */
 } LocationMapData;
 
 /**
@@ -53,6 +60,21 @@ typedef struct {
  */
 typedef struct WorldMap WorldMap;
 
+/**
+ * @brief Frame kept between renders by an incremental frontend (opaque)
+ */
+typedef struct MapFrame MapFrame;
+
+/**
+ * @brief Block of frame cells that changed since the previous render
+ */
+typedef struct {
+    uint16_t x;                 /**< Left column */
+    uint16_t y;                 /**< Top row */
+    uint16_t width;             /**< Columns */
+    uint16_t height;            /**< Rows */
+} MapDirtyRect;
+
 /**
  * @brief Map rendering options
  */
@@ -66,6 +88,7 @@ typedef struct {
     uint32_t highlight_location_id;     /**< Location to highlight (0 = none) */
     uint32_t* highlight_path;           /**< Path to highlight (NULL = none) */
     size_t highlight_path_length;       /**< Length of highlight path */
+    uint16_t view_radius;               /**< World units shown around the player (0 = whole map) */
 } MapRenderOptions;
 
 /**
@@ -196,6 +219,10 @@ size_t world_map_get_locations_in_radius(const WorldMap* map,
  * - Optional path highlighting
  * - Optional legend
  *
+ * Everything except the @ and highlight markers is cached on the map and
+ * only redrawn after the locations, the territory or the graph change, so
+ * repeated renders of a quiet world are a copy plus two stamps.
+ *
  * @param map World map
  * @param current_location_id Current player location (highlighted as @)
  * @param options Rendering options
@@ -209,6 +236,74 @@ size_t world_map_render(const WorldMap* map,
                          char* buffer,
                          size_t buffer_size);
 
+/**
+ * @brief Create an empty frame for world_map_render_frame()
+ *
+ * @return Newly allocated MapFrame, or NULL on failure
+ */
+MapFrame* map_frame_create(void);
+
+/**
+ * @brief Destroy a frame
+ *
+ * @param frame Frame to destroy (can be NULL)
+ */
+void map_frame_destroy(MapFrame* frame);
+
+/**
+ * @brief Get frame width in characters (0 before the first render)
+ */
+uint16_t map_frame_get_width(const MapFrame* frame);
+
+/**
+ * @brief Get frame height in characters (0 before the first render)
+ */
+uint16_t map_frame_get_height(const MapFrame* frame);
+
+/**
+ * @brief Get one row of the frame
+ *
+ * @param frame Frame
+ * @param y Row index
+ * @return Null-terminated row of map_frame_get_width() characters, or NULL if out of range
+ */
+const char* map_frame_get_row(const MapFrame* frame, uint16_t y);
+
+/**
+ * @brief Render the map into a frame and report what changed
+ *
+ * Produces the same grid as world_map_render() without the legend, then
+ * compares it with the frame's previous contents so a curses frontend
+ * can redraw only the changed cells. The first render, and any render at
+ * a new size, reports the whole frame. If more than max_rects rectangles
+ * would be needed, one rectangle covering all changes is reported.
+ *
+ * @param map World map
+ * @param current_location_id Current player location (highlighted as @)
+ * @param options Rendering options (legend is ignored)
+ * @param frame Frame holding the previous render, updated in place
+ * @param rects Output dirty rectangles (can be NULL)
+ * @param max_rects Capacity of rects
+ * @return Number of rectangles written (0 if nothing changed or on failure)
+ */
+size_t world_map_render_frame(const WorldMap* map,
+                              uint32_t current_location_id,
+                              const MapRenderOptions* options,
+                              MapFrame* frame,
+                              MapDirtyRect* rects,
+                              size_t max_rects);
+
+/**
+ * @brief Get the map's change counter
+ *
+ * Changes whenever a location's coordinates, region or symbol change or a
+ * location is added to the map.
+ *
+ * @param map World map
+ * @return Version (0 for NULL)
+ */
+uint64_t world_map_get_version(const WorldMap* map);
+
 /**
  * @brief Get legend string for map symbols
  *
@@ -229,15 +324,73 @@ const char* world_map_region_name(MapRegion region);
 /**
  * @brief Auto-layout locations using force-directed graph layout
  *
- * Automatically assigns coordinates to all locations based on their
- * connections, attempting to minimize edge crossings.
+ * Assigns coordinates to every location in the graph. Connections pull
+ * locations toward WORLD_MAP_LAYOUT_UNITS_PER_HOUR per hour of travel;
+ * all locations repel each other (Barnes-Hut, O(n log n) per
+ * iteration). The result is centered and scaled to fit +/-1000.
  *
  * @param map World map
- * @param iterations Number of layout iterations (default: 100)
+ * @param iterations Number of layout iterations (0 = default of 100)
  * @return true on success
  */
 bool world_map_auto_layout(WorldMap* map, uint32_t iterations);
 
+/**
+ * @brief Lay out only locations that have no coordinates yet
+ *
+ * Placed locations stay where they are; new ones start next to their
+ * placed neighbors and settle around them. Use after discovering or
+ * generating locations so the existing map does not shift. If the new
+ * locations would land outside +/-1000, the whole map is recentered and
+ * scaled like world_map_auto_layout() instead of piling up at the edge.
+ *
+ * @param map World map
+ * @param iterations Number of layout iterations (0 = default of 100)
+ * @return true on success
+ */
+bool world_map_layout_incremental(WorldMap* map, uint32_t iterations);
+
+/**
+ * @brief Start a layout on a worker thread
+ *
+ * Snapshots the graph and positions, then simulates in the background.
+ * The map is untouched until world_map_layout_poll() or
+ * world_map_layout_wait() applies the result on the calling thread.
+ * Only one layout may run at a time.
+ *
+ * @param map World map
+ * @param iterations Number of layout iterations (0 = default of 100)
+ * @param incremental Lay out only unplaced locations
+ * @return true if the worker started
+ */
+bool world_map_auto_layout_async(WorldMap* map, uint32_t iterations, bool incremental);
+
+/**
+ * @brief Apply a background layout if it has finished
+ *
+ * Never blocks; call once per frame or command.
+ *
+ * @param map World map
+ * @return true if a finished layout was applied
+ */
+bool world_map_layout_poll(WorldMap* map);
+
+/**
+ * @brief Wait for a background layout and apply it
+ *
+ * @param map World map
+ * @return true if a layout was running and has been applied
+ */
+bool world_map_layout_wait(WorldMap* map);
+
+/**
+ * @brief Check whether a background layout is in progress
+ *
+ * @param map World map
+ * @return true if a layout has been started and not yet applied
+ */
+bool world_map_layout_pending(const WorldMap* map);
+
 /**
  * @brief Calculate bounding box of all locations
  *
@@ -640,9 +640,8 @@ int main(int argc, char* argv[]) {
             g_running = false;
         }
 
-        /* Free result strings */
-        free(result.output);
-        free(result.error_message);
+        /* Release result (strings live in the command scratch arena) */
+        command_result_destroy(&result);
     }
 
     LOG_INFO("Shutting down");
@@ -13,6 +13,7 @@ struct InputHandler {
     CommandRegistry* registry;
     CommandHistory* history;
     Autocomplete* autocomplete;
+    Arena* scratch;           /* Per-command scratch arena (not owned) */
     struct termios orig_termios;
     bool raw_mode_enabled;
 };
@@ -57,6 +58,7 @@ InputHandler* input_handler_create(CommandRegistry* registry) {
     handler->registry = registry;
     handler->history = command_history_create(100);
     handler->autocomplete = autocomplete_create(registry);
+    handler->scratch = NULL;
     handler->raw_mode_enabled = false;
 
     if (!handler->history || !handler->autocomplete) {
@@ -137,7 +139,8 @@ CommandResult input_handler_execute(InputHandler* handler, const char* input) {
 
     /* Parse command */
     ParsedCommand* cmd = NULL;
-    ParseResult parse_result = parse_command_string(input, handler->registry, &cmd);
+    ParseResult parse_result = parse_command_string_arena(input, handler->registry,
+                                                          handler->scratch, &cmd);
 
     if (parse_result != PARSE_SUCCESS) {
         char error_msg[256];
@@ -149,12 +152,16 @@ CommandResult input_handler_execute(InputHandler* handler, const char* input) {
     /* Execute command */
     CommandResult result = execute_command(cmd);
 
-    /* Cleanup */
+    /* Cleanup (no-op when parsed into the scratch arena) */
     parsed_command_destroy(cmd);
 
     return result;
 }
 
+void input_handler_set_scratch_arena(InputHandler* handler, Arena* arena) {
+    if (handler) handler->scratch = arena;
+}
+
 CommandHistory* input_handler_get_history(InputHandler* handler) {
     return handler ? handler->history : NULL;
 }
@@ -78,6 +78,16 @@ CommandResult input_handler_read_and_execute(InputHandler* handler, const char*
  */
 CommandResult input_handler_execute(InputHandler* handler, const char* input);
 
+/**
+ * Set scratch arena used for parsing
+ * Parsed commands are placed in the arena and never freed individually;
+ * the owner resets the arena between commands.
+ *
+ * @param handler Input handler
+ * @param arena Scratch arena (NULL = heap)
+ */
+void input_handler_set_scratch_arena(InputHandler* handler, Arena* arena);
+
 /**
  * Get command history
  *
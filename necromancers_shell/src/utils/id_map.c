@@ -0,0 +1,290 @@
+#include "utils/id_map.h"
+#include "utils/logger.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Slots are kept in three parallel arrays so a probe sequence only touches
+ * the one-byte distance array and the key array. dist[i] == 0 marks an
+ * empty slot; otherwise it is the probe distance from the home slot plus 1.
+ */
+struct IdMap {
+    uint8_t* dist;
+    uint32_t* keys;
+    uintptr_t* values;
+    size_t capacity;      /* Always a power of two */
+    unsigned shift;       /* 64 - log2(capacity) */
+    size_t size;
+};
+
+/* Constants */
+#define MIN_CAPACITY 16
+#define MAX_PROBE_DIST 255
+/* Grow when size exceeds 7/8 of capacity */
+#define LOAD_NUM 7
+#define LOAD_DEN 8
+
+/* Fibonacci hashing: the top bits of key * 2^64/phi spread sequential IDs */
+static inline size_t home_slot(uint32_t key, unsigned shift) {
+    return (size_t)(((uint64_t)key * 11400714819323198485ull) >> shift);
+}
+
+static size_t round_capacity(size_t count) {
+    size_t capacity = MIN_CAPACITY;
+    while (capacity * LOAD_NUM / LOAD_DEN < count) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+static bool allocate_slots(IdMap* map, size_t capacity) {
+    map->dist = calloc(capacity, sizeof(uint8_t));
+    map->keys = malloc(capacity * sizeof(uint32_t));
+    map->values = malloc(capacity * sizeof(uintptr_t));
+    if (!map->dist || !map->keys || !map->values) {
+        free(map->dist);
+        free(map->keys);
+        free(map->values);
+        map->dist = NULL;
+        map->keys = NULL;
+        map->values = NULL;
+        return false;
+    }
+    map->capacity = capacity;
+    map->shift = 64;
+    for (size_t c = capacity; c > 1; c >>= 1) {
+        map->shift--;
+    }
+    return true;
+}
+
+/* Find slot holding key, or SIZE_MAX */
+static size_t find_slot(const IdMap* map, uint32_t key) {
+    size_t mask = map->capacity - 1;
+    size_t index = home_slot(key, map->shift);
+
+    for (uint32_t d = 1; d <= MAX_PROBE_DIST; d++) {
+        uint8_t slot_dist = map->dist[index];
+        /* Robin Hood invariant: key cannot live past a poorer slot */
+        if (slot_dist < d) {
+            return SIZE_MAX;
+        }
+        if (map->keys[index] == key) {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return SIZE_MAX;
+}
+
+static bool resize_map(IdMap* map, size_t new_capacity);
+
+/* Insert key known not to be present; false if probe length overflowed */
+static bool insert_new(IdMap* map, uint32_t key, uintptr_t value) {
+    size_t mask = map->capacity - 1;
+    size_t index = home_slot(key, map->shift);
+    uint32_t d = 1;
+
+    for (;;) {
+        if (map->dist[index] == 0) {
+            map->dist[index] = (uint8_t)d;
+            map->keys[index] = key;
+            map->values[index] = value;
+            return true;
+        }
+
+        /* Steal from the rich: swap with entries closer to home */
+        if (map->dist[index] < d) {
+            uint8_t tmp_dist = map->dist[index];
+            uint32_t tmp_key = map->keys[index];
+            uintptr_t tmp_value = map->values[index];
+
+            map->dist[index] = (uint8_t)d;
+            map->keys[index] = key;
+            map->values[index] = value;
+
+            d = tmp_dist;
+            key = tmp_key;
+            value = tmp_value;
+        }
+
+        index = (index + 1) & mask;
+        d++;
+        if (d > MAX_PROBE_DIST) {
+            /* Displaced entry is still in hand; grow and reinsert it */
+            if (!resize_map(map, map->capacity * 2)) {
+                return false;
+            }
+            return insert_new(map, key, value);
+        }
+    }
+}
+
+static bool resize_map(IdMap* map, size_t new_capacity) {
+    uint8_t* old_dist = map->dist;
+    uint32_t* old_keys = map->keys;
+    uintptr_t* old_values = map->values;
+    size_t old_capacity = map->capacity;
+    unsigned old_shift = map->shift;
+
+    if (!allocate_slots(map, new_capacity)) {
+        LOG_ERROR("Failed to allocate id map slots (%zu)", new_capacity);
+        map->dist = old_dist;
+        map->keys = old_keys;
+        map->values = old_values;
+        return false;
+    }
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_dist[i] != 0 && !insert_new(map, old_keys[i], old_values[i])) {
+            /* A nested grow failed and dropped an entry; the old slots
+             * still hold everything, so go back to them */
+            free(map->dist);
+            free(map->keys);
+            free(map->values);
+            map->dist = old_dist;
+            map->keys = old_keys;
+            map->values = old_values;
+            map->capacity = old_capacity;
+            map->shift = old_shift;
+            return false;
+        }
+    }
+
+    free(old_dist);
+    free(old_keys);
+    free(old_values);
+    return true;
+}
+
+static bool put_value(IdMap* map, uint32_t key, uintptr_t value) {
+    if (!map) return false;
+
+    size_t slot = find_slot(map, key);
+    if (slot != SIZE_MAX) {
+        map->values[slot] = value;
+        return true;
+    }
+
+    if ((map->size + 1) * LOAD_DEN > map->capacity * LOAD_NUM) {
+        if (!resize_map(map, map->capacity * 2)) {
+            return false;
+        }
+    }
+
+    if (!insert_new(map, key, value)) {
+        return false;
+    }
+    map->size++;
+    return true;
+}
+
+IdMap* id_map_create(size_t initial_capacity) {
+    IdMap* map = calloc(1, sizeof(IdMap));
+    if (!map) {
+        LOG_ERROR("Failed to allocate id map");
+        return NULL;
+    }
+
+    if (!allocate_slots(map, round_capacity(initial_capacity))) {
+        LOG_ERROR("Failed to allocate id map slots");
+        free(map);
+        return NULL;
+    }
+
+    return map;
+}
+
+void id_map_destroy(IdMap* map) {
+    if (!map) return;
+
+    free(map->dist);
+    free(map->keys);
+    free(map->values);
+    free(map);
+}
+
+bool id_map_put(IdMap* map, uint32_t key, void* value) {
+    return put_value(map, key, (uintptr_t)value);
+}
+
+void* id_map_get(const IdMap* map, uint32_t key) {
+    if (!map) return NULL;
+
+    size_t slot = find_slot(map, key);
+    return slot != SIZE_MAX ? (void*)map->values[slot] : NULL;
+}
+
+bool id_map_put_index(IdMap* map, uint32_t key, size_t index) {
+    return put_value(map, key, (uintptr_t)index);
+}
+
+bool id_map_get_index(const IdMap* map, uint32_t key, size_t* index_out) {
+    if (!map) return false;
+
+    size_t slot = find_slot(map, key);
+    if (slot == SIZE_MAX) return false;
+
+    if (index_out) *index_out = (size_t)map->values[slot];
+    return true;
+}
+
+bool id_map_contains(const IdMap* map, uint32_t key) {
+    return map && find_slot(map, key) != SIZE_MAX;
+}
+
+bool id_map_remove(IdMap* map, uint32_t key) {
+    if (!map) return false;
+
+    size_t slot = find_slot(map, key);
+    if (slot == SIZE_MAX) return false;
+
+    /* Backward-shift deletion keeps probe sequences tombstone-free */
+    size_t mask = map->capacity - 1;
+    size_t next = (slot + 1) & mask;
+    while (map->dist[next] > 1) {
+        map->dist[slot] = (uint8_t)(map->dist[next] - 1);
+        map->keys[slot] = map->keys[next];
+        map->values[slot] = map->values[next];
+        slot = next;
+        next = (next + 1) & mask;
+    }
+    map->dist[slot] = 0;
+
+    map->size--;
+    return true;
+}
+
+void id_map_clear(IdMap* map) {
+    if (!map) return;
+
+    memset(map->dist, 0, map->capacity);
+    map->size = 0;
+}
+
+bool id_map_reserve(IdMap* map, size_t count) {
+    if (!map) return false;
+
+    size_t needed = round_capacity(count);
+    if (needed <= map->capacity) return true;
+    return resize_map(map, needed);
+}
+
+size_t id_map_size(const IdMap* map) {
+    return map ? map->size : 0;
+}
+
+size_t id_map_capacity(const IdMap* map) {
+    return map ? map->capacity : 0;
+}
+
+void id_map_foreach(const IdMap* map, IdMapIterator iterator, void* userdata) {
+    if (!map || !iterator) return;
+
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->dist[i] != 0) {
+            iterator(map->keys[i], (void*)map->values[i], userdata);
+        }
+    }
+}
@@ -0,0 +1,148 @@
+#ifndef ID_MAP_H
+#define ID_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * ID Map - uint32-keyed dictionary
+ *
+ * Open-addressing hash map from uint32 entity IDs to a pointer or an
+ * array index. Uses Robin Hood probing with backward-shift deletion, so
+ * lookups stay short even at high load and there are no tombstones.
+ * Keys are stored inline; nothing is allocated per entry.
+ *
+ * Usage:
+ *   IdMap* map = id_map_create(128);
+ *   id_map_put(map, soul->id, soul);
+ *   Soul* s = id_map_get(map, 42);
+ *
+ *   id_map_put_index(map, location_id, 7);
+ *   size_t index;
+ *   if (id_map_get_index(map, location_id, &index)) { ... }
+ *   id_map_destroy(map);
+ */
+
+/* Opaque ID map structure */
+typedef struct IdMap IdMap;
+
+/* Iterator callback function */
+typedef void (*IdMapIterator)(uint32_t key, void* value, void* userdata);
+
+/**
+ * Create an ID map
+ *
+ * @param initial_capacity Expected number of entries (will grow as needed)
+ * @return ID map pointer or NULL on failure
+ */
+IdMap* id_map_create(size_t initial_capacity);
+
+/**
+ * Destroy an ID map
+ * Does NOT free the values (caller's responsibility)
+ *
+ * @param map ID map to destroy
+ */
+void id_map_destroy(IdMap* map);
+
+/**
+ * Insert or update a pointer value
+ *
+ * @param map ID map
+ * @param key Entity ID
+ * @param value Value pointer
+ * @return true on success
+ */
+bool id_map_put(IdMap* map, uint32_t key, void* value);
+
+/**
+ * Get a pointer value by key
+ *
+ * @param map ID map
+ * @param key Entity ID
+ * @return Value pointer or NULL if not found
+ */
+void* id_map_get(const IdMap* map, uint32_t key);
+
+/**
+ * Insert or update an index value
+ *
+ * @param map ID map
+ * @param key Entity ID
+ * @param index Array index
+ * @return true on success
+ */
+bool id_map_put_index(IdMap* map, uint32_t key, size_t index);
+
+/**
+ * Get an index value by key
+ *
+ * @param map ID map
+ * @param key Entity ID
+ * @param index_out Output index (may be NULL)
+ * @return true if key exists
+ */
+bool id_map_get_index(const IdMap* map, uint32_t key, size_t* index_out);
+
+/**
+ * Check if key exists
+ *
+ * @param map ID map
+ * @param key Entity ID
+ * @return true if key exists
+ */
+bool id_map_contains(const IdMap* map, uint32_t key);
+
+/**
+ * Remove a key
+ *
+ * @param map ID map
+ * @param key Entity ID
+ * @return true if key was present
+ */
+bool id_map_remove(IdMap* map, uint32_t key);
+
+/**
+ * Clear all entries (keeps capacity)
+ *
+ * @param map ID map
+ */
+void id_map_clear(IdMap* map);
+
+/**
+ * Reserve room for at least count entries without rehashing
+ *
+ * @param map ID map
+ * @param count Expected number of entries
+ * @return true on success
+ */
+bool id_map_reserve(IdMap* map, size_t count);
+
+/**
+ * Get number of entries
+ *
+ * @param map ID map
+ * @return Entry count
+ */
+size_t id_map_size(const IdMap* map);
+
+/**
+ * Get capacity (number of slots)
+ *
+ * @param map ID map
+ * @return Current capacity
+ */
+size_t id_map_capacity(const IdMap* map);
+
+/**
+ * Iterate over all entries (unspecified order)
+ * The map must not be modified during iteration.
+ *
+ * @param map ID map
+ * @param iterator Callback function (index maps receive the index cast to void*)
+ * @param userdata User data passed to callback
+ */
+void id_map_foreach(const IdMap* map, IdMapIterator iterator, void* userdata);
+
+#endif /* ID_MAP_H */
@@ -0,0 +1,274 @@
+#include "utils/rng.h"
+#include <string.h>
+#include <math.h>
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void rng_seed(Rng* rng, uint64_t seed) {
+    if (!rng) return;
+
+    /* splitmix64 never yields four zero words, which xoshiro cannot leave */
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = splitmix64(&seed);
+    }
+}
+
+/* Per-thread subsystem streams */
+static _Thread_local Rng g_streams[RNG_STREAM_COUNT];
+static _Thread_local uint64_t g_streams_seed = RNG_DEFAULT_SEED;
+static _Thread_local bool g_streams_seeded = false;
+
+void rng_seed_stream(Rng* rng, uint64_t seed, uint32_t stream) {
+    if (!rng) return;
+
+    rng_seed(rng, seed);
+    for (uint32_t i = 0; i < stream; i++) {
+        rng_jump(rng);
+    }
+}
+
+void rng_jump(Rng* rng) {
+    static const uint64_t JUMP[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+
+    if (!rng) return;
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (JUMP[i] & ((uint64_t)1 << b)) {
+                s0 ^= rng->s[0];
+                s1 ^= rng->s[1];
+                s2 ^= rng->s[2];
+                s3 ^= rng->s[3];
+            }
+            rng_next_u64(rng);
+        }
+    }
+
+    rng->s[0] = s0;
+    rng->s[1] = s1;
+    rng->s[2] = s2;
+    rng->s[3] = s3;
+}
+
+void rng_split(Rng* parent, Rng* child) {
+    if (!parent || !child) return;
+
+    *child = *parent;
+    rng_jump(parent);
+}
+
+uint64_t rng_next_u64(Rng* rng) {
+    uint64_t* s = rng->s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+
+    return result;
+}
+
+uint32_t rng_next_u32(Rng* rng) {
+    /* High bits of xoshiro256** are the strongest */
+    return (uint32_t)(rng_next_u64(rng) >> 32);
+}
+
+uint32_t rng_range(Rng* rng, uint32_t bound) {
+    if (bound == 0) return 0;
+
+    uint64_t m = (uint64_t)rng_next_u32(rng) * bound;
+    uint32_t low = (uint32_t)m;
+    if (low < bound) {
+        /* Reject the few values that would bias the low outcomes */
+        uint32_t threshold = (uint32_t)(-bound) % bound;
+        while (low < threshold) {
+            m = (uint64_t)rng_next_u32(rng) * bound;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+double rng_double(Rng* rng) {
+    return (double)(rng_next_u64(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+bool rng_chance(Rng* rng, uint32_t percent) {
+    if (percent >= 100) return true;
+    return rng_range(rng, 100) < percent;
+}
+
+double rng_normal(Rng* rng) {
+    /* Box-Muller; 1 - u keeps the logarithm finite */
+    double u = 1.0 - rng_double(rng);
+    double v = rng_double(rng);
+    return sqrt(-2.0 * log(u)) * cos(6.283185307179586 * v);
+}
+
+uint64_t rng_poisson(Rng* rng, double mean) {
+    if (!(mean > 0.0)) return 0;
+
+    if (mean < 10.0) {
+        /* Count uniforms until their product drops below e^-mean */
+        double limit = exp(-mean);
+        double product = rng_double(rng);
+        uint64_t count = 0;
+        while (product > limit) {
+            product *= rng_double(rng);
+            count++;
+        }
+        return count;
+    }
+
+    /* PTRS: W. Hormann, "The transformed rejection method for generating
+     * Poisson random variables", 1993 */
+    double slam = sqrt(mean);
+    double loglam = log(mean);
+    double b = 0.931 + 2.53 * slam;
+    double a = -0.059 + 0.02483 * b;
+    double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+    double vr = 0.9277 - 3.6224 / (b - 2.0);
+
+    for (;;) {
+        double u = rng_double(rng) - 0.5;
+        double v = rng_double(rng);
+        double us = 0.5 - fabs(u);
+        double k = floor((2.0 * a / us + b) * u + mean + 0.43);
+
+        if (us >= 0.07 && v <= vr) {
+            return (uint64_t)k;
+        }
+        if (k < 0.0 || (us < 0.013 && v > us)) {
+            continue;
+        }
+        if (log(v) + log(inv_alpha) - log(a / (us * us) + b) <=
+            -mean + k * loglam - lgamma(k + 1.0)) {
+            return (uint64_t)k;
+        }
+    }
+}
+
+void rng_streams_seed(uint64_t game_seed) {
+    for (uint32_t i = 0; i < RNG_STREAM_COUNT; i++) {
+        rng_seed_stream(&g_streams[i], game_seed, i);
+    }
+    g_streams_seed = game_seed;
+    g_streams_seeded = true;
+}
+
+uint64_t rng_streams_get_seed(void) {
+    return g_streams_seed;
+}
+
+void rng_streams_get_state(Rng states[RNG_STREAM_COUNT]) {
+    if (!g_streams_seeded) {
+        rng_streams_seed(RNG_DEFAULT_SEED);
+    }
+    memcpy(states, g_streams, sizeof(g_streams));
+}
+
+void rng_streams_set_state(uint64_t game_seed, const Rng states[RNG_STREAM_COUNT]) {
+    memcpy(g_streams, states, sizeof(g_streams));
+    g_streams_seed = game_seed;
+    g_streams_seeded = true;
+}
+
+Rng* rng_stream(RngStream stream) {
+    if (!g_streams_seeded) {
+        rng_streams_seed(RNG_DEFAULT_SEED);
+    }
+    if ((unsigned)stream >= RNG_STREAM_COUNT) {
+        stream = (RngStream)(RNG_STREAM_COUNT - 1);
+    }
+    return &g_streams[stream];
+}
+
+bool alias_table_build(AliasTable* table, const uint32_t* weights, size_t count) {
+    if (!table || !weights || count == 0 || count > RNG_ALIAS_MAX) return false;
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += weights[i];
+    }
+    /* Thresholds are scaled by 2^32 / sum; keep that product in 64 bits */
+    if (sum == 0 || sum > UINT32_MAX) return false;
+
+    /*
+     * Vose's method in exact integer arithmetic: each outcome's weight is
+     * scaled by count so the average column holds exactly sum.
+     */
+    uint64_t scaled[RNG_ALIAS_MAX];
+    uint8_t small[RNG_ALIAS_MAX];
+    uint8_t large[RNG_ALIAS_MAX];
+    size_t small_count = 0;
+    size_t large_count = 0;
+
+    memset(table, 0, sizeof(AliasTable));
+    table->count = (uint32_t)count;
+
+    for (size_t i = 0; i < count; i++) {
+        scaled[i] = (uint64_t)weights[i] * count;
+        if (scaled[i] < sum) {
+            small[small_count++] = (uint8_t)i;
+        } else {
+            large[large_count++] = (uint8_t)i;
+        }
+    }
+
+    while (small_count > 0 && large_count > 0) {
+        uint8_t s = small[--small_count];
+        uint8_t l = large[large_count - 1];
+
+        table->threshold[s] = (scaled[s] << 32) / sum;
+        table->alias[s] = l;
+
+        /* The large outcome donates the rest of column s */
+        scaled[l] -= sum - scaled[s];
+        if (scaled[l] < sum) {
+            large_count--;
+            small[small_count++] = l;
+        }
+    }
+
+    /* Whatever remains fills its own column */
+    while (large_count > 0) {
+        uint8_t l = large[--large_count];
+        table->threshold[l] = (uint64_t)1 << 32;
+        table->alias[l] = l;
+    }
+    while (small_count > 0) {
+        uint8_t s = small[--small_count];
+        table->threshold[s] = (uint64_t)1 << 32;
+        table->alias[s] = s;
+    }
+
+    return true;
+}
+
+uint32_t alias_table_sample(const AliasTable* table, Rng* rng) {
+    if (!table || table->count == 0) return 0;
+
+    /* High half picks the column, low half decides column vs alias */
+    uint64_t bits = rng_next_u64(rng);
+    uint32_t column = (uint32_t)(((bits >> 32) * table->count) >> 32);
+    uint32_t coin = (uint32_t)bits;
+
+    return coin < table->threshold[column] ? column : table->alias[column];
+}
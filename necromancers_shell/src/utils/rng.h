@@ -0,0 +1,235 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * RNG - fast seedable pseudo-random generator
+ *
+ * xoshiro256** generator with explicit state, so every subsystem can own
+ * its own reproducible stream instead of sharing the C library's global
+ * rand(). Seeding expands a single 64-bit seed with splitmix64.
+ *
+ * Game code draws from named per-subsystem streams (rng_stream()), all
+ * derived from one game seed by jumping the generator 2^128 steps per
+ * stream, so the streams never overlap and adding draws to one subsystem
+ * does not shift the others. The stream table is thread-local: each
+ * worker thread seeds its own (e.g. with rng_streams_seed()) and never
+ * touches another thread's state.
+ *
+ * Also provides Walker/Vose alias tables for drawing from a small fixed
+ * discrete distribution in constant time per sample.
+ *
+ * Usage:
+ *   rng_streams_seed(game_seed);
+ *   bool crit = rng_chance(rng_stream(RNG_STREAM_COMBAT), 10);
+ *
+ *   Rng rng;
+ *   rng_seed(&rng, 12345);
+ *   uint32_t roll = rng_range(&rng, 100);     // 0..99
+ *
+ *   uint32_t weights[] = {70, 20, 10};
+ *   AliasTable table;
+ *   alias_table_build(&table, weights, 3);
+ *   uint32_t pick = alias_table_sample(&table, &rng);
+ */
+
+/* Generator state; treat as opaque */
+typedef struct {
+    uint64_t s[4];
+} Rng;
+
+/* Named random streams, one per subsystem */
+typedef enum {
+    RNG_STREAM_HARVEST,        /* Soul harvesting */
+    RNG_STREAM_DEATH_NETWORK,  /* Death events and corpse quality */
+    RNG_STREAM_COMBAT,         /* Initiative, critical hits, fleeing */
+    RNG_STREAM_AI,             /* Enemy target selection */
+    RNG_STREAM_ENCOUNTER,      /* Encounter generation */
+    RNG_STREAM_WORLD,          /* Travel and network operations */
+    RNG_STREAM_NARRATIVE,      /* Story systems and trials */
+    RNG_STREAM_MINIONS,        /* Minion creation */
+    RNG_STREAM_COUNT
+} RngStream;
+
+/* Seed used by threads that draw before calling rng_streams_seed() */
+#define RNG_DEFAULT_SEED 0x4E45435253484CULL
+
+/* Maximum number of outcomes in an alias table */
+#define RNG_ALIAS_MAX 32
+
+/* Alias table for a discrete distribution */
+typedef struct {
+    uint32_t count;                     /* Number of outcomes (0 = empty) */
+    uint64_t threshold[RNG_ALIAS_MAX];  /* Keep-probability scaled to 2^32 */
+    uint8_t alias[RNG_ALIAS_MAX];       /* Outcome used when not kept */
+} AliasTable;
+
+/**
+ * Seed a generator
+ *
+ * Equal seeds produce equal sequences on every platform.
+ *
+ * @param rng Generator to seed
+ * @param seed Any 64-bit value (0 is fine)
+ */
+void rng_seed(Rng* rng, uint64_t seed);
+
+/**
+ * Seed one of several non-overlapping streams from a shared seed
+ *
+ * Stream n starts 2^128 * n steps after stream 0 of the same seed.
+ *
+ * @param rng Generator to seed
+ * @param seed Shared seed
+ * @param stream Stream number
+ */
+void rng_seed_stream(Rng* rng, uint64_t seed, uint32_t stream);
+
+/**
+ * Advance a generator by 2^128 steps
+ *
+ * @param rng Generator
+ */
+void rng_jump(Rng* rng);
+
+/**
+ * Split off an independent generator
+ *
+ * The child takes over the parent's current sequence and the parent
+ * jumps ahead 2^128 steps, so the two never overlap. Useful for handing
+ * a private stream to a worker.
+ *
+ * @param parent Generator to split (advanced)
+ * @param child Output generator
+ */
+void rng_split(Rng* parent, Rng* child);
+
+/**
+ * Next 64 random bits
+ *
+ * @param rng Generator
+ * @return Uniform 64-bit value
+ */
+uint64_t rng_next_u64(Rng* rng);
+
+/**
+ * Next 32 random bits
+ *
+ * @param rng Generator
+ * @return Uniform 32-bit value
+ */
+uint32_t rng_next_u32(Rng* rng);
+
+/**
+ * Uniform integer in [0, bound)
+ *
+ * Unbiased (Lemire's multiply-and-reject method).
+ *
+ * @param rng Generator
+ * @param bound Exclusive upper bound (0 returns 0)
+ * @return Value in [0, bound)
+ */
+uint32_t rng_range(Rng* rng, uint32_t bound);
+
+/**
+ * Uniform double in [0, 1)
+ *
+ * @param rng Generator
+ * @return Value with 53 random bits
+ */
+double rng_double(Rng* rng);
+
+/**
+ * True with the given percent chance
+ *
+ * @param rng Generator
+ * @param percent Chance in percent (0 never, 100 or more always)
+ * @return true with probability percent / 100
+ */
+bool rng_chance(Rng* rng, uint32_t percent);
+
+/**
+ * Standard normal deviate (mean 0, variance 1)
+ *
+ * @param rng Generator
+ * @return Normally distributed value
+ */
+double rng_normal(Rng* rng);
+
+/**
+ * Poisson-distributed count
+ *
+ * Exact for every mean: multiplication of uniforms below 10, Hormann's
+ * transformed rejection (PTRS) above, so the cost stays constant for
+ * large means.
+ *
+ * @param rng Generator
+ * @param mean Expected count (0 or less returns 0)
+ * @return Count with the given mean
+ */
+uint64_t rng_poisson(Rng* rng, double mean);
+
+/**
+ * Seed this thread's subsystem streams from a game seed
+ *
+ * @param game_seed Game seed
+ */
+void rng_streams_seed(uint64_t game_seed);
+
+/**
+ * Seed this thread's streams were last seeded with
+ *
+ * @return Game seed (RNG_DEFAULT_SEED if never seeded)
+ */
+uint64_t rng_streams_get_seed(void);
+
+/**
+ * Copy this thread's subsystem streams, e.g. into a save file
+ *
+ * @param states Output, one generator per RngStream
+ */
+void rng_streams_get_state(Rng states[RNG_STREAM_COUNT]);
+
+/**
+ * Resume this thread's subsystem streams where rng_streams_get_state left them
+ *
+ * @param game_seed Seed the streams were originally seeded with
+ * @param states One generator per RngStream
+ */
+void rng_streams_set_state(uint64_t game_seed, const Rng states[RNG_STREAM_COUNT]);
+
+/**
+ * Get this thread's generator for a subsystem
+ *
+ * @param stream Subsystem stream (out-of-range values map to the last stream)
+ * @return Generator, valid for the lifetime of the thread
+ */
+Rng* rng_stream(RngStream stream);
+
+/**
+ * Build an alias table from integer weights
+ *
+ * Outcome i is drawn with probability weights[i] / sum(weights).
+ *
+ * @param table Table to fill
+ * @param weights Non-negative weights
+ * @param count Number of outcomes (1..RNG_ALIAS_MAX)
+ * @return true on success, false if count is out of range or all weights are 0
+ */
+bool alias_table_build(AliasTable* table, const uint32_t* weights, size_t count);
+
+/**
+ * Draw an outcome from an alias table
+ *
+ * Uses a single 64-bit draw per sample.
+ *
+ * @param table Built alias table
+ * @param rng Generator
+ * @return Outcome index in [0, table->count), or 0 for an empty table
+ */
+uint32_t alias_table_sample(const AliasTable* table, Rng* rng);
+
+#endif /* RNG_H */
@@ -0,0 +1,295 @@
+/**
+ * Event Trace Tests
+ */
+
+#include "core/event_trace.h"
+#include "core/events.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test results */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) \
+    printf("Running test: %s\n", #name); \
+    tests_run++; \
+    if (test_##name()) { \
+        tests_passed++; \
+        printf("  ✓ PASSED\n"); \
+    } else { \
+        printf("  ✗ FAILED\n"); \
+    }
+
+#define TRACE_PATH "test_event_trace.trace"
+
+static EventTraceRecord make_record(uint64_t time_ns, uint16_t type, uint8_t kind) {
+    EventTraceRecord record = {0};
+    record.time_ns = time_ns;
+    record.type = type;
+    record.kind = kind;
+    record.batch_size = 1;
+    return record;
+}
+
+/* Test: Records survive a flush and load in order */
+static bool test_round_trip(void) {
+    EventTrace* trace = event_trace_create(TRACE_PATH, 1000);
+    if (!trace) return false;
+
+    for (uint64_t i = 0; i < 300; i++) {
+        EventTraceRecord record = make_record(i * 10, (uint16_t)(i % 3), EVENT_TRACE_DISPATCHED);
+        record.latency_ns = i;
+        record.payload_bytes = (uint32_t)i * 2;
+        event_trace_record(trace, &record);
+    }
+    bool ok = event_trace_get_recorded(trace) == 300;
+    event_trace_destroy(trace);
+
+    EventTraceRecord* records = NULL;
+    size_t count = 0;
+    uint64_t overwritten = 99;
+    ok = ok && event_trace_load(TRACE_PATH, &records, &count, &overwritten);
+    ok = ok && count == 300 && overwritten == 0;
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = records[i].time_ns == i * 10 && records[i].latency_ns == i &&
+             records[i].payload_bytes == i * 2 && records[i].type == i % 3 &&
+             records[i].kind == EVENT_TRACE_DISPATCHED;
+    }
+    free(records);
+
+    /* Missing and foreign files are rejected */
+    ok = ok && !event_trace_load("does_not_exist.trace", &records, &count, NULL);
+    FILE* junk = fopen(TRACE_PATH, "wb");
+    if (junk) {
+        fputs("not a trace file at all, just some text", junk);
+        fclose(junk);
+    }
+    ok = ok && !event_trace_load(TRACE_PATH, &records, &count, NULL);
+
+    remove(TRACE_PATH);
+    return ok;
+}
+
+/* Test: A full ring keeps the newest records, oldest first */
+static bool test_wraparound(void) {
+    EventTrace* trace = event_trace_create(TRACE_PATH, 100);
+    if (!trace) return false;
+
+    /* Several flushes that straddle the ring end */
+    for (uint64_t i = 0; i < 1234; i++) {
+        EventTraceRecord record = make_record(i, 1, EVENT_TRACE_PUBLISHED);
+        event_trace_record(trace, &record);
+        if (i % 77 == 0) event_trace_flush(trace);
+    }
+    event_trace_destroy(trace);
+
+    EventTraceRecord* records = NULL;
+    size_t count = 0;
+    uint64_t overwritten = 0;
+    bool ok = event_trace_load(TRACE_PATH, &records, &count, &overwritten);
+    ok = ok && count == 100 && overwritten == 1134;
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = records[i].time_ns == 1134 + i;
+    }
+    free(records);
+
+    remove(TRACE_PATH);
+    return ok;
+}
+
+/* Test: Latency buckets double from 1 us */
+static bool test_latency_buckets(void) {
+    bool ok = event_trace_latency_bucket(0) == 0;
+    ok = ok && event_trace_latency_bucket(999) == 0;
+    ok = ok && event_trace_latency_bucket(1000) == 1;
+    ok = ok && event_trace_latency_bucket(1999) == 1;
+    ok = ok && event_trace_latency_bucket(2000) == 2;
+    ok = ok && event_trace_latency_bucket(1000000) == 10;
+    ok = ok && event_trace_latency_bucket(UINT64_MAX) == EVENT_TRACE_BUCKETS - 1;
+    return ok;
+}
+
+/* Test: Summaries count kinds per type, busiest type first */
+static bool test_summarize(void) {
+    EventTraceRecord records[8];
+    records[0] = make_record(100, 7, EVENT_TRACE_PUBLISHED);
+    records[1] = make_record(200, 3, EVENT_TRACE_DISPATCHED);
+    records[2] = make_record(300, 3, EVENT_TRACE_DISPATCHED);
+    records[3] = make_record(400, 3, EVENT_TRACE_COALESCED);
+    records[4] = make_record(500, 7, EVENT_TRACE_DISPATCHED);
+    records[5] = make_record(600, 3, EVENT_TRACE_DISPATCHED);
+    records[6] = make_record(700, 9, EVENT_TRACE_PUBLISHED);
+    records[7] = make_record(800, 3, EVENT_TRACE_PUBLISHED);
+
+    records[1].latency_ns = 500;
+    records[2].latency_ns = 1500;
+    records[5].latency_ns = 40000;
+    records[4].latency_ns = 3000;
+
+    /* Batch of two splits its delivery time */
+    records[1].duration_ns = 800;
+    records[1].batch_size = 2;
+    records[2].duration_ns = 800;
+    records[2].batch_size = 2;
+
+    EventTraceTypeStats stats[2];
+    size_t types = event_trace_summarize(records, 8, stats, 2);
+
+    bool ok = types == 2;
+    ok = ok && stats[0].type == 3 && stats[0].count == 5;
+    ok = ok && stats[0].published == 1 && stats[0].dispatched == 3 && stats[0].coalesced == 1;
+    ok = ok && stats[0].latency_buckets[0] == 1 && stats[0].latency_buckets[1] == 1;
+    ok = ok && stats[0].latency_buckets[event_trace_latency_bucket(40000)] == 1;
+    ok = ok && stats[0].latency_total_ns == 42000 && stats[0].latency_max_ns == 40000;
+    ok = ok && stats[0].delivery_total_ns == 800;
+    ok = ok && stats[0].first_ns == 200 && stats[0].last_ns == 800;
+    ok = ok && stats[1].type == 7 && stats[1].count == 2 && stats[1].dispatched == 1;
+
+    ok = ok && event_trace_summarize(records, 8, stats, 0) == 0;
+    return ok;
+}
+
+/* Subscriber counting deliveries */
+static void count_event(const Event* event, void* userdata) {
+    (void)event;
+    (*(int*)userdata)++;
+}
+
+/* Test: An attached bus records published, dispatched and coalesced events */
+static bool test_bus_integration(void) {
+    EventBus* bus = event_bus_create();
+    EventTrace* trace = event_trace_create(TRACE_PATH, 0);
+    if (!bus || !trace) {
+        event_bus_destroy(bus);
+        event_trace_destroy(trace);
+        return false;
+    }
+
+    int delivered = 0;
+    event_bus_subscribe(bus, EVENT_PLAYER_MOVE, count_event, &delivered);
+    event_bus_subscribe(bus, EVENT_PLAYER_MOVE, count_event, &delivered);
+    event_bus_subscribe(bus, EVENT_COMBAT_START, count_event, &delivered);
+    event_bus_set_coalescing(bus, EVENT_COMBAT_START, true, sizeof(int));
+
+    /* Not attached yet: nothing recorded */
+    EVENT_PUBLISH_SIMPLE(bus, EVENT_PLAYER_MOVE);
+    event_bus_set_trace(bus, trace);
+
+    int ids[] = { 1, 2, 1, 1 };
+    EVENT_PUBLISH_SIMPLE(bus, EVENT_PLAYER_MOVE);
+    EVENT_QUEUE_SIMPLE(bus, EVENT_PLAYER_MOVE);
+    for (int i = 0; i < 4; i++) {
+        EVENT_QUEUE_DATA(bus, EVENT_COMBAT_START, &ids[i]);
+    }
+    event_bus_dispatch(bus);
+
+    event_bus_set_trace(bus, NULL);
+    EVENT_PUBLISH_SIMPLE(bus, EVENT_PLAYER_MOVE);
+    bool ok = delivered == 2 + 2 + 2 + 2 + 2;
+    ok = ok && event_trace_get_recorded(trace) == 6;
+    event_trace_destroy(trace);
+    event_bus_destroy(bus);
+
+    EventTraceRecord* records = NULL;
+    size_t count = 0;
+    ok = ok && event_trace_load(TRACE_PATH, &records, &count, NULL);
+    ok = ok && count == 6;
+
+    int published = 0, dispatched = 0, coalesced = 0;
+    for (size_t i = 0; ok && i < count; i++) {
+        const EventTraceRecord* r = &records[i];
+        ok = i == 0 || r->time_ns >= records[i - 1].time_ns;
+        if (r->kind == EVENT_TRACE_PUBLISHED) {
+            published++;
+            ok = ok && r->type == EVENT_PLAYER_MOVE && r->subscribers == 2 && r->latency_ns == 0;
+        } else if (r->kind == EVENT_TRACE_DISPATCHED) {
+            dispatched++;
+            ok = ok && (r->type == EVENT_PLAYER_MOVE ? r->subscribers == 2 && r->batch_size == 1
+                                                      : r->subscribers == 1 && r->batch_size == 2);
+        } else if (r->kind == EVENT_TRACE_COALESCED) {
+            coalesced++;
+            ok = ok && r->type == EVENT_COMBAT_START && r->payload_bytes == sizeof(int);
+        }
+    }
+    ok = ok && published == 1 && dispatched == 3 && coalesced == 2;
+    free(records);
+
+    remove(TRACE_PATH);
+    return ok;
+}
+
+/* Publishes GAME_PAUSE while GAME_START is being dispatched */
+static void publish_pause(const Event* event, void* userdata) {
+    (void)event;
+    EVENT_PUBLISH_SIMPLE((EventBus*)userdata, EVENT_GAME_PAUSE);
+}
+
+/* Test: Events published from a callback load in time order */
+static bool test_nested_publish(void) {
+    EventBus* bus = event_bus_create();
+    EventTrace* trace = event_trace_create(TRACE_PATH, 0);
+    if (!bus || !trace) {
+        event_bus_destroy(bus);
+        event_trace_destroy(trace);
+        return false;
+    }
+
+    int paused = 0;
+    event_bus_subscribe(bus, EVENT_GAME_START, publish_pause, bus);
+    event_bus_subscribe(bus, EVENT_GAME_PAUSE, count_event, &paused);
+    event_bus_set_trace(bus, trace);
+
+    for (int i = 0; i < 3; i++) {
+        EVENT_QUEUE_SIMPLE(bus, EVENT_GAME_START);
+        event_bus_dispatch(bus);
+    }
+
+    event_bus_set_trace(bus, NULL);
+    event_trace_destroy(trace);
+    event_bus_destroy(bus);
+
+    EventTraceRecord* records = NULL;
+    size_t count = 0;
+    bool ok = paused == 3 && event_trace_load(TRACE_PATH, &records, &count, NULL);
+    ok = ok && count == 6;
+
+    /* Each batch starts before the publish its callback made */
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = i == 0 || records[i].time_ns >= records[i - 1].time_ns;
+        ok = ok && records[i].type == (i % 2 == 0 ? EVENT_GAME_START : EVENT_GAME_PAUSE);
+    }
+
+    EventTraceTypeStats stats[2];
+    ok = ok && event_trace_summarize(records, count, stats, 2) == 2;
+    ok = ok && stats[0].last_ns >= stats[0].first_ns && stats[1].last_ns >= stats[1].first_ns;
+    free(records);
+
+    remove(TRACE_PATH);
+    return ok;
+}
+
+int main(void) {
+    logger_init("test_event_trace.log", LOG_LEVEL_DEBUG);
+
+    printf("=====================================\n");
+    printf("Event Trace Tests\n");
+    printf("=====================================\n\n");
+
+    TEST(round_trip);
+    TEST(wraparound);
+    TEST(latency_buckets);
+    TEST(summarize);
+    TEST(bus_integration);
+    TEST(nested_publish);
+
+    printf("\n=====================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("=====================================\n");
+
+    logger_shutdown();
+
+    return (tests_passed == tests_run) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
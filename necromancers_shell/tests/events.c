@@ -7,6 +7,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
 
 /* Test results */
 static int tests_run = 0;
@@ -382,6 +385,329 @@ static bool test_queue_growth(void) {
     return true;
 }
 
+/* Payload checked byte by byte on delivery */
+typedef struct {
+    int delivered;
+    int corrupt;
+} PayloadCheck;
+
+static void check_payload(const Event* event, void* userdata) {
+    PayloadCheck* check = userdata;
+    const unsigned char* bytes = event->data;
+    check->delivered++;
+    for (size_t i = 0; i < event->data_size; i++) {
+        if (bytes[i] != (unsigned char)(event->data_size + i)) {
+            check->corrupt++;
+            return;
+        }
+    }
+}
+
+/* Test: Inline, frame and oversized payloads arrive intact */
+static bool test_payload_sizes(void) {
+    EventBus* bus = event_bus_create();
+    if (!bus) return false;
+
+    PayloadCheck check = {0};
+    event_bus_subscribe(bus, EVENT_SAVE_GAME, check_payload, &check);
+
+    static unsigned char buffer[100000];
+    size_t sizes[] = { 1, EVENT_INLINE_PAYLOAD, EVENT_INLINE_PAYLOAD + 1, 500, 40000, 100000 };
+    size_t size_count = sizeof(sizes) / sizeof(sizes[0]);
+    int queued = 0;
+    bool ok = true;
+
+    /* Several rounds so both payload frames fill up and get reused */
+    for (int round = 0; round < 4; round++) {
+        for (int repeat = 0; repeat < 40; repeat++) {
+            for (size_t s = 0; s < size_count; s++) {
+                for (size_t i = 0; i < sizes[s]; i++) {
+                    buffer[i] = (unsigned char)(sizes[s] + i);
+                }
+                ok = ok && event_bus_queue(bus, EVENT_SAVE_GAME, buffer, sizes[s]);
+                queued++;
+            }
+        }
+        event_bus_dispatch(bus);
+    }
+
+    ok = ok && check.delivered == queued && check.corrupt == 0;
+
+    /* Queued but never dispatched payloads are released by destroy */
+    event_bus_queue(bus, EVENT_SAVE_GAME, buffer, 100000);
+    event_bus_queue(bus, EVENT_SAVE_GAME, buffer, 500);
+    event_bus_destroy(bus);
+    return ok;
+}
+
+/* Test: Full queue refuses events until dispatched */
+static bool test_queue_full(void) {
+    EventBus* bus = event_bus_create();
+    if (!bus) return false;
+
+    reset_callback_tracking();
+    event_bus_subscribe(bus, EVENT_UI_TEXT_INPUT, test_callback, NULL);
+
+    int accepted = 0;
+    for (int i = 0; i < 2000; i++) {
+        if (event_bus_queue(bus, EVENT_UI_TEXT_INPUT, &i, sizeof(i))) accepted++;
+    }
+
+    bool ok = accepted == 1024 && event_bus_queue_size(bus) == 1024;
+    event_bus_dispatch(bus);
+    ok = ok && g_callback_count == 1024 && event_bus_queue_size(bus) == 0;
+    ok = ok && event_bus_queue(bus, EVENT_UI_TEXT_INPUT, &accepted, sizeof(accepted));
+
+    event_bus_destroy(bus);
+    return ok;
+}
+
+#define PRODUCERS 4
+#define EVENTS_PER_PRODUCER 20000
+
+/* Producer payload; every third event is too large to go inline */
+typedef struct {
+    int producer;
+    int sequence;
+    unsigned char padding[120];
+} ProducerEvent;
+
+typedef struct {
+    EventBus* bus;
+    int producer;
+} ProducerArgs;
+
+typedef struct {
+    int next[PRODUCERS];
+    int out_of_order;
+    int received;
+} ConsumerLog;
+
+static void* producer_thread(void* arg) {
+    ProducerArgs* args = arg;
+    ProducerEvent event;
+    memset(&event, 0, sizeof(event));
+    event.producer = args->producer;
+
+    for (int i = 0; i < EVENTS_PER_PRODUCER; i++) {
+        event.sequence = i;
+        event.padding[119] = (unsigned char)i;
+        size_t size = (i % 3 == 0) ? sizeof(event) : 2 * sizeof(int);
+
+        /* Spin while the consumer catches up */
+        while (!event_bus_queue(args->bus, EVENT_RELATIONSHIP_CHANGED, &event, size)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void consume_event(const Event* event, void* userdata) {
+    ConsumerLog* log = userdata;
+    const ProducerEvent* data = event->data;
+
+    if (data->sequence != log->next[data->producer]) log->out_of_order++;
+    if (event->data_size == sizeof(ProducerEvent) &&
+        data->padding[119] != (unsigned char)data->sequence) {
+        log->out_of_order++;
+    }
+    log->next[data->producer] = data->sequence + 1;
+    log->received++;
+}
+
+/* Test: Concurrent producers, each producer's events arrive in order */
+static bool test_multi_producer(void) {
+    EventBus* bus = event_bus_create();
+    if (!bus) return false;
+
+    ConsumerLog log = {0};
+    event_bus_subscribe(bus, EVENT_RELATIONSHIP_CHANGED, consume_event, &log);
+
+    pthread_t threads[PRODUCERS];
+    ProducerArgs args[PRODUCERS];
+    for (int p = 0; p < PRODUCERS; p++) {
+        args[p].bus = bus;
+        args[p].producer = p;
+        pthread_create(&threads[p], NULL, producer_thread, &args[p]);
+    }
+
+    while (log.received < PRODUCERS * EVENTS_PER_PRODUCER) {
+        event_bus_dispatch(bus);
+    }
+    for (int p = 0; p < PRODUCERS; p++) {
+        pthread_join(threads[p], NULL);
+    }
+
+    bool ok = log.out_of_order == 0;
+    for (int p = 0; p < PRODUCERS; p++) {
+        ok = ok && log.next[p] == EVENTS_PER_PRODUCER;
+    }
+    ok = ok && event_bus_queue_size(bus) == 0;
+
+    event_bus_destroy(bus);
+    return ok;
+}
+
+/* Records delivery order across types and batches */
+typedef struct {
+    int values[64];
+    EventType types[64];
+    int count;
+    int batches;
+} DeliveryLog;
+
+static void log_event(const Event* event, void* userdata) {
+    DeliveryLog* log = userdata;
+    log->values[log->count] = event->data ? *(const int*)event->data : -1;
+    log->types[log->count++] = event->type;
+}
+
+static void log_batch(const Event* events, size_t count, void* userdata) {
+    DeliveryLog* log = userdata;
+    log->batches++;
+    for (size_t i = 0; i < count; i++) {
+        log_event(&events[i], userdata);
+    }
+}
+
+/* Test: Dispatch groups by type, batch subscribers get one call per type */
+static bool test_batched_dispatch(void) {
+    EventBus* bus = event_bus_create();
+    if (!bus) return false;
+
+    DeliveryLog single = {0};
+    DeliveryLog batched = {0};
+    event_bus_subscribe(bus, EVENT_QUEST_UPDATED, log_event, &single);
+    event_bus_subscribe(bus, EVENT_NPC_MET, log_event, &single);
+    event_bus_subscribe_batch(bus, EVENT_QUEST_UPDATED, log_batch, &batched);
+    event_bus_subscribe_batch(bus, EVENT_NPC_MET, log_batch, &batched);
+
+    /* Interleaved: quest 1, npc 2, quest 3, npc 4, quest 5 */
+    for (int i = 1; i <= 5; i++) {
+        EventType type = (i % 2) ? EVENT_QUEST_UPDATED : EVENT_NPC_MET;
+        event_bus_queue(bus, type, &i, sizeof(i));
+    }
+    event_bus_dispatch(bus);
+
+    /* Quest events first (queued first), each type in queue order */
+    int expected[5] = { 1, 3, 5, 2, 4 };
+    bool ok = single.count == 5 && batched.count == 5 && batched.batches == 2;
+    for (int i = 0; i < 5; i++) {
+        ok = ok && single.values[i] == expected[i] && batched.values[i] == expected[i];
+    }
+    ok = ok && batched.types[0] == EVENT_QUEST_UPDATED && batched.types[4] == EVENT_NPC_MET;
+
+    /* Publish hands batch subscribers a batch of one */
+    int value = 9;
+    event_bus_publish(bus, EVENT_NPC_MET, &value);
+    ok = ok && batched.batches == 3 && batched.values[5] == 9;
+
+    event_bus_destroy(bus);
+    return ok;
+}
+
+/* Relationship change keyed by NPC */
+typedef struct {
+    int npc_id;
+    int value;
+} RelationshipChange;
+
+static void log_relationship(const Event* event, void* userdata) {
+    DeliveryLog* log = userdata;
+    const RelationshipChange* change = event->data;
+    log->values[log->count] = change->npc_id * 100 + change->value;
+    log->types[log->count++] = event->type;
+}
+
+/* Test: Coalescing keeps the latest event per key */
+static bool test_coalescing(void) {
+    EventBus* bus = event_bus_create();
+    if (!bus) return false;
+
+    DeliveryLog log = {0};
+    event_bus_subscribe(bus, EVENT_RELATIONSHIP_CHANGED, log_relationship, &log);
+    event_bus_set_coalescing(bus, EVENT_RELATIONSHIP_CHANGED, true, sizeof(int));
+
+    RelationshipChange changes[] = { {1, 10}, {2, 20}, {1, 11}, {3, 30}, {1, 12}, {2, 21} };
+    for (size_t i = 0; i < 6; i++) {
+        EVENT_QUEUE_DATA(bus, EVENT_RELATIONSHIP_CHANGED, &changes[i]);
+    }
+    event_bus_dispatch(bus);
+
+    /* NPC 3 (pos 3), NPC 1 latest (pos 4), NPC 2 latest (pos 5) */
+    bool ok = log.count == 3;
+    ok = ok && log.values[0] == 330 && log.values[1] == 112 && log.values[2] == 221;
+
+    /* Whole-payload mode only merges identical events */
+    log.count = 0;
+    event_bus_set_coalescing(bus, EVENT_RELATIONSHIP_CHANGED, true, EVENT_COALESCE_PAYLOAD);
+    for (size_t i = 0; i < 6; i++) {
+        EVENT_QUEUE_DATA(bus, EVENT_RELATIONSHIP_CHANGED, &changes[i % 2]);
+    }
+    event_bus_dispatch(bus);
+    ok = ok && log.count == 2 && log.values[0] == 110 && log.values[1] == 220;
+
+    /* Off again: everything arrives */
+    log.count = 0;
+    event_bus_set_coalescing(bus, EVENT_RELATIONSHIP_CHANGED, false, 0);
+    for (size_t i = 0; i < 6; i++) {
+        EVENT_QUEUE_DATA(bus, EVENT_RELATIONSHIP_CHANGED, &changes[i]);
+    }
+    event_bus_dispatch(bus);
+    ok = ok && log.count == 6;
+
+    event_bus_destroy(bus);
+    return ok;
+}
+
+/* Subscriber that removes another subscription and adds a new one */
+typedef struct {
+    EventBus* bus;
+    size_t victim;
+    int calls;
+} Meddler;
+
+static void meddling_callback(const Event* event, void* userdata) {
+    (void)event;
+    Meddler* meddler = userdata;
+    if (meddler->calls++ == 0) {
+        event_bus_unsubscribe(meddler->bus, meddler->victim);
+        for (int i = 0; i < 10; i++) {
+            event_bus_subscribe(meddler->bus, EVENT_ENEMY_DIED, test_callback, NULL);
+        }
+    }
+}
+
+/* Test: Subscribing and unsubscribing from inside callbacks */
+static bool test_subscribe_during_dispatch(void) {
+    EventBus* bus = event_bus_create();
+    if (!bus) return false;
+
+    reset_callback_tracking();
+
+    /* Newest first: the meddler runs before the older victim */
+    Meddler meddler = { bus, 0, 0 };
+    meddler.victim = event_bus_subscribe(bus, EVENT_ENEMY_DIED, test_callback, NULL);
+    event_bus_subscribe(bus, EVENT_ENEMY_DIED, meddling_callback, &meddler);
+
+    for (int i = 0; i < 3; i++) {
+        EVENT_QUEUE_SIMPLE(bus, EVENT_ENEMY_DIED);
+    }
+    event_bus_dispatch(bus);
+
+    /* Victim never ran, new subscribers wait for the next delivery */
+    bool ok = meddler.calls == 3 && g_callback_count == 0;
+    ok = ok && event_bus_subscriber_count(bus, EVENT_ENEMY_DIED) == 11;
+    ok = ok && event_bus_total_subscriptions(bus) == 11;
+    ok = ok && !event_bus_unsubscribe(bus, meddler.victim);
+
+    event_bus_publish(bus, EVENT_ENEMY_DIED, NULL);
+    ok = ok && g_callback_count == 10;
+
+    event_bus_destroy(bus);
+    return ok;
+}
+
 int main(void) {
     /* Initialize logger for tests */
     logger_init("test_events.log", LOG_LEVEL_DEBUG);
@@ -402,6 +728,12 @@ int main(void) {
     TEST(total_subscriptions);
     TEST(event_names);
     TEST(queue_growth);
+    TEST(payload_sizes);
+    TEST(queue_full);
+    TEST(multi_producer);
+    TEST(batched_dispatch);
+    TEST(coalescing);
+    TEST(subscribe_during_dispatch);
 
     printf("\n=====================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
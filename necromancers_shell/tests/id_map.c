@@ -0,0 +1,186 @@
+/**
+ * ID Map Tests
+ */
+
+#include "utils/id_map.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test results */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) \
+    printf("Running test: %s\n", #name); \
+    tests_run++; \
+    if (test_##name()) { \
+        tests_passed++; \
+        printf("  ✓ PASSED\n"); \
+    } else { \
+        printf("  ✗ FAILED\n"); \
+    }
+
+/* Test: Create and destroy */
+static bool test_create_destroy(void) {
+    IdMap* map = id_map_create(10);
+    if (!map) return false;
+
+    bool ok = id_map_size(map) == 0 && id_map_capacity(map) >= 16;
+    id_map_destroy(map);
+    return ok;
+}
+
+/* Test: Pointer values */
+static bool test_put_get_pointer(void) {
+    IdMap* map = id_map_create(10);
+    if (!map) return false;
+
+    int value = 42;
+    bool ok = id_map_put(map, 7, &value);
+    int* retrieved = id_map_get(map, 7);
+    ok = ok && retrieved && *retrieved == 42;
+    ok = ok && id_map_get(map, 8) == NULL;
+
+    id_map_destroy(map);
+    return ok;
+}
+
+/* Test: Index values, including index 0 */
+static bool test_put_get_index(void) {
+    IdMap* map = id_map_create(10);
+    if (!map) return false;
+
+    bool ok = id_map_put_index(map, 100, 0) && id_map_put_index(map, 200, 5);
+
+    size_t index = 99;
+    ok = ok && id_map_get_index(map, 100, &index) && index == 0;
+    ok = ok && id_map_get_index(map, 200, &index) && index == 5;
+    ok = ok && !id_map_get_index(map, 300, &index);
+
+    /* Update existing key */
+    ok = ok && id_map_put_index(map, 200, 9);
+    ok = ok && id_map_get_index(map, 200, &index) && index == 9;
+    ok = ok && id_map_size(map) == 2;
+
+    id_map_destroy(map);
+    return ok;
+}
+
+/* Test: Growth past initial capacity with sequential IDs */
+static bool test_grow(void) {
+    IdMap* map = id_map_create(4);
+    if (!map) return false;
+
+    for (uint32_t i = 1; i <= 10000; i++) {
+        if (!id_map_put_index(map, i, i * 2)) {
+            id_map_destroy(map);
+            return false;
+        }
+    }
+
+    bool ok = id_map_size(map) == 10000;
+    for (uint32_t i = 1; i <= 10000 && ok; i++) {
+        size_t index;
+        ok = id_map_get_index(map, i, &index) && index == i * 2;
+    }
+
+    id_map_destroy(map);
+    return ok;
+}
+
+/* Test: Remove keeps other keys reachable */
+static bool test_remove(void) {
+    IdMap* map = id_map_create(16);
+    if (!map) return false;
+
+    /* Keys that share low bits stress the backward shift */
+    for (uint32_t i = 0; i < 64; i++) {
+        id_map_put_index(map, i << 16, i);
+    }
+
+    bool ok = true;
+    for (uint32_t i = 0; i < 64; i += 2) {
+        ok = ok && id_map_remove(map, i << 16);
+    }
+    ok = ok && !id_map_remove(map, 0);
+    ok = ok && id_map_size(map) == 32;
+
+    for (uint32_t i = 0; i < 64 && ok; i++) {
+        size_t index;
+        bool found = id_map_get_index(map, i << 16, &index);
+        ok = (i % 2 == 0) ? !found : (found && index == i);
+    }
+
+    id_map_destroy(map);
+    return ok;
+}
+
+/* Test: Clear and reserve */
+static bool test_clear_reserve(void) {
+    IdMap* map = id_map_create(16);
+    if (!map) return false;
+
+    for (uint32_t i = 0; i < 50; i++) {
+        id_map_put_index(map, i, i);
+    }
+    size_t capacity = id_map_capacity(map);
+    id_map_clear(map);
+
+    bool ok = id_map_size(map) == 0 && id_map_capacity(map) == capacity;
+    ok = ok && !id_map_contains(map, 10);
+
+    ok = ok && id_map_reserve(map, 1000);
+    ok = ok && id_map_capacity(map) * 7 / 8 >= 1000;
+
+    id_map_destroy(map);
+    return ok;
+}
+
+static void sum_callback(uint32_t key, void* value, void* userdata) {
+    size_t* sums = (size_t*)userdata;
+    sums[0] += key;
+    sums[1] += (size_t)(uintptr_t)value;
+}
+
+/* Test: Foreach visits every entry once */
+static bool test_foreach(void) {
+    IdMap* map = id_map_create(16);
+    if (!map) return false;
+
+    for (uint32_t i = 1; i <= 100; i++) {
+        id_map_put_index(map, i, i * 10);
+    }
+
+    size_t sums[2] = {0, 0};
+    id_map_foreach(map, sum_callback, sums);
+
+    id_map_destroy(map);
+    return sums[0] == 5050 && sums[1] == 50500;
+}
+
+int main(void) {
+    /* Initialize logger for tests */
+    logger_init("test_id_map.log", LOG_LEVEL_DEBUG);
+
+    printf("=====================================\n");
+    printf("ID Map Tests\n");
+    printf("=====================================\n\n");
+
+    TEST(create_destroy);
+    TEST(put_get_pointer);
+    TEST(put_get_index);
+    TEST(grow);
+    TEST(remove);
+    TEST(clear_reserve);
+    TEST(foreach);
+
+    printf("\n=====================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("=====================================\n");
+
+    logger_shutdown();
+
+    return (tests_passed == tests_run) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -8,6 +8,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
 
 /* Test results */
 static int tests_run = 0;
@@ -50,7 +52,7 @@ static bool test_alloc_free_single(void) {
 
 /* Test: Allocate multiple blocks */
 static bool test_alloc_multiple(void) {
-    MemoryPool* pool = pool_create(64, 5);
+    MemoryPool* pool = pool_create_bounded(64, 5, 5);
     if (!pool) return false;
 
     void* ptrs[5];
@@ -62,7 +64,7 @@ static bool test_alloc_multiple(void) {
         }
     }
 
-    /* Pool should be exhausted */
+    /* Bounded pool should be exhausted */
     void* extra = pool_alloc(pool);
     if (extra != NULL) {
         pool_destroy(pool);
@@ -243,6 +245,198 @@ static bool test_data_integrity(void) {
     return true;
 }
 
+/* Test: Pool grows by chaining slabs */
+static bool test_growth(void) {
+    MemoryPool* pool = pool_create(32, 4);
+    if (!pool) return false;
+
+    void* ptrs[100];
+    for (int i = 0; i < 100; i++) {
+        ptrs[i] = pool_alloc(pool);
+        if (!ptrs[i]) {
+            pool_destroy(pool);
+            return false;
+        }
+        memset(ptrs[i], i, 32);
+    }
+
+    MemoryStats stats;
+    pool_get_stats(pool, &stats);
+    bool ok = stats.allocated_blocks == 100 && stats.slab_count > 1 &&
+              stats.block_count >= 100;
+
+    /* Slabs double: 4, 8, 16, 32, 64 */
+    MemorySlabStats slabs[8];
+    size_t slab_count = pool_get_slab_stats(pool, slabs, 8);
+    ok = ok && slab_count == stats.slab_count && slabs[0].block_count == 4 &&
+         slabs[1].block_count == 8 && slabs[0].allocated_blocks == 4;
+
+    /* Earlier blocks must not have been clobbered by growth */
+    unsigned char* first = ptrs[0];
+    ok = ok && first[31] == 0;
+
+    for (int i = 0; i < 100; i++) {
+        pool_free(pool, ptrs[i]);
+    }
+
+    pool_get_stats(pool, &stats);
+    ok = ok && stats.allocated_blocks == 0 && stats.fragmentation == 0.0f;
+
+    pool_destroy(pool);
+    return ok;
+}
+
+/* Test: Fragmentation reflects sparse slabs */
+static bool test_fragmentation(void) {
+    MemoryPool* pool = pool_create(16, 4);
+    if (!pool) return false;
+
+    void* ptrs[4];
+    for (int i = 0; i < 4; i++) {
+        ptrs[i] = pool_alloc(pool);
+    }
+
+    MemoryStats stats;
+    pool_get_stats(pool, &stats);
+    bool ok = stats.fragmentation == 0.0f;
+
+    /* One live block in a 4-block slab: 75% of it is wasted */
+    for (int i = 1; i < 4; i++) {
+        pool_free(pool, ptrs[i]);
+    }
+    pool_get_stats(pool, &stats);
+    ok = ok && stats.fragmentation > 0.74f && stats.fragmentation < 0.76f;
+
+    pool_free(pool, ptrs[0]);
+    pool_destroy(pool);
+    return ok;
+}
+
+/* Worker for thread cache test */
+#define WORKER_ROUNDS 2000
+static void* cache_worker(void* arg) {
+    MemoryPool* pool = arg;
+    void* live[16];
+    for (int round = 0; round < WORKER_ROUNDS; round++) {
+        for (int i = 0; i < 16; i++) {
+            live[i] = pool_alloc(pool);
+            if (!live[i]) return (void*)1;
+            memset(live[i], round & 0xFF, 48);
+        }
+        for (int i = 0; i < 16; i++) {
+            pool_free(pool, live[i]);
+        }
+    }
+    pool_thread_cache_flush(pool);
+    return NULL;
+}
+
+/* Test: Per-thread magazine caches */
+static bool test_thread_cache(void) {
+    MemoryPool* pool = pool_create(48, 8);
+    if (!pool) return false;
+
+    if (!pool_enable_thread_cache(pool, 16)) {
+        pool_destroy(pool);
+        return false;
+    }
+
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, cache_worker, pool);
+    }
+
+    bool ok = true;
+    for (int i = 0; i < 4; i++) {
+        void* result = NULL;
+        pthread_join(threads[i], &result);
+        if (result != NULL) ok = false;
+    }
+
+    MemoryStats stats;
+    pool_get_stats(pool, &stats);
+    ok = ok && stats.allocated_blocks == 0 && stats.cached_blocks == 0 &&
+         stats.total_allocs == 4 * WORKER_ROUNDS * 16 &&
+         stats.total_frees == stats.total_allocs;
+
+    pool_destroy(pool);
+    return ok;
+}
+
+/* Worker that destroys a pool the main thread still has cached blocks in */
+static void* destroy_worker(void* arg) {
+    pool_destroy(arg);
+    return NULL;
+}
+
+/* Test: Pools destroyed on another thread give back this thread's slots */
+static bool test_thread_cache_recreate(void) {
+    bool ok = true;
+
+    /* More rounds than a thread has magazine slots */
+    for (int round = 0; ok && round < 3 * POOL_MAX_THREAD_CACHES; round++) {
+        MemoryPool* pool = pool_create(48, 8);
+        if (!pool || !pool_enable_thread_cache(pool, 16)) {
+            pool_destroy(pool);
+            return false;
+        }
+
+        void* live[4];
+        for (int i = 0; i < 4; i++) {
+            live[i] = pool_alloc(pool);
+            ok = ok && live[i] != NULL;
+            if (live[i]) memset(live[i], round, 48);
+        }
+        for (int i = 0; i < 4; i++) {
+            pool_free(pool, live[i]);
+        }
+
+        /* Allocations went through a fresh magazine, not the locked path */
+        MemoryStats stats;
+        pool_get_stats(pool, &stats);
+        ok = ok && stats.cached_blocks > 0;
+
+        pthread_t thread;
+        pthread_create(&thread, NULL, destroy_worker, pool);
+        pthread_join(thread, NULL);
+    }
+
+    return ok;
+}
+
+/* Test: Arena allocation and reset */
+static bool test_arena(void) {
+    Arena* arena = arena_create(64);
+    if (!arena) return false;
+
+    char* a = arena_strdup(arena, "first");
+    char* b = arena_strndup(arena, "second-and-more", 6);
+    bool ok = a && b && strcmp(a, "first") == 0 && strcmp(b, "second") == 0;
+
+    /* Force growth past the first chunk */
+    void* big = arena_alloc(arena, 1000);
+    ok = ok && big != NULL && arena_owns(arena, big) && arena_owns(arena, a);
+    ok = ok && ((uintptr_t)big % _Alignof(max_align_t)) == 0;
+
+    ArenaStats stats;
+    arena_get_stats(arena, &stats);
+    ok = ok && stats.chunk_count == 2 && stats.total_allocs == 3;
+
+    /* Reset collapses to one chunk big enough for the whole cycle */
+    arena_reset(arena);
+    arena_get_stats(arena, &stats);
+    ok = ok && stats.chunk_count == 1 && stats.bytes_used == 0 && stats.resets == 1;
+    ok = ok && arena_alloc(arena, 1000) != NULL;
+    arena_get_stats(arena, &stats);
+    ok = ok && stats.chunk_count == 1;
+
+    int* zeros = arena_calloc(arena, 8, sizeof(int));
+    ok = ok && zeros && zeros[0] == 0 && zeros[7] == 0;
+
+    arena_destroy(arena);
+    return ok;
+}
+
 int main(void) {
     /* Initialize logger for tests */
     logger_init("test_memory.log", LOG_LEVEL_DEBUG);
@@ -259,6 +453,11 @@ int main(void) {
     TEST(leak_detection);
     TEST(free_null);
     TEST(data_integrity);
+    TEST(growth);
+    TEST(fragmentation);
+    TEST(thread_cache);
+    TEST(thread_cache_recreate);
+    TEST(arena);
 
     printf("\n=====================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
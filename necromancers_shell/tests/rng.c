@@ -0,0 +1,249 @@
+/**
+ * RNG and Alias Table Tests
+ */
+
+#include "utils/rng.h"
+#include "game/souls/soul_harvest.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Test results */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) \
+    printf("Running test: %s\n", #name); \
+    tests_run++; \
+    if (test_##name()) { \
+        tests_passed++; \
+        printf("  ✓ PASSED\n"); \
+    } else { \
+        printf("  ✗ FAILED\n"); \
+    }
+
+/* Test: Equal seeds give equal sequences, different seeds differ */
+static bool test_determinism(void) {
+    Rng a, b, c;
+    rng_seed(&a, 42);
+    rng_seed(&b, 42);
+    rng_seed(&c, 43);
+
+    bool ok = true;
+    bool differs = false;
+    for (int i = 0; i < 1000; i++) {
+        uint64_t va = rng_next_u64(&a);
+        ok = ok && va == rng_next_u64(&b);
+        differs = differs || va != rng_next_u64(&c);
+    }
+    return ok && differs;
+}
+
+/* Test: Range and double stay in bounds and cover the range */
+static bool test_range_bounds(void) {
+    Rng rng;
+    rng_seed(&rng, 7);
+
+    bool seen[10] = {false};
+    bool ok = rng_range(&rng, 0) == 0;
+    for (int i = 0; i < 10000 && ok; i++) {
+        uint32_t v = rng_range(&rng, 10);
+        ok = v < 10;
+        if (ok) seen[v] = true;
+
+        double d = rng_double(&rng);
+        ok = ok && d >= 0.0 && d < 1.0;
+    }
+
+    for (int i = 0; i < 10; i++) {
+        ok = ok && seen[i];
+    }
+    return ok;
+}
+
+/* Test: Streams from one seed are reproducible and distinct */
+static bool test_streams(void) {
+    rng_streams_seed(1234);
+    bool ok = rng_streams_get_seed() == 1234;
+
+    uint64_t combat[8], world[8];
+    for (int i = 0; i < 8; i++) {
+        combat[i] = rng_next_u64(rng_stream(RNG_STREAM_COMBAT));
+        world[i] = rng_next_u64(rng_stream(RNG_STREAM_WORLD));
+    }
+    ok = ok && memcmp(combat, world, sizeof(combat)) != 0;
+
+    /* Draws from one stream do not shift another */
+    rng_streams_seed(1234);
+    for (int i = 0; i < 100; i++) {
+        rng_next_u64(rng_stream(RNG_STREAM_WORLD));
+    }
+    for (int i = 0; i < 8 && ok; i++) {
+        ok = rng_next_u64(rng_stream(RNG_STREAM_COMBAT)) == combat[i];
+    }
+
+    /* A stream matches a generator seeded directly for it */
+    Rng direct;
+    rng_seed_stream(&direct, 1234, RNG_STREAM_WORLD);
+    ok = ok && rng_next_u64(&direct) == world[0];
+    return ok;
+}
+
+/* Test: Split hands off the current sequence and jumps the parent */
+static bool test_split(void) {
+    Rng parent, reference, child;
+    rng_seed(&parent, 5);
+    reference = parent;
+
+    rng_split(&parent, &child);
+    bool ok = rng_next_u64(&child) == rng_next_u64(&reference);
+
+    Rng jumped;
+    rng_seed(&jumped, 5);
+    rng_jump(&jumped);
+    ok = ok && rng_next_u64(&parent) == rng_next_u64(&jumped);
+    return ok;
+}
+
+/* Test: Poisson counts have the requested mean and variance */
+static bool test_poisson(void) {
+    Rng rng;
+    rng_seed(&rng, 31);
+
+    bool ok = rng_poisson(&rng, 0.0) == 0 && rng_poisson(&rng, -1.0) == 0;
+
+    /* One mean per sampler branch, plus a large one */
+    const double means[3] = {3.5, 42.0, 50000.0};
+    const int samples = 50000;
+    for (int m = 0; m < 3 && ok; m++) {
+        double sum = 0.0, sum_sq = 0.0;
+        for (int i = 0; i < samples; i++) {
+            double k = (double)rng_poisson(&rng, means[m]);
+            sum += k;
+            sum_sq += k * k;
+        }
+        double mean = sum / samples;
+        double variance = sum_sq / samples - mean * mean;
+        /* Mean within 5 standard errors; variance within 5% */
+        ok = fabs(mean - means[m]) < 5.0 * sqrt(means[m] / samples) &&
+             fabs(variance / means[m] - 1.0) < 0.05;
+    }
+    return ok;
+}
+
+/* Test: Normal deviates have mean 0 and variance 1 */
+static bool test_normal(void) {
+    Rng rng;
+    rng_seed(&rng, 77);
+
+    const int samples = 100000;
+    double sum = 0.0, sum_sq = 0.0;
+    for (int i = 0; i < samples; i++) {
+        double x = rng_normal(&rng);
+        sum += x;
+        sum_sq += x * x;
+    }
+    double mean = sum / samples;
+    return fabs(mean) < 0.02 && fabs(sum_sq / samples - mean * mean - 1.0) < 0.02;
+}
+
+/* Test: Alias table rejects bad input */
+static bool test_alias_invalid(void) {
+    AliasTable table;
+    uint32_t zeros[3] = {0, 0, 0};
+    uint32_t one[1] = {5};
+
+    bool ok = !alias_table_build(&table, zeros, 3);
+    ok = ok && !alias_table_build(&table, one, 0);
+    ok = ok && !alias_table_build(&table, one, RNG_ALIAS_MAX + 1);
+    return ok;
+}
+
+/* Test: Alias table samples match the weights */
+static bool test_alias_distribution(void) {
+    uint32_t weights[5] = {70, 0, 20, 0, 10};
+    AliasTable table;
+    if (!alias_table_build(&table, weights, 5)) return false;
+
+    Rng rng;
+    rng_seed(&rng, 2024);
+
+    const int samples = 100000;
+    int counts[5] = {0};
+    for (int i = 0; i < samples; i++) {
+        uint32_t v = alias_table_sample(&table, &rng);
+        if (v >= 5) return false;
+        counts[v]++;
+    }
+
+    /* Zero weights never drawn; others within 1% of expected */
+    bool ok = counts[1] == 0 && counts[3] == 0;
+    for (int i = 0; i < 5 && ok; i++) {
+        int expected = samples / 100 * (int)weights[i];
+        ok = abs(counts[i] - expected) < samples / 100;
+    }
+    return ok;
+}
+
+/* Test: Harvest rolls follow the location distribution and spread */
+static bool test_harvest_roll(void) {
+    SoulHarvestTable table;
+    soul_harvest_table_init_defaults(&table);
+
+    Rng rng;
+    rng_seed(&rng, 99);
+
+    SoulType types[500];
+    SoulQuality qualities[500];
+    size_t rolled = soul_harvest_roll(&table, LOCATION_TYPE_VILLAGE, 90, &rng,
+                                      500, types, qualities);
+    bool ok = rolled == 500;
+    for (size_t i = 0; i < rolled && ok; i++) {
+        ok = (types[i] == SOUL_TYPE_INNOCENT || types[i] == SOUL_TYPE_COMMON) &&
+             qualities[i] >= 70 && qualities[i] <= 100;
+    }
+
+    /* Replace a distribution with a single soul type and no spread */
+    uint32_t weights[SOUL_TYPE_COUNT] = {0};
+    weights[SOUL_TYPE_MAGE] = 1;
+    ok = ok && soul_harvest_table_set(&table, LOCATION_TYPE_CRYPT, weights, 0);
+    rolled = soul_harvest_roll(&table, LOCATION_TYPE_CRYPT, 50, &rng, 100, types, qualities);
+    ok = ok && rolled == 100;
+    for (size_t i = 0; i < rolled && ok; i++) {
+        ok = types[i] == SOUL_TYPE_MAGE && qualities[i] == 50;
+    }
+
+    /* All-zero weights are rejected */
+    uint32_t zeros[SOUL_TYPE_COUNT] = {0};
+    ok = ok && !soul_harvest_table_set(&table, LOCATION_TYPE_CRYPT, zeros, 5);
+    return ok;
+}
+
+int main(void) {
+    /* Initialize logger for tests */
+    logger_init("test_rng.log", LOG_LEVEL_DEBUG);
+
+    printf("=====================================\n");
+    printf("RNG Tests\n");
+    printf("=====================================\n\n");
+
+    TEST(determinism);
+    TEST(range_bounds);
+    TEST(streams);
+    TEST(split);
+    TEST(poisson);
+    TEST(normal);
+    TEST(alias_invalid);
+    TEST(alias_distribution);
+    TEST(harvest_roll);
+
+    printf("\n=====================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("=====================================\n");
+
+    logger_shutdown();
+
+    return (tests_passed == tests_run) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -450,6 +450,216 @@ TEST(test_scan_network) {
     death_network_destroy(network);
 }
 
+TEST(test_large_network) {
+    DeathNetwork* network = death_network_create();
+    ASSERT_NOT_NULL(network, "Network creation failed");
+
+    /* Well past the old fixed limit of 256 nodes */
+    for (uint32_t id = 1; id <= 2000; id++) {
+        ASSERT(death_network_add_location(network, id * 3, 30, 1000, (uint8_t)(id % 5)),
+               "Failed to add location");
+    }
+
+    size_t locations;
+    death_network_get_stats(network, &locations, NULL, NULL, NULL);
+    ASSERT_EQ(2000, locations, "Should track every location");
+
+    const DeathNode* node = death_network_get_node(network, 1500 * 3);
+    ASSERT_NOT_NULL(node, "Late node should be found");
+    ASSERT_EQ(0, node->regen_rate, "Node fields should match");
+    ASSERT_EQ(500, node->available_corpses, "Should start with 50% corpses");
+
+    /* An hour gives each node about a 0.2% event chance */
+    death_network_update(network, 1);
+    static uint32_t corpses[2001];
+    size_t events = 0;
+    for (uint32_t id = 1; id <= 2000; id++) {
+        node = death_network_get_node(network, id * 3);
+        corpses[id] = node->available_corpses;
+        if (node->hours_since_event == 0) {
+            events++;
+        } else {
+            ASSERT_EQ(1, node->hours_since_event, "Should track time since event");
+            ASSERT_EQ(500, node->available_corpses, "An hour regenerates nothing");
+        }
+    }
+    ASSERT(events < 20, "Events in an hour should be rare");
+
+    /* A day gives each node its daily corpses and a 5% event chance */
+    death_network_update(network, 24);
+
+    events = 0;
+    for (uint32_t id = 1; id <= 2000; id++) {
+        node = death_network_get_node(network, id * 3);
+        if (node->hours_since_event == 0) {
+            events++;
+        } else {
+            ASSERT_EQ(corpses[id] + id % 5, node->available_corpses, "Should regenerate per rate");
+        }
+        ASSERT_EQ(25, node->hours_since_harvest, "Should track time since harvest");
+    }
+    ASSERT(events > 50 && events < 150, "Event count should be near 5% of nodes");
+
+    death_network_destroy(network);
+}
+
+TEST(test_fast_forward_decade) {
+    DeathNetwork* network = death_network_create();
+    ASSERT_NOT_NULL(network, "Network creation failed");
+
+    for (uint32_t id = 1; id <= 500; id++) {
+        ASSERT(death_network_add_location(network, id, 40, 100000, 0),
+               "Failed to add location");
+    }
+    DeathEvent plague = {
+        .location_id = 1,
+        .type = DEATH_EVENT_PLAGUE,
+        .death_count = 60,
+        .avg_quality = DEATH_QUALITY_AVERAGE,
+        .timestamp_hours = 0
+    };
+    death_network_trigger_event(network, &plague);
+
+    /* Ten years goes through the analytic path */
+    uint32_t hours = 24 * 3650;
+    death_network_update(network, hours);
+
+    uint32_t total_deaths;
+    death_network_get_stats(network, NULL, NULL, &total_deaths, NULL);
+
+    /* Poisson rate 5% per day, about 6.57 deaths per event */
+    double per_node = 3650.0 * 0.0513;
+    double expected = 500.0 * per_node * 6.57;
+    ASSERT(total_deaths > expected * 0.95 && total_deaths < expected * 1.05,
+           "Total deaths should match the event rate");
+
+    size_t near_base = 0;
+    for (uint32_t id = 1; id <= 500; id++) {
+        const DeathNode* node = death_network_get_node(network, id);
+        ASSERT(node->available_corpses <= node->max_corpses, "Corpses should be capped");
+        ASSERT(node->available_corpses > 50000, "Event deaths should add corpses");
+        ASSERT_EQ(hours, node->hours_since_harvest, "Should track time since harvest");
+        ASSERT(node->hours_since_event < hours, "Every node should have had events");
+        if (node->signature >= 40 && node->signature < 60) near_base++;
+    }
+    /* Old events have long since decayed */
+    ASSERT(near_base > 450, "Signatures should settle near their base");
+
+    death_network_destroy(network);
+}
+
+TEST(test_split_steps_match_single_step) {
+    /* Regeneration every 24, 12, 5 and 2 hours; none divides a 4h step */
+    uint8_t regen_rates[] = { 1, 2, 5, 10 };
+    size_t compared = 0;
+
+    for (uint64_t seed = 1; seed <= 200 && compared < 20; seed++) {
+        DeathNetwork* whole = death_network_create();
+        DeathNetwork* split = death_network_create();
+        ASSERT(whole && split, "Network creation failed");
+
+        for (uint32_t id = 1; id <= 4; id++) {
+            death_network_add_location(whole, id, 20, 1000, regen_rates[id - 1]);
+            death_network_add_location(split, id, 20, 1000, regen_rates[id - 1]);
+            DeathEvent battle = {
+                .location_id = id,
+                .type = DEATH_EVENT_BATTLE,
+                .death_count = 40,
+                .avg_quality = DEATH_QUALITY_AVERAGE,
+                .timestamp_hours = 0
+            };
+            death_network_trigger_event(whole, &battle);
+            death_network_trigger_event(split, &battle);
+        }
+
+        /* A day in one step, or in six 4h steps */
+        Rng rng_whole, rng_split;
+        rng_seed(&rng_whole, seed);
+        rng_seed(&rng_split, seed);
+        uint64_t events = death_network_step(whole, 24, &rng_whole);
+        for (int step = 0; step < 6; step++) {
+            events += death_network_step(split, 4, &rng_split);
+        }
+
+        /* Random events differ by draw order; compare event-free runs */
+        if (events == 0) {
+            for (uint32_t id = 1; id <= 4; id++) {
+                const DeathNode* a = death_network_get_node(whole, id);
+                DeathSignature signature = a->signature;
+                uint32_t corpses = a->available_corpses;
+                const DeathNode* b = death_network_get_node(split, id);
+                ASSERT_EQ(signature, b->signature, "Signature decay should not depend on step size");
+                ASSERT_EQ(corpses, b->available_corpses, "Regeneration should not depend on step size");
+                ASSERT_EQ(39, signature, "Signature should decay once a day");
+            }
+            compared++;
+        }
+
+        death_network_destroy(whole);
+        death_network_destroy(split);
+    }
+    ASSERT(compared >= 20, "Should find event-free runs to compare");
+}
+
+TEST(test_hotspots_track_changes) {
+    DeathNetwork* network = death_network_create();
+    ASSERT_NOT_NULL(network, "Network creation failed");
+
+    for (uint32_t id = 1; id <= 300; id++) {
+        death_network_add_location(network, id, (DeathSignature)((id * 37) % 90), 1000, 2);
+    }
+
+    /* Raise some signatures, lower others through harvesting */
+    for (uint32_t id = 1; id <= 300; id += 7) {
+        DeathEvent event = {
+            .location_id = id,
+            .type = DEATH_EVENT_BATTLE,
+            .death_count = id % 60,
+            .avg_quality = DEATH_QUALITY_GOOD,
+            .timestamp_hours = 0
+        };
+        death_network_trigger_event(network, &event);
+    }
+    for (uint32_t id = 2; id <= 300; id += 5) {
+        death_network_harvest_corpses(network, id, 1, NULL);
+    }
+    death_network_update(network, 24 * 3);
+
+    /* Every hotspot ranks at or above every location left out */
+    uint32_t results[300];
+    size_t count = death_network_get_hotspots(network, results, 20);
+    ASSERT(count > 0 && count <= 20, "Should find hotspots");
+    for (size_t i = 1; i < count; i++) {
+        ASSERT(death_network_get_node(network, results[i - 1])->signature >=
+               death_network_get_node(network, results[i])->signature,
+               "Hotspots should be sorted descending");
+    }
+    DeathSignature lowest = death_network_get_node(network, results[count - 1])->signature;
+    size_t above = 0;
+    size_t moderate = 0;
+    for (uint32_t id = 1; id <= 300; id++) {
+        DeathSignature signature = death_network_get_node(network, id)->signature;
+        if (signature > lowest) above++;
+        if (signature >= 60) moderate++;
+    }
+    ASSERT(above < count, "No location outside the list should rank higher");
+    ASSERT_EQ(moderate < 20 ? moderate : 20, count, "Should list every moderate location up to the limit");
+
+    /* A full scan lists every other location in order */
+    count = death_network_scan(network, 150, results, 300);
+    ASSERT_EQ(299, count, "Scan should list every other location");
+    for (size_t i = 0; i < count; i++) {
+        ASSERT(results[i] != 150, "Scan should leave out the center");
+        if (i > 0) {
+            ASSERT(death_network_get_node(network, results[i - 1])->signature >=
+                   death_network_get_node(network, results[i])->signature,
+                   "Scan should be sorted descending");
+        }
+    }
+
+    death_network_destroy(network);
+}
+
 /* ========================================================================
  * Test Runner
  * ======================================================================== */
@@ -480,6 +690,10 @@ int main(void) {
     RUN_TEST(test_get_stats);
     RUN_TEST(test_string_utilities);
     RUN_TEST(test_scan_network);
+    RUN_TEST(test_large_network);
+    RUN_TEST(test_split_steps_match_single_step);
+    RUN_TEST(test_fast_forward_decade);
+    RUN_TEST(test_hotspots_track_changes);
 
     /* Print summary */
     printf("\n");
@@ -5,6 +5,7 @@
 
 #include "../src/game/events/event_scheduler.h"
 #include "../src/game/game_state.h"
+#include "../src/core/thread_pool.h"
 #include "../src/utils/logger.h"
 #include <stdio.h>
 #include <assert.h>
@@ -29,6 +30,24 @@ static bool event2_callback(GameState* state, uint32_t event_id) {
     return true;
 }
 
+static uint32_t g_event_day = 0;
+
+static bool day_recording_callback(GameState* state, uint32_t event_id) {
+    (void)event_id;
+    g_event_day = state->resources.day_count;
+    g_event1_called++;
+    return true;
+}
+
+static uint32_t g_call_order[8];
+static size_t g_call_count = 0;
+
+static bool order_recording_callback(GameState* state, uint32_t event_id) {
+    (void)state;
+    g_call_order[g_call_count++] = event_id;
+    return true;
+}
+
 static bool event3_callback(GameState* state, uint32_t event_id) {
     (void)state;
     (void)event_id;
@@ -620,6 +639,309 @@ void test_repeatable_event_reset(void) {
     printf("PASS\n");
 }
 
+void test_next_day(void) {
+    printf("Test: next_day... ");
+
+    EventScheduler* scheduler = event_scheduler_create();
+    assert(scheduler != NULL);
+    assert(event_scheduler_next_day(scheduler, 0) == UINT32_MAX);
+
+    ScheduledEvent day_event = {
+        .id = 1,
+        .trigger_type = EVENT_TRIGGER_DAY,
+        .trigger_value = 30
+    };
+    ScheduledEvent gated_event = {
+        .id = 2,
+        .trigger_type = EVENT_TRIGGER_CORRUPTION,
+        .trigger_value = 10,
+        .min_day = 12
+    };
+    event_scheduler_register(scheduler, day_event);
+    event_scheduler_register(scheduler, gated_event);
+
+    assert(event_scheduler_next_day(scheduler, 0) == 12);
+    assert(event_scheduler_next_day(scheduler, 12) == 30);
+    assert(event_scheduler_next_day(scheduler, 30) == UINT32_MAX);
+
+    /* Triggered events no longer count */
+    GameState mock_state = {0};
+    mock_state.resources.day_count = 30;
+    mock_state.corruption.corruption = 50;
+    assert(event_scheduler_check_triggers(scheduler, &mock_state) == 2);
+    assert(event_scheduler_next_day(scheduler, 0) == UINT32_MAX);
+
+    event_scheduler_destroy(scheduler);
+
+    printf("PASS\n");
+}
+
+void test_long_wait_stops_at_events(void) {
+    printf("Test: long_wait_stops_at_events... ");
+
+    g_event1_called = 0;
+    g_event_day = 0;
+
+    GameState* state = game_state_create();
+    assert(state != NULL);
+
+    ScheduledEvent event = {
+        .id = 900,
+        .trigger_type = EVENT_TRIGGER_DAY,
+        .trigger_value = 10,
+        .priority = EVENT_PRIORITY_NORMAL,
+        .callback = day_recording_callback
+    };
+    strncpy(event.name, "Day 10 Event", sizeof(event.name) - 1);
+    assert(event_scheduler_register(state->event_scheduler, event));
+
+    /* One call jumping far past the event day and several month boundaries */
+    game_state_advance_time(state, 100 * 24 + 5);
+    assert(state->resources.day_count == 100);
+    assert(state->resources.time_hours == 5);
+    assert(g_event1_called == 1);
+    assert(g_event_day == 10);
+
+    /* Decay applied once for each of the three months crossed */
+    assert(state->consciousness.last_decay_month == 3);
+    assert(state->consciousness.stability > 99.65f && state->consciousness.stability < 99.75f);
+
+    game_state_destroy(state);
+
+    printf("PASS\n");
+}
+
+static uint64_t g_timer_hour = 0;
+static uint64_t g_timer_clock = 0;
+
+static void recording_timer(uint64_t hour, void* userdata) {
+    g_timer_hour = hour;
+    g_timer_clock = game_state_get_hour(userdata);
+}
+
+void test_game_timers(void) {
+    printf("Test: game_timers... ");
+
+    GameState* state = game_state_create();
+    assert(state != NULL);
+
+    uint64_t start = game_state_get_hour(state);
+    TimerId kept = game_state_schedule(state, start + 37, recording_timer, state);
+    TimerId dropped = game_state_schedule(state, start + 20, recording_timer, state);
+    assert(kept != 0 && dropped != 0);
+    assert(game_state_cancel_timer(state, dropped));
+
+    /* Fires at its hour with the clock reading it, mid-advance */
+    game_state_advance_time(state, 100);
+    assert(g_timer_hour == start + 37);
+    assert(g_timer_clock == start + 37);
+    assert(game_state_get_hour(state) == start + 100);
+    assert(!game_state_cancel_timer(state, kept));
+
+    game_state_destroy(state);
+
+    printf("PASS\n");
+}
+
+/* Run a seeded game for a few months on a pool of the given size */
+static void seeded_world(size_t workers, uint32_t* corpses, uint32_t* deaths) {
+    GameState* state = game_state_create();
+    assert(state != NULL);
+    game_state_set_seed(state, 20240611);
+    state->tick_pool = thread_pool_create(workers);
+    assert(state->tick_pool != NULL);
+
+    /* Enough nodes for plenty of random events */
+    for (uint32_t id = 1; id <= 500; id++) {
+        death_network_add_location(state->death_network, 1000000 + id,
+                                   (DeathSignature)(id % 100), 50, 3);
+    }
+
+    /* Short steps roll events one by one, the long one fast-forwards */
+    for (int i = 0; i < 60; i++) {
+        game_state_advance_time(state, 7);
+    }
+    game_state_advance_time(state, 24 * 90);
+
+    size_t locations;
+    DeathSignature signature;
+    death_network_get_stats(state->death_network, &locations, corpses, deaths, &signature);
+    game_state_destroy(state);
+}
+
+void test_seeded_advance_reproducible(void) {
+    printf("Test: seeded_advance_reproducible... ");
+
+    uint32_t corpses, deaths;
+    seeded_world(1, &corpses, &deaths);
+    assert(deaths > 0);
+
+    /* Whichever worker runs the death network, the world is the same */
+    for (int run = 0; run < 3; run++) {
+        uint32_t other_corpses, other_deaths;
+        seeded_world(4, &other_corpses, &other_deaths);
+        assert(other_corpses == corpses);
+        assert(other_deaths == deaths);
+    }
+
+    printf("PASS\n");
+}
+
+void test_tick_pool_capped(void) {
+    printf("Test: tick_pool_capped... ");
+
+    GameState* state = game_state_create();
+    assert(state != NULL);
+
+    /* Six subsystems leave work for at most five workers beside the caller */
+    game_state_advance_time(state, 1);
+    assert(state->tick_pool != NULL);
+    assert(thread_pool_get_worker_count(state->tick_pool) <= 5);
+    assert(thread_pool_get_worker_count(state->tick_pool) <=
+           thread_pool_default_worker_count());
+
+    game_state_destroy(state);
+
+    printf("PASS\n");
+}
+
+void test_priority_order(void) {
+    printf("Test: priority_order... ");
+
+    g_call_count = 0;
+    GameState mock_state = {0};
+    mock_state.resources.day_count = 3;
+
+    EventScheduler* scheduler = event_scheduler_create();
+    assert(scheduler != NULL);
+
+    EventPriority priorities[5] = {
+        EVENT_PRIORITY_LOW, EVENT_PRIORITY_CRITICAL, EVENT_PRIORITY_NORMAL,
+        EVENT_PRIORITY_CRITICAL, EVENT_PRIORITY_HIGH
+    };
+    for (uint32_t i = 0; i < 5; i++) {
+        ScheduledEvent event = {
+            .id = 10 - i,
+            .trigger_type = EVENT_TRIGGER_DAY,
+            .trigger_value = 3,
+            .priority = priorities[i],
+            .callback = order_recording_callback
+        };
+        event_scheduler_register(scheduler, event);
+    }
+
+    assert(event_scheduler_check_triggers(scheduler, &mock_state) == 5);
+
+    /* Highest priority first, ties by ID */
+    uint32_t expected[5] = { 7, 9, 6, 8, 10 };
+    assert(g_call_count == 5);
+    for (size_t i = 0; i < 5; i++) {
+        assert(g_call_order[i] == expected[i]);
+    }
+
+    event_scheduler_destroy(scheduler);
+
+    printf("PASS\n");
+}
+
+/* Reference evaluation of one event against the whole state */
+static bool reference_conditions(const ScheduledEvent* event, const GameState* state,
+                                 const EventScheduler* scheduler) {
+    uint32_t day = state->resources.day_count;
+    if (event->min_day > 0 && day < event->min_day) return false;
+    if (event->max_day > 0 && day > event->max_day) return false;
+    if (event->requires_flag && !event_scheduler_has_flag(scheduler, event->required_flag)) {
+        return false;
+    }
+    switch (event->trigger_type) {
+        case EVENT_TRIGGER_DAY:        return day == event->trigger_value;
+        case EVENT_TRIGGER_CORRUPTION: return state->corruption.corruption >= event->trigger_value;
+        case EVENT_TRIGGER_LOCATION:   return state->current_location_id == event->trigger_value;
+        case EVENT_TRIGGER_FLAG:       return event_scheduler_has_flag(scheduler, event->required_flag);
+        default:                       return false;
+    }
+}
+
+void test_indexed_matches_full_scan(void) {
+    printf("Test: indexed_matches_full_scan... ");
+
+    uint64_t seed = 12345;
+#define NEXT_RANDOM(bound) \
+    ((uint32_t)((seed = seed * 6364136223846793005ULL + 1442695040888963407ULL) >> 33) % (bound))
+
+    EventScheduler* scheduler = event_scheduler_create();
+    assert(scheduler != NULL);
+
+    /* Every trigger type, with random day gates and flag requirements */
+    const uint32_t event_count = 200;
+    for (uint32_t i = 0; i < event_count; i++) {
+        ScheduledEvent event = {
+            .id = i + 1,
+            .trigger_type = (EventTriggerType)NEXT_RANDOM(5),
+            .priority = EVENT_PRIORITY_NORMAL,
+            .repeatable = i % 3 == 0
+        };
+        switch (event.trigger_type) {
+            case EVENT_TRIGGER_DAY:        event.trigger_value = NEXT_RANDOM(60); break;
+            case EVENT_TRIGGER_CORRUPTION: event.trigger_value = NEXT_RANDOM(101); break;
+            case EVENT_TRIGGER_LOCATION:   event.trigger_value = NEXT_RANDOM(10); break;
+            default:                       break;
+        }
+        if (NEXT_RANDOM(3) == 0) event.min_day = 1 + NEXT_RANDOM(50);
+        if (NEXT_RANDOM(4) == 0) event.max_day = 10 + NEXT_RANDOM(50);
+        if (event.trigger_type == EVENT_TRIGGER_FLAG || NEXT_RANDOM(5) == 0) {
+            event.requires_flag = event.trigger_type != EVENT_TRIGGER_FLAG;
+            snprintf(event.required_flag, sizeof(event.required_flag), "flag_%u", NEXT_RANDOM(12));
+        }
+        assert(event_scheduler_register(scheduler, event));
+    }
+
+    GameState state = {0};
+    bool triggered[200] = {false};
+    for (int step = 0; step < 400; step++) {
+        /* Move inputs around, the day mostly forward */
+        switch (NEXT_RANDOM(5)) {
+            case 0: state.resources.day_count += NEXT_RANDOM(4); break;
+            case 1: state.resources.day_count = NEXT_RANDOM(70); break;
+            case 2: state.corruption.corruption = (uint8_t)NEXT_RANDOM(101); break;
+            case 3: state.current_location_id = NEXT_RANDOM(10); break;
+            default: {
+                char name[16];
+                snprintf(name, sizeof(name), "flag_%u", NEXT_RANDOM(12));
+                event_scheduler_set_flag(scheduler, name);
+                break;
+            }
+        }
+
+        /* Occasionally re-arm a fired repeatable event */
+        if (NEXT_RANDOM(4) == 0) {
+            uint32_t id = 1 + NEXT_RANDOM(event_count);
+            if (triggered[id - 1] && event_scheduler_reset_event(scheduler, id)) {
+                triggered[id - 1] = false;
+            }
+        }
+
+        bool expected[200];
+        uint32_t expected_count = 0;
+        for (uint32_t i = 0; i < event_count; i++) {
+            const ScheduledEvent* event = event_scheduler_get_event(scheduler, i + 1);
+            expected[i] = triggered[i] || reference_conditions(event, &state, scheduler);
+            if (!triggered[i] && expected[i]) expected_count++;
+        }
+
+        assert(event_scheduler_check_triggers(scheduler, &state) == expected_count);
+        for (uint32_t i = 0; i < event_count; i++) {
+            assert(event_scheduler_was_triggered(scheduler, i + 1) == expected[i]);
+            triggered[i] = expected[i];
+        }
+    }
+#undef NEXT_RANDOM
+
+    event_scheduler_destroy(scheduler);
+
+    printf("PASS\n");
+}
+
 int main(void) {
     /* Suppress log output during tests */
     logger_set_level(LOG_LEVEL_FATAL + 1); /* Disable all logging */
@@ -639,6 +961,13 @@ int main(void) {
     test_force_trigger();
     test_get_upcoming_events();
     test_repeatable_event_reset();
+    test_next_day();
+    test_long_wait_stops_at_events();
+    test_game_timers();
+    test_seeded_advance_reproducible();
+    test_tick_pool_capped();
+    test_priority_order();
+    test_indexed_matches_full_scan();
 
     printf("\n=== All Event Scheduler Tests Passed! ===\n\n");
 
@@ -486,6 +486,11 @@ static void test_empty_graph(void) {
     size_t count = location_graph_get_neighbors(graph, 1, neighbors, 10);
     ASSERT(count == 0, "Empty graph should have no neighbors");
 
+    uint32_t from[4], to[4];
+    uint8_t times[4];
+    ASSERT(location_graph_get_edges(graph, from, to, times, 4) == 0,
+           "Empty graph should have no edges");
+
     PathfindingResult result;
     bool success = location_graph_find_path(graph, 1, 2, &result);
     ASSERT(success && !result.path_found,
@@ -544,6 +549,248 @@ static void test_large_graph(void) {
     PASS();
 }
 
+/* Test: Workspace queries on a 100x100 grid */
+static void test_workspace_grid(void) {
+    TEST("test_workspace_grid");
+
+    LocationGraph* graph = location_graph_create();
+    ASSERT(graph != NULL, "Graph should be created");
+
+    /* IDs are row * 100 + col + 1; right edges cost 1, down edges cost 2 */
+    for (uint32_t row = 0; row < 100; row++) {
+        for (uint32_t col = 0; col < 100; col++) {
+            uint32_t id = row * 100 + col + 1;
+            if (col + 1 < 100) location_graph_add_bidirectional(graph, id, id + 1, 1, 1);
+            if (row + 1 < 100) location_graph_add_bidirectional(graph, id, id + 100, 2, 1);
+        }
+    }
+    ASSERT(location_graph_compile(graph), "Graph should compile");
+
+    PathWorkspace* ws = path_workspace_create();
+    ASSERT(ws != NULL, "Workspace should be created");
+
+    /* Many relaxations per node: the queue must not overflow */
+    PathfindingResult result;
+    bool success = location_graph_find_path_with_workspace(graph, ws, PATHFINDING_DIJKSTRA,
+                                                           1, 10000, &result);
+    ASSERT(success && result.path_found, "Corner-to-corner path should be found");
+    ASSERT(result.total_travel_time == 99 + 99 * 2, "Cost should be 297");
+    ASSERT(result.path_length == 199, "Path should have 199 locations");
+    ASSERT(result.path[0] == 1 && result.path[198] == 10000, "Path endpoints");
+    ASSERT(result.total_danger == 198, "Danger should sum along the path");
+
+    /* Reuse the workspace; results match the allocating API */
+    for (uint32_t target = 2; target <= 10000; target += 997) {
+        PathfindingResult owned;
+        ASSERT(location_graph_find_path_with_workspace(graph, ws, PATHFINDING_DIJKSTRA,
+                                                       5050, target, &result),
+               "Workspace query should succeed");
+        ASSERT(location_graph_find_path(graph, 5050, target, &owned), "Query should succeed");
+        ASSERT(result.path_found && owned.path_found, "Paths should be found");
+        ASSERT(result.total_travel_time == owned.total_travel_time, "Costs should match");
+        ASSERT(result.path_length == owned.path_length, "Lengths should match");
+        pathfinding_result_free(&owned);
+    }
+
+    ASSERT(location_graph_validate_connectivity(graph, 1), "Grid should be connected");
+
+    /* Adding a connection recompiles lazily */
+    location_graph_add_connection(graph, 1, 10000, 5, 0);
+    ASSERT(location_graph_find_path_with_workspace(graph, ws, PATHFINDING_DIJKSTRA,
+                                                   1, 10000, &result),
+           "Query after edit should succeed");
+    ASSERT(result.total_travel_time == 5 && result.path_length == 2, "New shortcut should be used");
+
+    path_workspace_destroy(ws);
+    location_graph_destroy(graph);
+    PASS();
+}
+
+/* Sum a path's travel time edge by edge; UINT32_MAX if an edge is missing */
+static uint32_t walk_path_time(const LocationGraph* graph, const PathfindingResult* result) {
+    uint32_t total = 0;
+    for (size_t i = 0; i + 1 < result->path_length; i++) {
+        LocationConnection conn;
+        if (!location_graph_get_connection(graph, result->path[i], result->path[i + 1], &conn)) {
+            return UINT32_MAX;
+        }
+        total += conn.travel_time_hours;
+    }
+    return total;
+}
+
+/* Test: A* and bidirectional match Dijkstra while settling fewer nodes */
+static void test_pathfinding_modes(void) {
+    TEST("test_pathfinding_modes");
+
+    LocationGraph* graph = location_graph_create();
+    ASSERT(graph != NULL, "Graph should be created");
+
+    /* 100x100 grid, two hours per step, one map unit per step */
+    for (uint32_t row = 0; row < 100; row++) {
+        for (uint32_t col = 0; col < 100; col++) {
+            uint32_t id = row * 100 + col + 1;
+            if (col + 1 < 100) location_graph_add_bidirectional(graph, id, id + 1, 2, 1);
+            if (row + 1 < 100) location_graph_add_bidirectional(graph, id, id + 100, 2, 1);
+        }
+    }
+    /* A one-way shortcut: bidirectional must respect edge direction */
+    location_graph_add_connection(graph, 5050, 5052, 3, 50);
+
+    for (uint32_t row = 0; row < 100; row++) {
+        for (uint32_t col = 0; col < 100; col++) {
+            ASSERT(location_graph_set_position(graph, row * 100 + col + 1,
+                                               (float)col, (float)row),
+                   "Position should be set");
+        }
+    }
+    ASSERT(!location_graph_set_position(graph, 999999, 0, 0), "Unknown location rejected");
+
+    PathWorkspace* ws = path_workspace_create();
+    ASSERT(ws != NULL, "Workspace should be created");
+
+    static const uint32_t queries[][2] = {
+        {5050, 5052}, {5052, 5050}, {4321, 4361}, {2020, 6020}, {7777, 7777}, {1010, 3535}
+    };
+    uint32_t settled[3] = {0, 0, 0};
+
+    for (size_t q = 0; q < sizeof(queries) / sizeof(queries[0]); q++) {
+        uint32_t costs[3];
+        for (int mode = PATHFINDING_DIJKSTRA; mode <= PATHFINDING_BIDIRECTIONAL; mode++) {
+            PathfindingResult result;
+            ASSERT(location_graph_find_path_with_workspace(graph, ws, (PathfindingMode)mode,
+                                                           queries[q][0], queries[q][1],
+                                                           &result),
+                   "Query should succeed");
+            ASSERT(result.path_found, "Path should be found");
+            ASSERT(result.path[0] == queries[q][0] &&
+                   result.path[result.path_length - 1] == queries[q][1], "Path endpoints");
+            ASSERT(walk_path_time(graph, &result) == result.total_travel_time,
+                   "Path should follow real edges and add up to its cost");
+            costs[mode] = result.total_travel_time;
+            settled[mode] += result.nodes_settled;
+        }
+        ASSERT(costs[PATHFINDING_ASTAR] == costs[PATHFINDING_DIJKSTRA] &&
+               costs[PATHFINDING_BIDIRECTIONAL] == costs[PATHFINDING_DIJKSTRA],
+               "All modes should find the same cost");
+    }
+
+    ASSERT(settled[PATHFINDING_ASTAR] < settled[PATHFINDING_DIJKSTRA] / 2,
+           "A* should settle far fewer nodes");
+    ASSERT(settled[PATHFINDING_BIDIRECTIONAL] < settled[PATHFINDING_DIJKSTRA],
+           "Bidirectional should settle fewer nodes");
+
+    /* The graph-wide mode drives location_graph_find_path */
+    location_graph_set_pathfinding_mode(graph, PATHFINDING_BIDIRECTIONAL);
+    ASSERT(location_graph_get_pathfinding_mode(graph) == PATHFINDING_BIDIRECTIONAL,
+           "Mode should be stored");
+    PathfindingResult owned;
+    ASSERT(location_graph_find_path(graph, 5050, 5052, &owned) && owned.path_found,
+           "Bidirectional find_path should succeed");
+    ASSERT(owned.total_travel_time == 3 && owned.total_danger == 50,
+           "One-way shortcut should be taken forward");
+    pathfinding_result_free(&owned);
+    ASSERT(location_graph_find_path(graph, 5052, 5050, &owned) && owned.path_found,
+           "Reverse query should succeed");
+    ASSERT(owned.total_travel_time == 4, "Shortcut should not be taken backward");
+    pathfinding_result_free(&owned);
+
+    /* Unreachable target: disconnected location */
+    location_graph_add_connection(graph, 20000, 20001, 1, 0);
+    PathfindingResult none;
+    ASSERT(location_graph_find_path_with_workspace(graph, ws, PATHFINDING_BIDIRECTIONAL,
+                                                   1, 20000, &none), "Query should succeed");
+    ASSERT(!none.path_found, "Disconnected target should have no path");
+
+    path_workspace_destroy(ws);
+    location_graph_destroy(graph);
+    PASS();
+}
+
+/* Test: All-pairs travel table matches search and follows graph edits */
+static void test_travel_table(void) {
+    TEST("test_travel_table");
+
+    LocationGraph* graph = location_graph_create();
+    ASSERT(graph != NULL, "Graph should be created");
+
+    /* 10x10 grid plus a one-way spur into an otherwise isolated location */
+    for (uint32_t row = 0; row < 10; row++) {
+        for (uint32_t col = 0; col < 10; col++) {
+            uint32_t id = row * 10 + col + 1;
+            if (col + 1 < 10) location_graph_add_bidirectional(graph, id, id + 1, 1 + col % 3, 2);
+            if (row + 1 < 10) location_graph_add_bidirectional(graph, id, id + 10, 2, 3);
+        }
+    }
+    location_graph_add_connection(graph, 100, 200, 4, 9);
+
+    uint32_t version = location_graph_get_version(graph);
+    ASSERT(location_graph_build_travel_table(graph), "Table should build");
+    ASSERT(location_graph_get_version(graph) == version, "Building should not bump version");
+
+    PathWorkspace* ws = path_workspace_create();
+    ASSERT(ws != NULL, "Workspace should be created");
+
+    uint32_t ids[101];
+    size_t count = location_graph_get_all_locations(graph, ids, 101);
+    ASSERT(count == 101, "All locations should be listed");
+
+    for (size_t a = 0; a < count; a++) {
+        for (size_t b = 0; b < count; b++) {
+            PathfindingResult searched, cached;
+            ASSERT(location_graph_find_path_with_workspace(graph, ws, PATHFINDING_DIJKSTRA,
+                                                           ids[a], ids[b], &searched),
+                   "Search should succeed");
+            ASSERT(location_graph_find_path(graph, ids[a], ids[b], &cached),
+                   "Table query should succeed");
+            ASSERT(cached.nodes_settled == 0, "Warm query should not search");
+            ASSERT(cached.path_found == searched.path_found, "Reachability should match");
+            ASSERT(location_graph_is_reachable(graph, ids[a], ids[b]) == searched.path_found,
+                   "is_reachable should match");
+            if (searched.path_found) {
+                ASSERT(cached.total_travel_time == searched.total_travel_time,
+                       "Times should match");
+                ASSERT(walk_path_time(graph, &cached) == cached.total_travel_time,
+                       "Table path should follow real edges");
+                ASSERT(cached.path[0] == ids[a] &&
+                       cached.path[cached.path_length - 1] == ids[b], "Path endpoints");
+
+                uint32_t hours = 0;
+                ASSERT(location_graph_get_travel_time(graph, ids[a], ids[b], &hours) &&
+                       hours == searched.total_travel_time, "Travel time should match");
+            }
+            pathfinding_result_free(&cached);
+        }
+    }
+
+    uint32_t hours = 0;
+    ASSERT(!location_graph_get_travel_time(graph, 200, 1, &hours), "Spur is one-way");
+
+    /* An edit bumps the version; the next query searches, the one after rebuilds */
+    ASSERT(location_graph_add_connection(graph, 200, 1, 1, 0), "Edit should succeed");
+    ASSERT(location_graph_get_version(graph) != version, "Edit should bump version");
+
+    PathfindingResult result;
+    ASSERT(location_graph_find_path(graph, 200, 1, &result) && result.path_found,
+           "New edge should be visible immediately");
+    ASSERT(result.total_travel_time == 1 && result.nodes_settled > 0, "Stale table unused");
+    pathfinding_result_free(&result);
+
+    ASSERT(location_graph_find_path(graph, 200, 1, &result) && result.path_found,
+           "Second query should succeed");
+    ASSERT(result.total_travel_time == 1 && result.nodes_settled == 0, "Table rebuilt");
+    pathfinding_result_free(&result);
+
+    version = location_graph_get_version(graph);
+    ASSERT(location_graph_set_unlock_requirement(graph, 200, 1, "gate_key"),
+           "Unlock should be set");
+    ASSERT(location_graph_get_version(graph) != version, "Unlock should bump version");
+
+    path_workspace_destroy(ws);
+    location_graph_destroy(graph);
+    PASS();
+}
+
 /* Main test runner */
 int main(void) {
     printf("=== Location Graph Unit Tests ===\n\n");
@@ -566,6 +813,9 @@ int main(void) {
     test_empty_graph();
     test_complex_pathfinding();
     test_large_graph();
+    test_workspace_grid();
+    test_pathfinding_modes();
+    test_travel_table();
 
     /* Print summary */
     printf("\n=== Test Summary ===\n");
@@ -1,5 +1,8 @@
 #include "../src/game/minions/minion.h"
 #include "../src/game/minions/minion_manager.h"
+#include "../src/game/game_state.h"
+#include "../src/game/game_globals.h"
+#include "../src/commands/commands/commands.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -290,6 +293,17 @@ void test_minion_manager_remove(void) {
     retrieved = minion_manager_get(manager, 2);
     TEST_ASSERT(retrieved != NULL, "Minion2 should still be in manager");
 
+    /* Removing from the front moves the last minion into its slot */
+    Minion* minion3 = minion_create(MINION_TYPE_GHOUL, "Minion3", 0);
+    minion3->id = 3;
+    minion_manager_add(manager, minion3);
+    removed = minion_manager_remove(manager, 2);
+    TEST_ASSERT(removed == minion2, "Should remove minion2");
+    minion_destroy(removed);
+    TEST_ASSERT(minion_manager_get_at(manager, 0) == minion3, "Minion3 should fill the hole");
+    TEST_ASSERT(minion_manager_get(manager, 3) == minion3, "Minion3 should be found by ID");
+    TEST_ASSERT(minion_manager_count(manager) == 1, "Should have 1 minion left");
+
     minion_manager_destroy(manager);
     TEST_PASS();
 }
@@ -366,6 +380,43 @@ void test_minion_manager_get_at_location(void) {
 /**
  * Main test runner
  */
+/**
+ * Test: minions command lists by ID after a swap-remove
+ */
+void test_minions_listing_order(void) {
+    TEST_START("minions_listing_order");
+
+    MinionManager* manager = minion_manager_create(10);
+    GameState* state = calloc(1, sizeof(GameState));
+    TEST_ASSERT(manager != NULL && state != NULL, "Manager and state should be created");
+
+    for (uint32_t id = 1; id <= 4; id++) {
+        Minion* minion = minion_create(MINION_TYPE_ZOMBIE, NULL, 0);
+        minion->id = id;
+        minion_manager_add(manager, minion);
+    }
+    /* Minion 4 moves into slot 0 */
+    minion_destroy(minion_manager_remove(manager, 1));
+
+    state->minions = manager;
+    GameState* saved_state = g_game_state;
+    g_game_state = state;
+    ParsedCommand cmd = { .command_name = "minions" };
+    CommandResult result = cmd_minions(&cmd);
+    g_game_state = saved_state;
+
+    const char* at2 = result.output ? strstr(result.output, "\n2    ") : NULL;
+    const char* at3 = result.output ? strstr(result.output, "\n3    ") : NULL;
+    const char* at4 = result.output ? strstr(result.output, "\n4    ") : NULL;
+    bool ordered = at2 && at3 && at4 && at2 < at3 && at3 < at4;
+    command_result_destroy(&result);
+    minion_manager_destroy(manager);
+    free(state);
+
+    TEST_ASSERT(ordered, "Remaining minions should be listed in ID order");
+    TEST_PASS();
+}
+
 int main(void) {
     printf("\n=== Running Minion Tests ===\n\n");
 
@@ -382,6 +433,7 @@ int main(void) {
     test_minion_manager_remove();
     test_minion_manager_count_by_type();
     test_minion_manager_get_at_location();
+    test_minions_listing_order();
 
     printf("\n=== Test Summary ===\n");
     printf("Tests run: %d\n", tests_run);
@@ -9,6 +9,7 @@
 #include "../src/game/souls/soul_manager.h"
 #include "../src/game/minions/minion.h"
 #include "../src/game/minions/minion_manager.h"
+#include "../src/utils/rng.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -73,6 +74,7 @@ static GameState* create_test_state(void) {
     state->civilian_kills = 0;
     state->game_completed = false;
     state->ending_achieved = ENDING_NONE;
+    state->game_seed = 0xDEADBEEFCAFEULL;
     state->initialized = true;
 
     return state;
@@ -155,6 +157,13 @@ static bool test_save_load_roundtrip(void) {
         success = false;
     }
 
+    /* Check game seed (reseeds the random streams) */
+    if (loaded->game_seed != original->game_seed ||
+        rng_streams_get_seed() != original->game_seed) {
+        printf("  Game seed mismatch\n");
+        success = false;
+    }
+
     /* Cleanup */
     game_state_destroy(original);
     game_state_destroy(loaded);
@@ -163,6 +172,61 @@ static bool test_save_load_roundtrip(void) {
     return success;
 }
 
+/* Test: Random streams continue after load instead of restarting */
+static bool test_rng_continues_after_load(void) {
+    const char* test_path = "/tmp/test_save_rng.dat";
+
+    GameState* original = create_test_state();
+    if (!original) {
+        return false;
+    }
+
+    /* Mid-session: some rolls already made */
+    game_state_set_seed(original, 0xDEADBEEFCAFEULL);
+    for (int i = 0; i < 25; i++) {
+        rng_next_u64(rng_stream(RNG_STREAM_COMBAT));
+        rng_next_u64(rng_stream((RngStream)(i % RNG_STREAM_COUNT)));
+    }
+
+    if (!save_game(original, test_path)) {
+        game_state_destroy(original);
+        return false;
+    }
+
+    /* Next draw of every stream without the save */
+    uint64_t expected[RNG_STREAM_COUNT];
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        expected[i] = rng_next_u64(rng_stream((RngStream)i));
+    }
+
+    /* Unrelated draws the load must wind back */
+    rng_streams_seed(42);
+
+    char error[256];
+    GameState* loaded = load_game(test_path, error, sizeof(error));
+    if (!loaded) {
+        printf("  Load error: %s\n", error);
+        game_state_destroy(original);
+        unlink(test_path);
+        return false;
+    }
+
+    bool success = loaded->game_seed == original->game_seed &&
+                   rng_streams_get_seed() == original->game_seed;
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        if (rng_next_u64(rng_stream((RngStream)i)) != expected[i]) {
+            printf("  Stream %d restarted instead of continuing\n", i);
+            success = false;
+        }
+    }
+
+    game_state_destroy(original);
+    game_state_destroy(loaded);
+    unlink(test_path);
+
+    return success;
+}
+
 /* Test: Validate detects corrupted file */
 static bool test_validate_corrupted_file(void) {
     const char* test_path = "/tmp/test_corrupted.dat";
@@ -416,6 +480,7 @@ int main(void) {
     printf("=== Save/Load System Tests ===\n\n");
 
     TEST(test_save_load_roundtrip);
+    TEST(test_rng_continues_after_load);
     TEST(test_validate_corrupted_file);
     TEST(test_version_compatibility);
     TEST(test_save_file_exists);
@@ -41,7 +41,7 @@ void test_soul_create_basic(void) {
     TEST_ASSERT(soul->energy > 0, "Soul energy should be positive");
     TEST_ASSERT(soul->bound == false, "Soul should not be bound initially");
     TEST_ASSERT(soul->bound_minion_id == 0, "Bound minion ID should be 0");
-    TEST_ASSERT(strlen(soul->memories) > 0, "Soul should have memories");
+    TEST_ASSERT(strlen(soul_memory_template_text(soul->memory_template)) > 0, "Soul should have memories");
 
     soul_destroy(soul);
     TEST_PASS();
@@ -203,14 +203,20 @@ void test_soul_unbind(void) {
 void test_soul_generate_memories(void) {
     TEST_START("soul_generate_memories");
 
+    char text[SOUL_MEMORY_MAX_LENGTH];
     Soul* soul = soul_create(SOUL_TYPE_WARRIOR, 80);
     TEST_ASSERT(soul != NULL, "Soul creation should succeed");
-    TEST_ASSERT(strlen(soul->memories) > 0, "Soul should have memories");
+    TEST_ASSERT(soul_get_memories(soul, text, sizeof(text)) > 0, "Soul should have memories");
+    TEST_ASSERT(strcmp(text, soul_memory_template_text(soul->memory_template)) == 0,
+                "High quality memories should be intact");
 
     /* Test that different types generate different memories */
     Soul* common = soul_create(SOUL_TYPE_COMMON, 50);
     Soul* warrior = soul_create(SOUL_TYPE_WARRIOR, 50);
-    TEST_ASSERT(strcmp(common->memories, warrior->memories) != 0,
+    char common_text[SOUL_MEMORY_MAX_LENGTH];
+    soul_get_memories(common, common_text, sizeof(common_text));
+    soul_get_memories(warrior, text, sizeof(text));
+    TEST_ASSERT(strcmp(common_text, text) != 0,
                 "Different soul types should have different memories");
 
     soul_destroy(soul);
@@ -219,6 +225,38 @@ void test_soul_generate_memories(void) {
     TEST_PASS();
 }
 
+/**
+ * Test: Degraded memories render truncated and map back from text
+ */
+void test_soul_degraded_memories(void) {
+    TEST_START("soul_degraded_memories");
+
+    Soul* soul = soul_create(SOUL_TYPE_MAGE, 5);
+    TEST_ASSERT(soul != NULL, "Soul creation should succeed");
+    TEST_ASSERT(soul->memory_degradation != 0, "Low quality soul should be degraded");
+
+    char text[SOUL_MEMORY_MAX_LENGTH];
+    size_t len = soul_get_memories(soul, text, sizeof(text));
+    const char* full = soul_memory_template_text(soul->memory_template);
+    TEST_ASSERT(len == strlen(text), "Returned length should match rendered text");
+    TEST_ASSERT(strcmp(text + len - 3, "...") == 0, "Degraded memories should end with ...");
+    TEST_ASSERT(strncmp(text, full, len - 3) == 0, "Degraded memories should keep a prefix");
+    TEST_ASSERT(len - 3 < strlen(full), "Degraded memories should lose characters");
+
+    /* Legacy text maps back to the same reference */
+    uint8_t template_index;
+    uint8_t degradation;
+    TEST_ASSERT(soul_memory_from_text(text, &template_index, &degradation),
+                "Rendered text should map to a template");
+    TEST_ASSERT(template_index == soul->memory_template, "Template should round-trip");
+    TEST_ASSERT(degradation == soul->memory_degradation, "Degradation should round-trip");
+    TEST_ASSERT(!soul_memory_from_text("Not a soul memory", &template_index, &degradation),
+                "Unknown text should not map");
+
+    soul_destroy(soul);
+    TEST_PASS();
+}
+
 /**
  * Test: soul_get_description
  */
@@ -286,6 +324,7 @@ int main(void) {
     test_soul_bind();
     test_soul_unbind();
     test_soul_generate_memories();
+    test_soul_degraded_memories();
     test_soul_get_description();
     test_soul_unique_ids();
 
@@ -1,6 +1,10 @@
 #include "../src/game/souls/soul_manager.h"
+#include "../src/game/game_state.h"
+#include "../src/game/game_globals.h"
+#include "../src/commands/commands/commands.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 /* Test counter */
@@ -137,9 +141,11 @@ void test_soul_manager_remove(void) {
     TEST_ASSERT(soul_manager_count(manager) == 2, "Should have 2 souls after removal");
     TEST_ASSERT(soul_manager_get(manager, id2) == NULL, "Removed soul should not be found");
 
-    /* Verify remaining souls */
-    TEST_ASSERT(soul_manager_get(manager, id1) != NULL, "Soul1 should still exist");
-    TEST_ASSERT(soul_manager_get(manager, id3) != NULL, "Soul3 should still exist");
+    /* Verify remaining souls; soul3 moved into soul2's slot */
+    TEST_ASSERT(soul_manager_get(manager, id1) == soul1, "Soul1 should still exist");
+    TEST_ASSERT(soul_manager_get(manager, id3) == soul3, "Soul3 should still exist");
+    TEST_ASSERT(soul_manager_count_by_type(manager, SOUL_TYPE_MAGE) == 1, "Mage index should follow soul3");
+    TEST_ASSERT(soul_manager_count_by_type(manager, SOUL_TYPE_WARRIOR) == 0, "Warrior index should be cleared");
 
     /* Try to remove non-existent soul */
     TEST_ASSERT(soul_manager_remove(manager, 99999) == false, "Removing non-existent soul should fail");
@@ -202,7 +208,7 @@ void test_soul_manager_total_energy(void) {
     soul_manager_add(manager, soul2);
     soul_manager_add(manager, soul3);
 
-    uint32_t total = soul_manager_total_energy(manager);
+    uint64_t total = soul_manager_total_energy(manager);
     TEST_ASSERT(total == expected_total, "Total energy should match sum of individual energies");
 
     /* Test NULL manager */
@@ -393,16 +399,252 @@ void test_soul_manager_large_scale(void) {
     TEST_ASSERT(soul_manager_count(manager) == 200, "Should have 200 souls");
 
     /* Verify we can still operate on the collection */
-    uint32_t total_energy = soul_manager_total_energy(manager);
+    uint64_t total_energy = soul_manager_total_energy(manager);
     TEST_ASSERT(total_energy > 0, "Total energy should be positive");
 
     soul_manager_destroy(manager);
     TEST_PASS();
 }
 
+/**
+ * Test: Columnar filters agree with a scan over the Soul structs
+ */
+void test_soul_manager_columnar_queries(void) {
+    TEST_START("soul_manager_columnar_queries");
+
+    SoulManager* manager = soul_manager_create();
+
+    /* Odd count so the SIMD blocks and the scalar tail are both used */
+    const int total = 1003;
+    for (int i = 0; i < total; i++) {
+        Soul* soul = soul_create((SoulType)((i * 7) % SOUL_TYPE_COUNT), (SoulQuality)((i * 37) % 101));
+        TEST_ASSERT(soul_manager_add(manager, soul), "Adding soul should succeed");
+        if (i % 3 == 0) {
+            soul_bind(soul, (uint32_t)i + 1);
+        }
+    }
+
+    /* Remove a few souls and reorder to exercise column maintenance */
+    size_t count;
+    Soul** all = soul_manager_get_filtered(manager, NULL, &count);
+    TEST_ASSERT(all && count == (size_t)total, "Should get all souls");
+    for (size_t i = 0; i < count; i += 97) {
+        soul_manager_remove(manager, all[i]->id);
+    }
+    free(all);
+    soul_manager_sort(manager, SOUL_SORT_ENERGY_DESC);
+
+    all = soul_manager_get_filtered(manager, NULL, &count);
+    TEST_ASSERT(all != NULL, "Should get remaining souls");
+
+    /* Unbind one after sorting; the manager must see it */
+    soul_unbind(all[0]->bound ? all[0] : all[1]);
+
+    uint32_t energy = 0;
+    uint32_t unbound_energy = 0;
+    size_t warriors = 0;
+    size_t expected_filtered = 0;
+    for (size_t i = 0; i < count; i++) {
+        energy += all[i]->energy;
+        if (!all[i]->bound) unbound_energy += all[i]->energy;
+        if (all[i]->type == SOUL_TYPE_WARRIOR) {
+            warriors++;
+            if (all[i]->quality >= 60 && !all[i]->bound) expected_filtered++;
+        }
+    }
+
+    TEST_ASSERT(soul_manager_total_energy(manager) == energy, "Total energy should match scan");
+    TEST_ASSERT(soul_manager_total_unbound_energy(manager) == unbound_energy,
+                "Unbound energy should match scan");
+    TEST_ASSERT(soul_manager_count_by_type(manager, SOUL_TYPE_WARRIOR) == warriors,
+                "Warrior count should match scan");
+
+    SoulFilter filter = soul_filter_by_type(SOUL_TYPE_WARRIOR);
+    filter.quality_min = 60;
+    filter.bound_filter = 0;
+    size_t filtered_count;
+    Soul** filtered = soul_manager_get_filtered(manager, &filter, &filtered_count);
+    TEST_ASSERT(filtered_count == expected_filtered, "Filtered count should match scan");
+
+    /* Results keep manager order */
+    size_t j = 0;
+    for (size_t i = 0; i < count && j < filtered_count; i++) {
+        if (all[i] == filtered[j]) j++;
+    }
+    TEST_ASSERT(j == filtered_count, "Filtered souls should be in manager order");
+
+    free(filtered);
+    free(all);
+    soul_manager_destroy(manager);
+    TEST_PASS();
+}
+
+/**
+ * Test: Maintained aggregates and indexes match brute force for many filters
+ */
+void test_soul_manager_aggregates(void) {
+    TEST_START("soul_manager_aggregates");
+
+    SoulManager* manager = soul_manager_create();
+
+    for (int i = 0; i < 700; i++) {
+        Soul* soul = soul_create((SoulType)((i * 5) % SOUL_TYPE_COUNT), (SoulQuality)((i * 13) % 101));
+        TEST_ASSERT(soul_manager_add(manager, soul), "Adding soul should succeed");
+        if (i % 4 == 1) {
+            soul_bind(soul, 1);
+        }
+    }
+
+    /* Remove from the front, middle and end, crossing bitmap words */
+    size_t count;
+    Soul** all = soul_manager_get_filtered(manager, NULL, &count);
+    uint32_t remove_ids[] = {all[0]->id, all[63]->id, all[64]->id, all[350]->id, all[count - 1]->id};
+    free(all);
+    for (size_t i = 0; i < sizeof(remove_ids) / sizeof(remove_ids[0]); i++) {
+        TEST_ASSERT(soul_manager_remove(manager, remove_ids[i]), "Remove should succeed");
+    }
+
+    all = soul_manager_get_filtered(manager, NULL, &count);
+    TEST_ASSERT(count == 695, "Should have 695 souls left");
+    soul_unbind(all[10]->bound ? all[10] : all[11]);
+    soul_bind(all[20]->bound ? all[21] : all[20], 2);
+
+    int bound_filters[] = {-1, 0, 1};
+    for (int type = -1; type < SOUL_TYPE_COUNT; type++) {
+        for (int b = 0; b < 3; b++) {
+            SoulFilter filter = soul_filter_default();
+            filter.type = type;
+            filter.bound_filter = bound_filters[b];
+            filter.quality_min = (SoulQuality)(type + 1) * 10;
+            filter.quality_max = (SoulQuality)(95 - b * 20);
+
+            size_t expected = 0;
+            for (size_t i = 0; i < count; i++) {
+                const Soul* s = all[i];
+                if (type != -1 && s->type != (SoulType)type) continue;
+                if (s->quality < filter.quality_min || s->quality > filter.quality_max) continue;
+                if (filter.bound_filter == 0 && s->bound) continue;
+                if (filter.bound_filter == 1 && !s->bound) continue;
+                expected++;
+            }
+
+            size_t filtered_count;
+            Soul** filtered = soul_manager_get_filtered(manager, &filter, &filtered_count);
+            TEST_ASSERT(soul_manager_count_filtered(manager, &filter) == expected,
+                        "Histogram count should match brute force");
+            TEST_ASSERT(filtered_count == expected, "Filtered query should match brute force");
+            for (size_t i = 0; i < filtered_count; i++) {
+                TEST_ASSERT(type == -1 || filtered[i]->type == (SoulType)type,
+                            "Filtered soul should have requested type");
+            }
+            free(filtered);
+        }
+    }
+
+    /* Energy totals do not wrap at 32 bits */
+    free(all);
+    all = soul_manager_get_filtered(manager, NULL, &count);
+    uint64_t expected_energy = 0;
+    for (size_t i = 0; i < count; i++) {
+        expected_energy += all[i]->energy;
+    }
+    Soul* huge = soul_create(SOUL_TYPE_ANCIENT, 100);
+    huge->energy = UINT32_MAX;
+    TEST_ASSERT(soul_manager_add(manager, huge), "Adding soul should succeed");
+    TEST_ASSERT(soul_manager_total_energy(manager) == expected_energy + UINT32_MAX,
+                "Total energy should exceed 32 bits");
+    TEST_ASSERT(soul_manager_total_unbound_energy(manager) > UINT32_MAX,
+                "Unbound energy should exceed 32 bits");
+
+    /* Clearing resets every aggregate */
+    free(all);
+    soul_manager_clear(manager);
+    TEST_ASSERT(soul_manager_total_energy(manager) == 0, "Energy should reset");
+    TEST_ASSERT(soul_manager_count_by_type(manager, SOUL_TYPE_MAGE) == 0, "Counts should reset");
+    SoulFilter any = soul_filter_default();
+    TEST_ASSERT(soul_manager_count_filtered(manager, &any) == 0, "Histogram should reset");
+
+    soul_manager_destroy(manager);
+    TEST_PASS();
+}
+
+void test_soul_manager_add_batch(void) {
+    TEST_START("soul_manager_add_batch");
+
+    SoulManager* manager = soul_manager_create();
+
+    SoulType types[250];
+    SoulQuality qualities[250];
+    Soul* souls[250];
+    for (int i = 0; i < 250; i++) {
+        types[i] = (SoulType)(i % SOUL_TYPE_COUNT);
+        qualities[i] = (SoulQuality)(i % 101);
+    }
+
+    TEST_ASSERT(soul_create_batch(types, qualities, 250, souls), "Batch create should succeed");
+    TEST_ASSERT(souls[7]->type == types[7] && souls[7]->quality == qualities[7],
+                "Batch souls should have requested type and quality");
+
+    TEST_ASSERT(soul_manager_add_batch(manager, souls, 250) == 250, "All souls should be added");
+    TEST_ASSERT(soul_manager_count(manager) == 250, "Should have 250 souls");
+    TEST_ASSERT(soul_manager_count_by_type(manager, SOUL_TYPE_ANCIENT) == 41, "Type counts should update");
+    TEST_ASSERT(soul_manager_get(manager, souls[249]->id) == souls[249], "Batch souls should be indexed");
+
+    /* Invalid type fails the whole batch create */
+    types[3] = SOUL_TYPE_COUNT;
+    TEST_ASSERT(!soul_create_batch(types, qualities, 10, souls), "Invalid type should fail batch");
+
+    TEST_ASSERT(soul_manager_reserve(manager, 1000), "Reserve should succeed");
+    TEST_ASSERT(soul_manager_count(manager) == 250, "Reserve should not change count");
+
+    soul_manager_destroy(manager);
+    TEST_PASS();
+}
+
 /**
  * Main test runner
  */
+/**
+ * Test: souls command lists by ID after a swap-remove
+ */
+void test_souls_listing_order(void) {
+    TEST_START("souls_listing_order");
+
+    SoulManager* manager = soul_manager_create();
+    GameState* state = calloc(1, sizeof(GameState));
+    TEST_ASSERT(manager != NULL && state != NULL, "Manager and state should be created");
+
+    uint32_t ids[4];
+    for (int i = 0; i < 4; i++) {
+        Soul* soul = soul_create(SOUL_TYPE_COMMON, 50);
+        ids[i] = soul->id;
+        soul_manager_add(manager, soul);
+    }
+    /* Last soul moves into slot 0 */
+    soul_manager_remove(manager, ids[0]);
+
+    state->souls = manager;
+    GameState* saved_state = g_game_state;
+    g_game_state = state;
+    ParsedCommand cmd = { .command_name = "souls" };
+    CommandResult result = cmd_souls(&cmd);
+    g_game_state = saved_state;
+
+    char row[3][16];
+    const char* at[3] = {0};
+    for (int i = 0; i < 3 && result.output; i++) {
+        snprintf(row[i], sizeof(row[i]), "\n%-6u ", ids[i + 1]);
+        at[i] = strstr(result.output, row[i]);
+    }
+    bool ordered = at[0] && at[1] && at[2] && at[0] < at[1] && at[1] < at[2];
+    command_result_destroy(&result);
+    soul_manager_destroy(manager);
+    free(state);
+
+    TEST_ASSERT(ordered, "Remaining souls should be listed in ID order");
+    TEST_PASS();
+}
+
 int main(void) {
     printf("=== Soul Manager Tests ===\n\n");
 
@@ -417,6 +659,10 @@ int main(void) {
     test_soul_manager_get_filtered();
     test_soul_manager_sort();
     test_soul_manager_large_scale();
+    test_soul_manager_columnar_queries();
+    test_soul_manager_aggregates();
+    test_soul_manager_add_batch();
+    test_souls_listing_order();
 
     printf("\n=== Test Results ===\n");
     printf("Tests run: %d\n", tests_run);
@@ -0,0 +1,96 @@
+/**
+ * @file test_territory_status.c
+ * @brief Tests for territory control and alert system
+ */
+
+#include "../src/game/world/territory_status.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+static void test_status_defaults(void) {
+    TerritoryStatusManager* manager = territory_status_create();
+    assert(manager != NULL);
+
+    TerritoryStatus* status = territory_status_get(manager, 7);
+    assert(status != NULL);
+    assert(status->location_id == 7);
+    assert(status->control_percentage == 0);
+    assert(status->alert_level == ALERT_NONE);
+    assert(status->dominant_faction == FACTION_NEUTRAL);
+
+    /* Same location returns the same status */
+    assert(territory_status_get(manager, 7) == status);
+
+    territory_status_destroy(manager);
+    territory_status_destroy(NULL);
+    printf("PASS: test_status_defaults\n");
+}
+
+static void test_status_growth(void) {
+    TerritoryStatusManager* manager = territory_status_create();
+    assert(manager != NULL);
+
+    /* Far more locations than the initial capacity, with sparse IDs */
+    for (uint32_t i = 0; i < 1000; i++) {
+        assert(territory_status_set_control(manager, i * 37 + 5, (uint8_t)(i % 101)));
+    }
+    for (uint32_t i = 0; i < 1000; i++) {
+        TerritoryStatus* status = territory_status_get(manager, i * 37 + 5);
+        assert(status->location_id == i * 37 + 5);
+        assert(status->control_percentage == i % 101);
+        assert(status->stability == territory_status_calculate_stability((uint8_t)(i % 101)));
+    }
+
+    uint32_t controlled[1000];
+    size_t count = territory_status_get_controlled(manager, controlled, 1000);
+    size_t expected = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        if (i % 101 > 50) expected++;
+    }
+    assert(count == expected);
+    assert(territory_status_get_controlled(manager, controlled, 3) == 3);
+
+    territory_status_destroy(manager);
+    printf("PASS: test_status_growth\n");
+}
+
+static void test_alert_update_all(void) {
+    TerritoryStatusManager* manager = territory_status_create();
+    assert(manager != NULL);
+
+    for (uint32_t id = 1; id <= 100; id++) {
+        territory_status_get(manager, id);
+    }
+    assert(territory_status_raise_alert(manager, 10, 3, 0) == ALERT_HIGH);
+    assert(territory_status_raise_alert(manager, 20, 1, 0) == ALERT_LOW);
+
+    uint32_t results[100];
+    assert(territory_status_get_by_alert(manager, ALERT_HIGH, results, 100) == 1);
+    assert(results[0] == 10);
+    assert(territory_status_get_by_alert(manager, ALERT_NONE, results, 100) == 98);
+
+    /* One decay step per update once the decay time has passed */
+    territory_status_update_all(manager, 4 * 3600);
+    assert(territory_status_get(manager, 10)->alert_level == ALERT_MEDIUM);
+    assert(territory_status_get(manager, 20)->alert_level == ALERT_NONE);
+
+    /* Reinforcements called at high alert arrive within the same sweep */
+    TerritoryStatus* status = territory_status_get(manager, 10);
+    assert(!status->reinforcements_called);
+    assert(status->garrison_strength == 100);
+
+    territory_status_destroy(manager);
+    printf("PASS: test_alert_update_all\n");
+}
+
+int main(void) {
+    printf("Running territory status tests...\n\n");
+
+    test_status_defaults();
+    test_status_growth();
+    test_alert_update_all();
+
+    printf("\nAll territory status tests passed!\n");
+    return 0;
+}
@@ -74,6 +74,38 @@ static void test_unclosed_quote(void) {
     printf("[PASS] test_unclosed_quote\n");
 }
 
+static void test_arena_tokens(void) {
+    Arena* arena = arena_create(256);
+    assert(arena != NULL);
+
+    Token* tokens = NULL;
+    size_t count = 0;
+
+    TokenizeResult result = tokenize_arena("souls --type 'dark warrior' x\\ y",
+                                           arena, &tokens, &count);
+
+    assert(result == TOKENIZE_SUCCESS);
+    assert(count == 4);
+    assert(strcmp(tokens[0].value, "souls") == 0);
+    assert(strcmp(tokens[1].value, "--type") == 0);
+    assert(strcmp(tokens[2].value, "dark warrior") == 0);
+    assert(tokens[2].is_quoted == true);
+    assert(strcmp(tokens[3].value, "x y") == 0);
+    assert(tokens[3].length == 3);
+    assert(arena_owns(arena, tokens));
+    assert(arena_owns(arena, tokens[2].value));
+
+    /* Reset reclaims everything; no free_tokens needed */
+    arena_reset(arena);
+    result = tokenize_arena("help", arena, &tokens, &count);
+    assert(result == TOKENIZE_SUCCESS);
+    assert(count == 1);
+    assert(strcmp(tokens[0].value, "help") == 0);
+
+    arena_destroy(arena);
+    printf("[PASS] test_arena_tokens\n");
+}
+
 int main(void) {
     printf("Running tokenizer tests...\n\n");
 
@@ -82,6 +114,7 @@ int main(void) {
     test_escape_sequences();
     test_empty_input();
     test_unclosed_quote();
+    test_arena_tokens();
 
     printf("\nAll tokenizer tests passed!\n");
     return 0;
@@ -7,10 +7,15 @@
 #include "../src/game/world/location.h"
 #include "../src/game/world/territory.h"
 #include "../src/game/world/location_graph.h"
+#include "../src/game/game_state.h"
+#include "../src/game/game_globals.h"
+#include "../src/commands/commands/commands.h"
+#include "../src/commands/executor.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <math.h>
 
 /* Test counters */
 static int tests_run = 0;
@@ -285,6 +290,402 @@ static void test_auto_layout(void) {
     PASS();
 }
 
+/* Mean distance over connected pairs, and over unconnected sample pairs */
+static void layout_spread(WorldMap* map, uint32_t side, double* edge_mean, double* pair_mean) {
+    double edge_sum = 0.0, pair_sum = 0.0;
+    size_t edges = 0, pairs = 0;
+    for (uint32_t id = 1; id <= side * side; id++) {
+        MapCoordinates a, b;
+        world_map_get_coordinates(map, id, &a);
+        if (id % side != 0 && world_map_get_coordinates(map, id + 1, &b)) {
+            edge_sum += sqrt((double)(a.x - b.x) * (a.x - b.x) + (double)(a.y - b.y) * (a.y - b.y));
+            edges++;
+        }
+        uint32_t other = (id * 7919) % (side * side) + 1;
+        if (other != id && world_map_get_coordinates(map, other, &b)) {
+            pair_sum += sqrt((double)(a.x - b.x) * (a.x - b.x) + (double)(a.y - b.y) * (a.y - b.y));
+            pairs++;
+        }
+    }
+    *edge_mean = edges ? edge_sum / edges : 0.0;
+    *pair_mean = pairs ? pair_sum / pairs : 0.0;
+}
+
+/* Test: Force-directed layout of a large graph, sync, async and incremental */
+static void test_auto_layout_large(void) {
+    TEST("test_auto_layout_large");
+
+    const uint32_t side = 40; /* 1600 locations, past the old 100 cap */
+    TerritoryManager* territory = territory_manager_create();
+    LocationGraph* graph = location_graph_create();
+    for (uint32_t row = 0; row < side; row++) {
+        for (uint32_t col = 0; col < side; col++) {
+            uint32_t id = row * side + col + 1;
+            if (col + 1 < side) location_graph_add_bidirectional(graph, id, id + 1, 2, 0);
+            if (row + 1 < side) location_graph_add_bidirectional(graph, id, id + side, 2, 0);
+        }
+    }
+    WorldMap* map = world_map_create(territory, graph);
+    ASSERT(map != NULL, "Map should be created");
+
+    ASSERT(world_map_auto_layout(map, 0), "Layout should succeed");
+
+    MapCoordinates coords;
+    ASSERT(world_map_get_coordinates(map, side * side, &coords), "Last location placed");
+    ASSERT(coords.x >= -1000 && coords.x <= 1000 && coords.y >= -1000 && coords.y <= 1000,
+           "Coordinates should stay in map range");
+
+    /* Neighbors end up much closer than arbitrary pairs */
+    double edge_mean, pair_mean;
+    layout_spread(map, side, &edge_mean, &pair_mean);
+    ASSERT(edge_mean > 0.0 && edge_mean * 4.0 < pair_mean,
+           "Connected locations should sit close together");
+
+    /* The same layout on a worker thread */
+    ASSERT(world_map_auto_layout_async(map, 50, false), "Async layout should start");
+    ASSERT(world_map_layout_pending(map), "Layout should be pending");
+    ASSERT(!world_map_auto_layout_async(map, 50, false), "Only one layout at a time");
+    ASSERT(world_map_layout_wait(map), "Async layout should apply");
+    ASSERT(!world_map_layout_pending(map), "Nothing pending after wait");
+    ASSERT(!world_map_layout_poll(map), "Nothing to poll");
+
+    /* Discover a new location: only it moves */
+    MapCoordinates before;
+    world_map_get_coordinates(map, 1, &before);
+    location_graph_add_bidirectional(graph, 1, 5000, 2, 0);
+    ASSERT(world_map_layout_incremental(map, 30), "Incremental layout should succeed");
+
+    MapCoordinates after, added;
+    world_map_get_coordinates(map, 1, &after);
+    ASSERT(after.x == before.x && after.y == before.y, "Placed locations stay put");
+    ASSERT(world_map_get_coordinates(map, 5000, &added), "New location placed");
+    double d = sqrt((double)(added.x - after.x) * (added.x - after.x) +
+                    (double)(added.y - after.y) * (added.y - after.y));
+    ASSERT(d < pair_mean, "New location should land near its neighbor");
+
+    /* Destroying with a layout in flight joins the worker */
+    ASSERT(world_map_auto_layout_async(map, 10, true), "Async layout should start");
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
+/* Test: Incremental layouts that outgrow map range are refitted, not clamped */
+static void test_layout_incremental_fit(void) {
+    TEST("test_layout_incremental_fit");
+
+    TerritoryManager* territory = territory_manager_create();
+    LocationGraph* graph = location_graph_create();
+    WorldMap* map = world_map_create(territory, graph);
+    ASSERT(map != NULL, "Map should be created");
+
+    /* A chain of 100-hour roads, 400 units each, grown one location at a time */
+    location_graph_add_bidirectional(graph, 1, 2, 100, 0);
+    ASSERT(world_map_auto_layout(map, 0), "Layout should succeed");
+    for (uint32_t id = 3; id <= 8; id++) {
+        location_graph_add_bidirectional(graph, id - 1, id, 100, 0);
+        ASSERT(world_map_layout_incremental(map, 0), "Incremental layout should succeed");
+    }
+
+    /* Clamping would stack the far end of the chain on the map edge */
+    MapCoordinates coords[9];
+    size_t on_edge = 0;
+    for (uint32_t id = 1; id <= 8; id++) {
+        ASSERT(world_map_get_coordinates(map, id, &coords[id]), "Every location placed");
+        if (abs(coords[id].x) >= 1000 || abs(coords[id].y) >= 1000) on_edge++;
+    }
+    ASSERT(on_edge <= 2, "Only the chain's extremes may touch the edge");
+    for (uint32_t id = 2; id <= 8; id++) {
+        ASSERT(coords[id].x != coords[id - 1].x || coords[id].y != coords[id - 1].y,
+               "Neighbors should not coincide");
+    }
+
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
+/* Test: Spatial index queries agree with a brute-force scan */
+static void test_spatial_index(void) {
+    TEST("test_spatial_index");
+
+    TerritoryManager* territory = create_test_territory();
+    LocationGraph* graph = create_test_graph();
+    WorldMap* map = world_map_create(territory, graph);
+    ASSERT(map != NULL, "Map should be created");
+
+    /* 500 locations scattered over +/-500, including negative cells */
+    int16_t xs[501], ys[501];
+    uint32_t seed = 12345;
+    for (uint32_t id = 1; id <= 500; id++) {
+        seed = seed * 1103515245u + 12345u;
+        xs[id] = (int16_t)((seed >> 8) % 1001) - 500;
+        seed = seed * 1103515245u + 12345u;
+        ys[id] = (int16_t)((seed >> 8) % 1001) - 500;
+        world_map_set_coordinates(map, id, xs[id], ys[id]);
+        world_map_set_region(map, id, (MapRegion)(id % MAP_REGION_COUNT));
+    }
+
+    uint32_t results[500];
+    const uint16_t radii[] = {0, 31, 32, 100, 2000};
+    for (size_t r = 0; r < sizeof(radii) / sizeof(radii[0]); r++) {
+        for (uint32_t center = 1; center <= 500; center += 37) {
+            size_t expected = 0;
+            for (uint32_t id = 1; id <= 500; id++) {
+                if (id != center &&
+                    abs(xs[id] - xs[center]) + abs(ys[id] - ys[center]) <= radii[r]) {
+                    expected++;
+                }
+            }
+            size_t found = world_map_get_locations_in_radius(map, center, radii[r], results, 500);
+            ASSERT(found == expected, "Radius query should match brute force");
+        }
+    }
+
+    size_t in_region = world_map_get_locations_in_region(map, MAP_REGION_CENTRAL_NEXUS,
+                                                         results, 500);
+    ASSERT(in_region == 500 / MAP_REGION_COUNT, "Region lists should track set_region");
+    world_map_set_region(map, 5, MAP_REGION_EASTERN_WASTES);
+    ASSERT(world_map_get_locations_in_region(map, MAP_REGION_CENTRAL_NEXUS, results, 500) ==
+           in_region - 1, "Region change should move the location");
+
+    /* Moving the extreme location shrinks the cached bounds */
+    int16_t min_x, max_x, min_y, max_y;
+    ASSERT(world_map_get_bounds(map, &min_x, &max_x, &min_y, &max_y), "Bounds exist");
+    world_map_set_coordinates(map, 600, 900, 0);
+    ASSERT(world_map_get_bounds(map, &min_x, &max_x, &min_y, &max_y) && max_x == 900,
+           "Bounds should grow");
+    world_map_set_coordinates(map, 600, 0, 0);
+    ASSERT(world_map_get_bounds(map, &min_x, &max_x, &min_y, &max_y) && max_x < 900,
+           "Bounds should shrink after the edge location moves");
+
+    /* A moved location is found at its new spot, not its old one */
+    world_map_set_coordinates(map, 601, 900, 1);
+    ASSERT(world_map_get_locations_in_radius(map, 601, 1, results, 500) == 0,
+           "Old position of 600 should be empty");
+    world_map_set_coordinates(map, 601, 0, 1);
+    size_t near = world_map_get_locations_in_radius(map, 601, 1, results, 500);
+    bool found_600 = false;
+    for (size_t i = 0; i < near; i++) {
+        found_600 = found_600 || results[i] == 600;
+    }
+    ASSERT(found_600, "600 should be found at its new position");
+
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
+/* Test: Viewport rendering culls distant locations */
+static void test_render_viewport(void) {
+    TEST("test_render_viewport");
+
+    TerritoryManager* territory = create_test_territory();
+    LocationGraph* graph = create_test_graph();
+    WorldMap* map = world_map_create(territory, graph);
+    ASSERT(map != NULL, "Map should be created");
+
+    world_map_set_coordinates(map, 1, 0, 0);
+    world_map_set_coordinates(map, 2, 10, 5);
+    world_map_set_coordinates(map, 3, 500, 500);
+
+    char buffer[4096];
+    MapRenderOptions opts = map_render_options_default();
+    opts.show_legend = false;
+
+    world_map_render(map, 1, &opts, buffer, sizeof(buffer));
+    ASSERT(strchr(buffer, '?') != NULL, "Whole-map render shows the far village");
+
+    opts.view_radius = 50;
+    world_map_render(map, 1, &opts, buffer, sizeof(buffer));
+    ASSERT(strchr(buffer, '@') != NULL, "Viewport shows the player");
+    ASSERT(strchr(buffer, 'B') != NULL, "Viewport shows nearby locations");
+    ASSERT(strchr(buffer, '?') == NULL, "Viewport culls the far village");
+
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
+/* Test: Cached static layer follows map, territory and marker changes */
+static void test_render_cache(void) {
+    TEST("test_render_cache");
+
+    TerritoryManager* territory = create_test_territory();
+    LocationGraph* graph = create_test_graph();
+    WorldMap* map = world_map_create(territory, graph);
+    ASSERT(map != NULL, "Map should be created");
+
+    world_map_set_coordinates(map, 1, 0, 0);
+    world_map_set_coordinates(map, 2, 10, 5);
+    world_map_set_coordinates(map, 3, 20, 10);
+
+    MapRenderOptions opts = map_render_options_default();
+    opts.show_legend = false;
+    char first[4096], second[4096];
+
+    world_map_render(map, 1, &opts, first, sizeof(first));
+    world_map_render(map, 1, &opts, second, sizeof(second));
+    ASSERT(strcmp(first, second) == 0, "Repeated render should be identical");
+
+    /* Moving the player only moves the marker */
+    world_map_render(map, 2, &opts, second, sizeof(second));
+    ASSERT(strchr(second, 'B') == NULL, "New position shows the marker");
+    ASSERT(strchr(second, 'G') != NULL, "Old position shows its symbol");
+
+    /* Discovery through the territory reaches the cached layer */
+    uint64_t version = territory_manager_get_version(territory);
+    ASSERT(strchr(first, 'V') == NULL, "Village starts undiscovered");
+    ASSERT(territory_manager_discover_location(territory, 3, 100), "Village discovered");
+    ASSERT(!territory_manager_discover_location(territory, 3, 200), "Second discovery is a no-op");
+    ASSERT(territory_manager_get_version(territory) == version + 1, "Territory version bumped once");
+    world_map_render(map, 1, &opts, second, sizeof(second));
+    ASSERT(strchr(second, 'V') != NULL, "Village shown after discovery");
+
+    /* Symbol changes bump the map version and redraw */
+    version = world_map_get_version(map);
+    world_map_set_symbol(map, 2, 'X');
+    ASSERT(world_map_get_version(map) == version + 1, "Map version bumped");
+    world_map_render(map, 1, &opts, second, sizeof(second));
+    ASSERT(strchr(second, 'X') != NULL, "New symbol shown");
+
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
+/* Test: Probing a location redraws the cached layer */
+static void test_probe_discovery(void) {
+    TEST("test_probe_discovery");
+
+    TerritoryManager* territory = create_test_territory();
+    LocationGraph* graph = create_test_graph();
+    WorldMap* map = world_map_create(territory, graph);
+    GameState* state = calloc(1, sizeof(GameState));
+    ASSERT(map != NULL && state != NULL, "Map and state should be created");
+
+    world_map_set_coordinates(map, 1, 0, 0);
+    world_map_set_coordinates(map, 2, 10, 5);
+    world_map_set_coordinates(map, 3, 20, 10);
+    location_add_connection(territory_manager_get_location(territory, 2), 3);
+
+    state->territory = territory;
+    state->current_location_id = 2;
+    state->resources.time_hours = 42;
+    GameState* saved_state = g_game_state;
+    g_game_state = state;
+
+    MapRenderOptions opts = map_render_options_default();
+    opts.show_legend = false;
+    char before[4096], after[4096];
+    world_map_render(map, 1, &opts, before, sizeof(before));
+    ASSERT(strchr(before, 'V') == NULL, "Village starts undiscovered");
+
+    char arg[] = "3";
+    char* args[] = { arg };
+    ParsedCommand cmd = { .command_name = "probe", .args = args, .arg_count = 1 };
+    uint64_t version = territory_manager_get_version(territory);
+    CommandResult result = cmd_probe(&cmd);
+    bool probed = result.success && result.output &&
+                  strstr(result.output, "New Location Discovered") != NULL;
+    command_result_destroy(&result);
+
+    /* Probing again only analyses */
+    result = cmd_probe(&cmd);
+    bool analysed = result.success && result.output &&
+                    strstr(result.output, "Location Analysis") != NULL;
+    command_result_destroy(&result);
+
+    g_game_state = saved_state;
+    ASSERT(probed, "First probe discovers the village");
+    ASSERT(analysed, "Second probe analyses it");
+    ASSERT(territory_manager_get_version(territory) == version + 1, "Territory version bumped once");
+    ASSERT(territory_manager_get_location(territory, 3)->discovered_timestamp == 42,
+           "Discovery stamped with game time");
+
+    world_map_render(map, 1, &opts, after, sizeof(after));
+    ASSERT(strchr(after, 'V') != NULL, "Village shown after probe");
+
+    free(state);
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
+/* Test: Frame rendering reports only changed cells */
+static void test_render_frame(void) {
+    TEST("test_render_frame");
+
+    TerritoryManager* territory = create_test_territory();
+    LocationGraph* graph = create_test_graph();
+    WorldMap* map = world_map_create(territory, graph);
+    MapFrame* frame = map_frame_create();
+    ASSERT(map != NULL && frame != NULL, "Map and frame should be created");
+
+    world_map_set_coordinates(map, 1, 0, 0);
+    world_map_set_coordinates(map, 2, 10, 5);
+    world_map_set_coordinates(map, 3, 20, 10);
+
+    MapRenderOptions opts = map_render_options_default();
+    opts.width = 40;
+    opts.height = 20;
+    MapDirtyRect rects[8];
+
+    size_t count = world_map_render_frame(map, 1, &opts, frame, rects, 8);
+    ASSERT(count == 1, "First frame is one rectangle");
+    ASSERT(rects[0].x == 0 && rects[0].y == 0 && rects[0].width == 40 && rects[0].height == 20,
+           "First frame covers everything");
+    ASSERT(map_frame_get_width(frame) == 40 && map_frame_get_height(frame) == 20,
+           "Frame has the requested size");
+    ASSERT(map_frame_get_row(frame, 20) == NULL, "Rows past the end are NULL");
+
+    /* Frame rows match the string render */
+    char buffer[4096];
+    opts.show_legend = false;
+    world_map_render(map, 1, &opts, buffer, sizeof(buffer));
+    for (uint16_t y = 0; y < 20; y++) {
+        ASSERT(strncmp(buffer + y * 41, map_frame_get_row(frame, y), 40) == 0,
+               "Frame row matches rendered line");
+    }
+
+    count = world_map_render_frame(map, 1, &opts, frame, rects, 8);
+    ASSERT(count == 0, "Unchanged frame reports nothing");
+
+    /* Moving the player dirties exactly the two marker cells */
+    count = world_map_render_frame(map, 2, &opts, frame, rects, 8);
+    ASSERT(count == 2, "Two single cells changed");
+    for (size_t i = 0; i < count; i++) {
+        ASSERT(rects[i].width == 1 && rects[i].height == 1, "Changes are single cells");
+        char c = map_frame_get_row(frame, rects[i].y)[rects[i].x];
+        ASSERT(c == '@' || c == 'G', "Changed cells hold the marker and the old symbol");
+    }
+
+    /* Too few rectangles collapse into one covering both changes */
+    count = world_map_render_frame(map, 1, &opts, frame, rects, 1);
+    ASSERT(count == 1, "Overflow reports one rectangle");
+    ASSERT(rects[0].width > 1 || rects[0].height > 1, "Rectangle covers both cells");
+
+    map_frame_destroy(frame);
+    map_frame_destroy(NULL);
+    world_map_destroy(map);
+    location_graph_destroy(graph);
+    territory_manager_destroy(territory);
+
+    PASS();
+}
+
 /* Test: Map rendering */
 static void test_rendering(void) {
     TEST("test_rendering");
@@ -399,7 +800,14 @@ int main(void) {
     test_bounds();
     test_radius();
     test_auto_layout();
+    test_auto_layout_large();
+    test_layout_incremental_fit();
     test_rendering();
+    test_spatial_index();
+    test_render_viewport();
+    test_render_cache();
+    test_probe_discovery();
+    test_render_frame();
     test_legend();
     test_region_names();
     test_null_parameters();
@@ -0,0 +1,191 @@
+/**
+ * Thread Pool Tests
+ */
+
+#include "core/thread_pool.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/* Test results */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) \
+    printf("Running test: %s\n", #name); \
+    tests_run++; \
+    if (test_##name()) { \
+        tests_passed++; \
+        printf("  ✓ PASSED\n"); \
+    } else { \
+        printf("  ✗ FAILED\n"); \
+    }
+
+static void count_task(void* arg) {
+    atomic_fetch_add((atomic_int*)arg, 1);
+}
+
+/* Records the order tasks ran in */
+typedef struct {
+    int order[16];
+    int count;
+} TaskLog;
+
+typedef struct {
+    TaskLog* log;
+    int id;
+} LoggedTask;
+
+static void logged_task(void* arg) {
+    LoggedTask* task = arg;
+    task->log->order[task->log->count++] = task->id;
+}
+
+/* Splits itself into two subtasks until depth runs out */
+typedef struct {
+    ThreadPool* pool;
+    atomic_int* leaves;
+    int depth;
+} SplitTask;
+
+static void split_task(void* arg) {
+    SplitTask* task = arg;
+    if (task->depth == 0) {
+        atomic_fetch_add(task->leaves, 1);
+        free(task);
+        return;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        SplitTask* child = malloc(sizeof(SplitTask));
+        *child = *task;
+        child->depth--;
+        thread_pool_submit(task->pool, split_task, child);
+    }
+    free(task);
+}
+
+/* Test: Create and destroy pools */
+static bool test_create_destroy(void) {
+    ThreadPool* pool = thread_pool_create(4);
+    if (!pool) return false;
+    bool ok = thread_pool_get_worker_count(pool) == 4;
+    thread_pool_destroy(pool);
+
+    pool = thread_pool_create_inline();
+    if (!pool) return false;
+    ok = ok && thread_pool_get_worker_count(pool) == 0;
+    thread_pool_destroy(pool);
+
+    thread_pool_destroy(NULL);
+    return ok && !thread_pool_submit(NULL, count_task, NULL);
+}
+
+/* Test: Inline pool runs tasks on the waiting thread in submission order */
+static bool test_inline_order(void) {
+    ThreadPool* pool = thread_pool_create_inline();
+    if (!pool) return false;
+
+    TaskLog log = {0};
+    LoggedTask tasks[8];
+    for (int i = 0; i < 8; i++) {
+        tasks[i].log = &log;
+        tasks[i].id = i;
+        thread_pool_submit(pool, logged_task, &tasks[i]);
+    }
+
+    bool ok = log.count == 0;  /* Nothing runs before the wait */
+    thread_pool_wait(pool);
+    ok = ok && log.count == 8;
+    for (int i = 0; i < log.count; i++) {
+        ok = ok && log.order[i] == i;
+    }
+
+    thread_pool_destroy(pool);
+    return ok;
+}
+
+/* Test: Every task runs exactly once across workers */
+static bool test_many_tasks(void) {
+    ThreadPool* pool = thread_pool_create(4);
+    if (!pool) return false;
+
+    atomic_int counter;
+    atomic_init(&counter, 0);
+    bool ok = true;
+
+    /* Reuse the pool across several waits */
+    for (int round = 1; round <= 3; round++) {
+        for (int i = 0; i < 10000; i++) {
+            ok = ok && thread_pool_submit(pool, count_task, &counter);
+        }
+        thread_pool_wait(pool);
+        ok = ok && atomic_load(&counter) == round * 10000;
+    }
+
+    thread_pool_destroy(pool);
+    return ok;
+}
+
+/* Test: Tasks submitted by tasks are waited for and get stolen */
+static bool test_nested_submit(void) {
+    bool ok = true;
+    ThreadPool* pools[2] = { thread_pool_create(3), thread_pool_create_inline() };
+
+    for (int p = 0; p < 2; p++) {
+        if (!pools[p]) return false;
+
+        atomic_int leaves;
+        atomic_init(&leaves, 0);
+        SplitTask* root = malloc(sizeof(SplitTask));
+        root->pool = pools[p];
+        root->leaves = &leaves;
+        root->depth = 12;
+        thread_pool_submit(pools[p], split_task, root);
+        thread_pool_wait(pools[p]);
+
+        ok = ok && atomic_load(&leaves) == 1 << 12;
+        thread_pool_destroy(pools[p]);
+    }
+
+    return ok;
+}
+
+/* Test: Destroy runs tasks still queued */
+static bool test_destroy_drains(void) {
+    ThreadPool* pool = thread_pool_create(2);
+    if (!pool) return false;
+
+    atomic_int counter;
+    atomic_init(&counter, 0);
+    for (int i = 0; i < 500; i++) {
+        thread_pool_submit(pool, count_task, &counter);
+    }
+    thread_pool_destroy(pool);
+
+    return atomic_load(&counter) == 500;
+}
+
+int main(void) {
+    logger_init("test_thread_pool.log", LOG_LEVEL_DEBUG);
+
+    printf("=====================================\n");
+    printf("Thread Pool Tests\n");
+    printf("=====================================\n\n");
+
+    TEST(create_destroy);
+    TEST(inline_order);
+    TEST(many_tasks);
+    TEST(nested_submit);
+    TEST(destroy_drains);
+
+    printf("\n=====================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("=====================================\n");
+
+    logger_shutdown();
+
+    return (tests_passed == tests_run) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,190 @@
+/**
+ * Tick Graph Tests
+ */
+
+#include "core/tick_graph.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+/* Test results */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) \
+    printf("Running test: %s\n", #name); \
+    tests_run++; \
+    if (test_##name()) { \
+        tests_passed++; \
+        printf("  ✓ PASSED\n"); \
+    } else { \
+        printf("  ✗ FAILED\n"); \
+    }
+
+#define NODE_COUNT 6
+
+/* Shared by the nodes of one run */
+typedef struct {
+    atomic_int clock;              /* Stamps completion order */
+    int finished_at[NODE_COUNT];
+    int merged[NODE_COUNT];
+    int merge_count;
+    long work[NODE_COUNT];         /* Each node's own result */
+} RunLog;
+
+typedef struct {
+    RunLog* log;
+    int id;
+} NodeContext;
+
+static void run_node(void* context) {
+    NodeContext* node = context;
+
+    /* Some work so runs overlap */
+    long sum = 0;
+    for (long i = 0; i < 200000; i++) {
+        sum += (i * (node->id + 1)) % 7;
+    }
+    node->log->work[node->id] = sum;
+    node->log->finished_at[node->id] = atomic_fetch_add(&node->log->clock, 1);
+}
+
+static void merge_node(void* context) {
+    NodeContext* node = context;
+    node->log->merged[node->log->merge_count++] = node->id;
+}
+
+/*
+ * Diamond plus independents:
+ *   0 -> 1, 0 -> 2, {1, 2} -> 3, 4 and 5 free
+ */
+static TickGraph* build_graph(RunLog* log, NodeContext contexts[NODE_COUNT]) {
+    TickGraph* graph = tick_graph_create();
+    if (!graph) return NULL;
+
+    for (int i = 0; i < NODE_COUNT; i++) {
+        contexts[i].log = log;
+        contexts[i].id = i;
+        if (tick_graph_add(graph, "node", run_node, merge_node, &contexts[i]) != i) {
+            tick_graph_destroy(graph);
+            return NULL;
+        }
+    }
+    tick_graph_depend(graph, 1, 0);
+    tick_graph_depend(graph, 2, 0);
+    tick_graph_depend(graph, 3, 1);
+    tick_graph_depend(graph, 3, 2);
+    return graph;
+}
+
+static bool check_run(const RunLog* log) {
+    bool ok = log->merge_count == NODE_COUNT;
+    for (int i = 0; i < NODE_COUNT; i++) {
+        /* Merges always in node order */
+        ok = ok && log->merged[i] == i;
+    }
+    ok = ok && log->finished_at[0] < log->finished_at[1];
+    ok = ok && log->finished_at[0] < log->finished_at[2];
+    ok = ok && log->finished_at[1] < log->finished_at[3];
+    ok = ok && log->finished_at[2] < log->finished_at[3];
+    return ok;
+}
+
+/* Test: Dependencies respected and merges ordered, with and without a pool */
+static bool test_run_order(void) {
+    ThreadPool* pools[3] = { NULL, thread_pool_create_inline(), thread_pool_create(4) };
+    bool ok = true;
+    long expected[NODE_COUNT] = {0};
+
+    for (int p = 0; p < 3; p++) {
+        /* Several runs per graph reuse its state */
+        RunLog log = {0};
+        NodeContext contexts[NODE_COUNT];
+        TickGraph* graph = build_graph(&log, contexts);
+        if (!graph) return false;
+
+        for (int run = 0; run < 5; run++) {
+            atomic_init(&log.clock, 0);
+            log.merge_count = 0;
+            ok = ok && tick_graph_run(graph, pools[p]);
+            ok = ok && check_run(&log);
+        }
+
+        /* Same results whatever ran where */
+        for (int i = 0; i < NODE_COUNT; i++) {
+            if (p == 0) expected[i] = log.work[i];
+            ok = ok && log.work[i] == expected[i];
+        }
+
+        tick_graph_destroy(graph);
+        thread_pool_destroy(pools[p]);
+    }
+
+    return ok;
+}
+
+/* Test: Sequential runs break ties by node order */
+static bool test_sequential_order(void) {
+    RunLog log = {0};
+    NodeContext contexts[NODE_COUNT];
+    TickGraph* graph = build_graph(&log, contexts);
+    if (!graph) return false;
+
+    /* Node 0 now waits on node 5 */
+    bool ok = tick_graph_depend(graph, 0, 5);
+    atomic_init(&log.clock, 0);
+    ok = ok && tick_graph_run(graph, NULL);
+
+    /* 4 and 5 are ready first, then the diamond */
+    int expected[NODE_COUNT] = { 2, 3, 4, 5, 0, 1 };
+    for (int i = 0; i < NODE_COUNT; i++) {
+        ok = ok && log.finished_at[i] == expected[i];
+    }
+
+    tick_graph_destroy(graph);
+    return ok;
+}
+
+/* Test: Invalid dependencies and cycles are rejected */
+static bool test_invalid(void) {
+    RunLog log = {0};
+    NodeContext contexts[NODE_COUNT];
+    TickGraph* graph = build_graph(&log, contexts);
+    if (!graph) return false;
+
+    bool ok = tick_graph_get_node_count(graph) == NODE_COUNT;
+    ok = ok && !tick_graph_depend(graph, 2, 2);
+    ok = ok && !tick_graph_depend(graph, 2, NODE_COUNT);
+    ok = ok && !tick_graph_depend(graph, -1, 0);
+    ok = ok && tick_graph_add(graph, "no run", NULL, NULL, NULL) == -1;
+
+    /* 3 -> 0 closes a cycle through the diamond */
+    ok = ok && tick_graph_depend(graph, 0, 3);
+    ok = ok && !tick_graph_run(graph, NULL);
+    ok = ok && log.merge_count == 0;
+
+    tick_graph_destroy(graph);
+    tick_graph_destroy(NULL);
+    return ok && !tick_graph_run(NULL, NULL);
+}
+
+int main(void) {
+    logger_init("test_tick_graph.log", LOG_LEVEL_DEBUG);
+
+    printf("=====================================\n");
+    printf("Tick Graph Tests\n");
+    printf("=====================================\n\n");
+
+    TEST(run_order);
+    TEST(sequential_order);
+    TEST(invalid);
+
+    printf("\n=====================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("=====================================\n");
+
+    logger_shutdown();
+
+    return (tests_passed == tests_run) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
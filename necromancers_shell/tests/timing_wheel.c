@@ -0,0 +1,253 @@
+/**
+ * Timing Wheel Tests
+ */
+
+#include "core/timing_wheel.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Test results */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) \
+    printf("Running test: %s\n", #name); \
+    tests_run++; \
+    if (test_##name()) { \
+        tests_passed++; \
+        printf("  ✓ PASSED\n"); \
+    } else { \
+        printf("  ✗ FAILED\n"); \
+    }
+
+#define MAX_FIRES 4096
+
+/* Records what fired and when */
+typedef struct {
+    int ids[MAX_FIRES];
+    uint64_t hours[MAX_FIRES];
+    int count;
+} FireLog;
+
+typedef struct {
+    FireLog* log;
+    int id;
+} LoggedTimer;
+
+static void logged_timer(uint64_t hour, void* userdata) {
+    LoggedTimer* timer = userdata;
+    if (timer->log->count < MAX_FIRES) {
+        timer->log->ids[timer->log->count] = timer->id;
+        timer->log->hours[timer->log->count] = hour;
+    }
+    timer->log->count++;
+}
+
+/* Reschedules itself every period until told to stop */
+typedef struct {
+    TimingWheel* wheel;
+    uint64_t period;
+    int fired;
+    int limit;
+} RepeatTimer;
+
+static void repeat_timer(uint64_t hour, void* userdata) {
+    RepeatTimer* timer = userdata;
+    if (++timer->fired < timer->limit) {
+        timing_wheel_schedule(timer->wheel, hour + timer->period, repeat_timer, timer);
+    }
+}
+
+/* Test: Timers fire at their hour, same-hour timers in schedule order */
+static bool test_fire_order(void) {
+    TimingWheel* wheel = timing_wheel_create(100);
+    if (!wheel) return false;
+
+    FireLog log = {0};
+    LoggedTimer timers[5];
+    uint64_t at[5] = { 110, 105, 110, 5000, 105 };
+    for (int i = 0; i < 5; i++) {
+        timers[i].log = &log;
+        timers[i].id = i;
+        timing_wheel_schedule(wheel, at[i], logged_timer, &timers[i]);
+    }
+
+    bool ok = timing_wheel_next_due(wheel) == 105;
+    ok = ok && timing_wheel_advance(wheel, 104) == 0;
+    ok = ok && timing_wheel_advance(wheel, 110) == 4;
+    ok = ok && log.ids[0] == 1 && log.ids[1] == 4 && log.ids[2] == 0 && log.ids[3] == 2;
+    ok = ok && log.hours[0] == 105 && log.hours[2] == 110;
+    ok = ok && timing_wheel_next_due(wheel) == 5000;
+
+    /* Backwards does nothing */
+    ok = ok && timing_wheel_advance(wheel, 50) == 0 && timing_wheel_now(wheel) == 110;
+
+    ok = ok && timing_wheel_advance(wheel, 10000) == 1 && log.hours[4] == 5000;
+    ok = ok && timing_wheel_now(wheel) == 10000;
+    ok = ok && timing_wheel_next_due(wheel) == TIMING_WHEEL_NEVER;
+
+    timing_wheel_destroy(wheel);
+    return ok;
+}
+
+/* Test: Cancel removes pending timers and rejects stale handles */
+static bool test_cancel(void) {
+    TimingWheel* wheel = timing_wheel_create(0);
+    if (!wheel) return false;
+
+    FireLog log = {0};
+    LoggedTimer a = { &log, 1 };
+    LoggedTimer b = { &log, 2 };
+    TimerId first = timing_wheel_schedule(wheel, 30, logged_timer, &a);
+    TimerId second = timing_wheel_schedule(wheel, 1000000, logged_timer, &b);
+
+    bool ok = first != 0 && second != 0 && timing_wheel_pending(wheel) == 2;
+    ok = ok && timing_wheel_cancel(wheel, second);
+    ok = ok && !timing_wheel_cancel(wheel, second);
+    ok = ok && timing_wheel_next_due(wheel) == 30;
+
+    ok = ok && timing_wheel_advance(wheel, 2000000) == 1 && log.ids[0] == 1;
+    ok = ok && !timing_wheel_cancel(wheel, first);
+
+    /* Reused node, old handle stays dead */
+    TimerId third = timing_wheel_schedule(wheel, 2000010, logged_timer, &b);
+    ok = ok && third != first && !timing_wheel_cancel(wheel, first);
+    ok = ok && timing_wheel_cancel(wheel, third);
+    ok = ok && timing_wheel_pending(wheel) == 0;
+    ok = ok && !timing_wheel_cancel(wheel, 0) && !timing_wheel_cancel(wheel, 12345);
+
+    timing_wheel_destroy(wheel);
+    timing_wheel_destroy(NULL);
+    return ok && timing_wheel_schedule(NULL, 1, logged_timer, &a) == 0;
+}
+
+/* Test: Callbacks reschedule themselves across a century */
+static bool test_recurring(void) {
+    TimingWheel* wheel = timing_wheel_create(7);
+    if (!wheel) return false;
+
+    RepeatTimer monthly = { wheel, 24 * 30, 0, 1000000 };
+    timing_wheel_schedule(wheel, 7 + monthly.period, repeat_timer, &monthly);
+
+    /* One big jump and many small ones give the same count */
+    uint64_t century = 24ULL * 365 * 100;
+    timing_wheel_advance(wheel, 7 + century / 2);
+    for (uint64_t hour = 7 + century / 2; hour < 7 + century; hour += 97) {
+        timing_wheel_advance(wheel, hour);
+    }
+    timing_wheel_advance(wheel, 7 + century);
+
+    bool ok = monthly.fired == (int)(century / monthly.period);
+    ok = ok && timing_wheel_pending(wheel) == 1;
+
+    timing_wheel_destroy(wheel);
+    return ok;
+}
+
+/* Reference timer for the randomized comparison */
+typedef struct {
+    uint64_t at;
+    int seq;
+    bool live;
+    TimerId id;
+} Reference;
+
+#define RANDOM_TIMERS 3000
+
+/* Test: Random schedules, cancels and advances match a sorted reference */
+static bool test_matches_reference(void) {
+    TimingWheel* wheel = timing_wheel_create(12345);
+    if (!wheel) return false;
+
+    static Reference refs[RANDOM_TIMERS];
+    static LoggedTimer timers[RANDOM_TIMERS];
+    static FireLog log;
+    log.count = 0;
+
+    srand(42);
+    bool ok = true;
+    int scheduled = 0;
+    int expected_fired = 0;
+    uint64_t now = 12345;
+
+    while (scheduled < RANDOM_TIMERS && ok) {
+        /* Schedule a batch at mixed distances, some beyond the wheels */
+        for (int i = 0; i < 20 && scheduled < RANDOM_TIMERS; i++, scheduled++) {
+            uint64_t distance;
+            switch (rand() % 5) {
+                case 0: distance = (uint64_t)(rand() % 64); break;
+                case 1: distance = (uint64_t)(rand() % 5000); break;
+                case 2: distance = (uint64_t)rand() % 300000; break;
+                case 3: distance = ((uint64_t)rand() << 8) % (1ULL << 26); break;
+                default: distance = 0; break;
+            }
+            timers[scheduled].log = &log;
+            timers[scheduled].id = scheduled;
+            refs[scheduled].at = now + distance;
+            refs[scheduled].seq = scheduled;
+            refs[scheduled].live = true;
+            refs[scheduled].id = timing_wheel_schedule(wheel, now + distance,
+                                                       logged_timer, &timers[scheduled]);
+            ok = ok && refs[scheduled].id != 0;
+        }
+
+        /* Cancel a few */
+        for (int i = 0; i < 3; i++) {
+            int victim = rand() % scheduled;
+            ok = ok && timing_wheel_cancel(wheel, refs[victim].id) == refs[victim].live;
+            refs[victim].live = false;
+        }
+
+        /* Earliest pending matches */
+        uint64_t earliest = TIMING_WHEEL_NEVER;
+        for (int i = 0; i < scheduled; i++) {
+            if (refs[i].live && refs[i].at < earliest) earliest = refs[i].at;
+        }
+        ok = ok && timing_wheel_next_due(wheel) == (earliest < now ? now : earliest);
+
+        /* Advance; expected fires are live timers due by then, in (at, seq) order */
+        now += (rand() % 4 == 0) ? ((uint64_t)rand() << 4) % (1ULL << 25) : (uint64_t)(rand() % 3000);
+        timing_wheel_advance(wheel, now);
+
+        for (;;) {
+            int best = -1;
+            for (int i = 0; i < scheduled; i++) {
+                if (!refs[i].live || refs[i].at > now) continue;
+                if (best < 0 || refs[i].at < refs[best].at) best = i;
+            }
+            if (best < 0) break;
+
+            ok = ok && expected_fired < log.count;
+            ok = ok && log.ids[expected_fired] == best;
+            ok = ok && log.hours[expected_fired] == refs[best].at;
+            refs[best].live = false;
+            expected_fired++;
+        }
+        ok = ok && log.count == expected_fired;
+    }
+
+    timing_wheel_destroy(wheel);
+    return ok;
+}
+
+int main(void) {
+    logger_init("test_timing_wheel.log", LOG_LEVEL_DEBUG);
+
+    printf("=====================================\n");
+    printf("Timing Wheel Tests\n");
+    printf("=====================================\n\n");
+
+    TEST(fire_order);
+    TEST(cancel);
+    TEST(recurring);
+    TEST(matches_reference);
+
+    printf("\n=====================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("=====================================\n");
+
+    logger_shutdown();
+
+    return (tests_passed == tests_run) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
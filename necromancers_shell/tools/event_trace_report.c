@@ -0,0 +1,220 @@
+/**
+ * Event Trace Report
+ *
+ * Replays an EventBus trace file (see core/event_trace.h) and prints
+ * throughput, the longest delivery gaps, and per-type queue latency
+ * histograms.
+ *
+ * Usage: event_trace_report <trace-file> [max-types]
+ */
+
+#include "core/event_trace.h"
+#include "core/events.h"
+#include "utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_MAX_TYPES 16
+#define MAX_TYPES 4096
+#define HISTOGRAM_WIDTH 40
+#define GAP_COUNT 5
+
+/* Format a duration with a readable unit */
+static const char* format_ns(uint64_t ns, char* buffer, size_t size) {
+    if (ns < 1000) {
+        snprintf(buffer, size, "%lluns", (unsigned long long)ns);
+    } else if (ns < 1000000) {
+        snprintf(buffer, size, "%.1fus", ns / 1e3);
+    } else if (ns < 1000000000) {
+        snprintf(buffer, size, "%.1fms", ns / 1e6);
+    } else {
+        snprintf(buffer, size, "%.2fs", ns / 1e9);
+    }
+    return buffer;
+}
+
+/* Label of a histogram bucket */
+static const char* bucket_label(uint32_t bucket, char* buffer, size_t size) {
+    if (bucket == 0) {
+        snprintf(buffer, size, "<1us");
+    } else if (bucket == EVENT_TRACE_BUCKETS - 1) {
+        char low[16];
+        snprintf(buffer, size, ">=%s", format_ns((1ULL << (bucket - 1)) * 1000, low, sizeof(low)));
+    } else {
+        char low[16];
+        char high[16];
+        snprintf(buffer, size, "%s-%s",
+                 format_ns((1ULL << (bucket - 1)) * 1000, low, sizeof(low)),
+                 format_ns((1ULL << bucket) * 1000, high, sizeof(high)));
+    }
+    return buffer;
+}
+
+/* Upper bound of the bucket holding the given fraction of latencies */
+static uint64_t latency_percentile(const EventTraceTypeStats* stats, double fraction) {
+    if (stats->dispatched == 0) return 0;
+
+    uint64_t target = (uint64_t)(fraction * (double)stats->dispatched);
+    if (target == 0) target = 1;
+
+    uint64_t seen = 0;
+    for (uint32_t b = 0; b < EVENT_TRACE_BUCKETS; b++) {
+        seen += stats->latency_buckets[b];
+        if (seen >= target) {
+            uint64_t bound = (1ULL << b) * 1000;
+            return bound < stats->latency_max_ns ? bound : stats->latency_max_ns;
+        }
+    }
+    return stats->latency_max_ns;
+}
+
+/* Relies on event_trace_load returning records sorted by time */
+static void print_throughput(const EventTraceRecord* records, size_t count) {
+    uint64_t span = records[count - 1].time_ns - records[0].time_ns;
+    char text[16];
+
+    /* Busiest one-second window, counted from the first record */
+    uint64_t peak = 0;
+    uint64_t window_start = records[0].time_ns;
+    uint64_t in_window = 0;
+
+    /* Longest silences between deliveries, longest first */
+    uint64_t gaps[GAP_COUNT] = {0};
+    size_t gap_at[GAP_COUNT] = {0};
+
+    for (size_t i = 0; i < count; i++) {
+        if (records[i].time_ns - window_start >= 1000000000ULL) {
+            window_start += (records[i].time_ns - window_start) / 1000000000ULL * 1000000000ULL;
+            in_window = 0;
+        }
+        if (++in_window > peak) peak = in_window;
+
+        if (i == 0) continue;
+        uint64_t gap = records[i].time_ns - records[i - 1].time_ns;
+        for (size_t g = 0; g < GAP_COUNT; g++) {
+            if (gap > gaps[g]) {
+                for (size_t m = GAP_COUNT - 1; m > g; m--) {
+                    gaps[m] = gaps[m - 1];
+                    gap_at[m] = gap_at[m - 1];
+                }
+                gaps[g] = gap;
+                gap_at[g] = i;
+                break;
+            }
+        }
+    }
+
+    printf("  Span:       %s\n", format_ns(span, text, sizeof(text)));
+    printf("  Throughput: %.1f events/s (peak %llu in one second)\n",
+           span > 0 ? (double)count * 1e9 / (double)span : (double)count,
+           (unsigned long long)peak);
+
+    printf("\nLongest gaps between deliveries:\n");
+    for (size_t g = 0; g < GAP_COUNT && gaps[g] > 0; g++) {
+        const EventTraceRecord* after = &records[gap_at[g]];
+        char offset[16];
+        printf("  %10s  before %s at +%s\n", format_ns(gaps[g], text, sizeof(text)),
+               event_type_name((EventType)after->type),
+               format_ns(after->time_ns - records[0].time_ns, offset, sizeof(offset)));
+    }
+}
+
+static void print_type_table(const EventTraceTypeStats* stats, size_t types) {
+    char p50[16], p99[16], max[16], deliver[16];
+
+    printf("\n%-26s %9s %8s %8s %8s %10s %9s %9s %9s %9s\n",
+           "TYPE", "COUNT", "PUB", "DISP", "COAL", "EVENTS/S", "LAT P50", "LAT P99", "LAT MAX",
+           "DELIVER");
+
+    for (size_t t = 0; t < types; t++) {
+        const EventTraceTypeStats* s = &stats[t];
+        uint64_t span = s->last_ns - s->first_ns;
+        uint64_t delivered = s->published + s->dispatched;
+
+        printf("%-26s %9llu %8llu %8llu %8llu %10.1f %9s %9s %9s %9s\n",
+               event_type_name((EventType)s->type),
+               (unsigned long long)s->count, (unsigned long long)s->published,
+               (unsigned long long)s->dispatched, (unsigned long long)s->coalesced,
+               span > 0 ? (double)s->count * 1e9 / (double)span : (double)s->count,
+               format_ns(latency_percentile(s, 0.50), p50, sizeof(p50)),
+               format_ns(latency_percentile(s, 0.99), p99, sizeof(p99)),
+               format_ns(s->latency_max_ns, max, sizeof(max)),
+               format_ns(delivered ? s->delivery_total_ns / delivered : 0, deliver, sizeof(deliver)));
+    }
+}
+
+static void print_histograms(const EventTraceTypeStats* stats, size_t types) {
+    printf("\nQueue latency (queued -> delivered):\n");
+
+    for (size_t t = 0; t < types; t++) {
+        const EventTraceTypeStats* s = &stats[t];
+        if (s->dispatched == 0) continue;
+
+        uint32_t first = EVENT_TRACE_BUCKETS;
+        uint32_t last = 0;
+        uint64_t tallest = 0;
+        for (uint32_t b = 0; b < EVENT_TRACE_BUCKETS; b++) {
+            if (s->latency_buckets[b] == 0) continue;
+            if (first == EVENT_TRACE_BUCKETS) first = b;
+            last = b;
+            if (s->latency_buckets[b] > tallest) tallest = s->latency_buckets[b];
+        }
+
+        printf("\n  %s (%llu queued)\n", event_type_name((EventType)s->type),
+               (unsigned long long)s->dispatched);
+        for (uint32_t b = first; b <= last; b++) {
+            char label[40];
+            int width = (int)(s->latency_buckets[b] * HISTOGRAM_WIDTH / tallest);
+            if (s->latency_buckets[b] > 0 && width == 0) width = 1;
+
+            printf("  %17s |", bucket_label(b, label, sizeof(label)));
+            for (int i = 0; i < HISTOGRAM_WIDTH; i++) putchar(i < width ? '#' : ' ');
+            printf("| %llu\n", (unsigned long long)s->latency_buckets[b]);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <trace-file> [max-types]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    size_t max_types = DEFAULT_MAX_TYPES;
+    if (argc > 2) {
+        long requested = strtol(argv[2], NULL, 10);
+        if (requested > 0) max_types = requested < MAX_TYPES ? (size_t)requested : MAX_TYPES;
+    }
+
+    /* Only errors from the trace reader are worth showing */
+    logger_init(NULL, LOG_LEVEL_ERROR);
+
+    EventTraceRecord* records = NULL;
+    size_t count = 0;
+    uint64_t overwritten = 0;
+    if (!event_trace_load(argv[1], &records, &count, &overwritten)) {
+        fprintf(stderr, "Could not read trace: %s\n", argv[1]);
+        logger_shutdown();
+        return EXIT_FAILURE;
+    }
+
+    printf("Event trace: %s\n", argv[1]);
+    printf("  Records:    %zu", count);
+    if (overwritten > 0) {
+        printf(" (%llu older ones overwritten by the ring)", (unsigned long long)overwritten);
+    }
+    printf("\n");
+
+    if (count > 0) {
+        static EventTraceTypeStats stats[MAX_TYPES];
+        size_t types = event_trace_summarize(records, count, stats, max_types);
+
+        print_throughput(records, count);
+        print_type_table(stats, types);
+        print_histograms(stats, types);
+    }
+
+    free(records);
+    logger_shutdown();
+    return EXIT_SUCCESS;
+}